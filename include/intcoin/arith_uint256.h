@@ -0,0 +1,298 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_ARITH_UINT256_H
+#define INTCOIN_ARITH_UINT256_H
+
+#include "types.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace intcoin {
+
+// ============================================================================
+// 256-bit Unsigned Arithmetic
+// ============================================================================
+//
+// uint256 (types.h) is an opaque 32-byte little-endian blob used for hashes
+// and targets. arith_uint256 is the same number held as four 64-bit limbs
+// (least significant first) so target and chain-work math runs a limb at a
+// time instead of a byte at a time. All operations wrap modulo 2^256 and are
+// constexpr, so fixed targets can be derived at compile time.
+
+namespace detail {
+__extension__ typedef unsigned __int128 uint128;
+}
+
+class arith_uint256 {
+public:
+    static constexpr int WIDTH = 4;
+
+    constexpr arith_uint256() = default;
+    constexpr arith_uint256(uint64_t value) : limbs_{value, 0, 0, 0} {}
+
+    // ------------------------------------------------------------------------
+    // Arithmetic
+    // ------------------------------------------------------------------------
+
+    constexpr arith_uint256& operator+=(const arith_uint256& b) {
+        detail::uint128 carry = 0;
+        for (int i = 0; i < WIDTH; ++i) {
+            carry += static_cast<detail::uint128>(limbs_[i]) + b.limbs_[i];
+            limbs_[i] = static_cast<uint64_t>(carry);
+            carry >>= 64;
+        }
+        return *this;
+    }
+
+    constexpr arith_uint256& operator-=(const arith_uint256& b) {
+        return *this += -b;
+    }
+
+    /// Truncating 256x256 multiply (schoolbook, 128-bit partial products)
+    constexpr arith_uint256& operator*=(const arith_uint256& b) {
+        arith_uint256 result;
+        for (int i = 0; i < WIDTH; ++i) {
+            detail::uint128 carry = 0;
+            for (int j = 0; i + j < WIDTH; ++j) {
+                carry += static_cast<detail::uint128>(limbs_[i]) * b.limbs_[j] +
+                         result.limbs_[i + j];
+                result.limbs_[i + j] = static_cast<uint64_t>(carry);
+                carry >>= 64;
+            }
+        }
+        return *this = result;
+    }
+
+    /// Division; a 64-bit divisor takes one 128/64 step per limb, wider
+    /// divisors fall back to shift-and-subtract. Dividing by zero yields zero
+    /// (callers check their divisors).
+    constexpr arith_uint256& operator/=(const arith_uint256& b) {
+        if (b.bits() <= 64) {
+            DivMod64(b.limbs_[0]);
+            return *this;
+        }
+        arith_uint256 num = *this;
+        arith_uint256 div = b;
+        arith_uint256 result;
+        int shift = num.bits() - div.bits();
+        if (shift < 0) {
+            return *this = result;
+        }
+        div <<= static_cast<unsigned>(shift);
+        while (shift >= 0) {
+            if (num >= div) {
+                num -= div;
+                result.limbs_[shift / 64] |= uint64_t{1} << (shift % 64);
+            }
+            div >>= 1;
+            --shift;
+        }
+        return *this = result;
+    }
+
+    /// Divide in place by a 64-bit value and return the remainder
+    constexpr uint64_t DivMod64(uint64_t divisor) {
+        if (divisor == 0) {
+            *this = arith_uint256();
+            return 0;
+        }
+        detail::uint128 rem = 0;
+        for (int i = WIDTH - 1; i >= 0; --i) {
+            const detail::uint128 cur = (rem << 64) | limbs_[i];
+            limbs_[i] = static_cast<uint64_t>(cur / divisor);
+            rem = cur % divisor;
+        }
+        return static_cast<uint64_t>(rem);
+    }
+
+    constexpr arith_uint256& operator++() {
+        return *this += 1;
+    }
+
+    constexpr arith_uint256 operator-() const {
+        arith_uint256 r = ~*this;
+        ++r;
+        return r;
+    }
+
+    // ------------------------------------------------------------------------
+    // Bitwise
+    // ------------------------------------------------------------------------
+
+    constexpr arith_uint256 operator~() const {
+        arith_uint256 r;
+        for (int i = 0; i < WIDTH; ++i) {
+            r.limbs_[i] = ~limbs_[i];
+        }
+        return r;
+    }
+
+    constexpr arith_uint256& operator<<=(unsigned shift) {
+        arith_uint256 r;
+        const unsigned k = shift / 64;
+        const unsigned s = shift % 64;
+        for (unsigned i = 0; i + k < WIDTH; ++i) {
+            r.limbs_[i + k] |= limbs_[i] << s;
+            if (s != 0 && i + k + 1 < WIDTH) {
+                r.limbs_[i + k + 1] |= limbs_[i] >> (64 - s);
+            }
+        }
+        return *this = r;
+    }
+
+    constexpr arith_uint256& operator>>=(unsigned shift) {
+        arith_uint256 r;
+        const unsigned k = shift / 64;
+        const unsigned s = shift % 64;
+        for (unsigned i = k; i < WIDTH; ++i) {
+            r.limbs_[i - k] |= limbs_[i] >> s;
+            if (s != 0 && i - k >= 1) {
+                r.limbs_[i - k - 1] |= limbs_[i] << (64 - s);
+            }
+        }
+        return *this = r;
+    }
+
+    friend constexpr arith_uint256 operator+(arith_uint256 a, const arith_uint256& b) { return a += b; }
+    friend constexpr arith_uint256 operator-(arith_uint256 a, const arith_uint256& b) { return a -= b; }
+    friend constexpr arith_uint256 operator*(arith_uint256 a, const arith_uint256& b) { return a *= b; }
+    friend constexpr arith_uint256 operator/(arith_uint256 a, const arith_uint256& b) { return a /= b; }
+    friend constexpr arith_uint256 operator<<(arith_uint256 a, unsigned shift) { return a <<= shift; }
+    friend constexpr arith_uint256 operator>>(arith_uint256 a, unsigned shift) { return a >>= shift; }
+
+    // ------------------------------------------------------------------------
+    // Comparison
+    // ------------------------------------------------------------------------
+
+    constexpr int CompareTo(const arith_uint256& b) const {
+        for (int i = WIDTH - 1; i >= 0; --i) {
+            if (limbs_[i] < b.limbs_[i]) return -1;
+            if (limbs_[i] > b.limbs_[i]) return 1;
+        }
+        return 0;
+    }
+
+    friend constexpr bool operator==(const arith_uint256& a, const arith_uint256& b) { return a.limbs_ == b.limbs_; }
+    friend constexpr bool operator<(const arith_uint256& a, const arith_uint256& b) { return a.CompareTo(b) < 0; }
+    friend constexpr bool operator>(const arith_uint256& a, const arith_uint256& b) { return a.CompareTo(b) > 0; }
+    friend constexpr bool operator<=(const arith_uint256& a, const arith_uint256& b) { return a.CompareTo(b) <= 0; }
+    friend constexpr bool operator>=(const arith_uint256& a, const arith_uint256& b) { return a.CompareTo(b) >= 0; }
+
+    // ------------------------------------------------------------------------
+    // Accessors
+    // ------------------------------------------------------------------------
+
+    constexpr bool IsZero() const {
+        return (limbs_[0] | limbs_[1] | limbs_[2] | limbs_[3]) == 0;
+    }
+
+    /// Position of the highest set bit plus one (0 for zero)
+    constexpr int bits() const {
+        for (int i = WIDTH - 1; i >= 0; --i) {
+            if (limbs_[i] != 0) {
+                return 64 * i + std::bit_width(limbs_[i]);
+            }
+        }
+        return 0;
+    }
+
+    constexpr uint64_t GetLow64() const { return limbs_[0]; }
+
+    constexpr uint64_t GetLimb(int i) const { return limbs_[i]; }
+
+    /// Nearest double (for difficulty display and ratios)
+    constexpr double getdouble() const {
+        double r = 0.0;
+        for (int i = WIDTH - 1; i >= 0; --i) {
+            r = r * 18446744073709551616.0 + static_cast<double>(limbs_[i]);
+        }
+        return r;
+    }
+
+    // ------------------------------------------------------------------------
+    // Compact ("nBits") Encoding
+    // ------------------------------------------------------------------------
+    //
+    // 0xEEMMMMMM: value = MMMMMM * 256^(EE - 3). Bit 0x00800000 is a sign
+    // bit, so encoders never set it.
+
+    /// Decode compact bits. negative is set when the sign bit is on with a
+    /// non-zero mantissa; overflow when the value does not fit in 256 bits.
+    constexpr arith_uint256& SetCompact(uint32_t compact, bool* negative = nullptr,
+                                        bool* overflow = nullptr) {
+        const unsigned size = compact >> 24;
+        uint32_t word = compact & 0x007FFFFF;
+        if (size <= 3) {
+            word >>= 8 * (3 - size);
+            *this = word;
+        } else {
+            *this = word;
+            *this <<= 8 * (size - 3);
+        }
+        if (negative) {
+            *negative = word != 0 && (compact & 0x00800000) != 0;
+        }
+        if (overflow) {
+            *overflow = word != 0 && (size > 34 ||
+                                      (word > 0xFF && size > 33) ||
+                                      (word > 0xFFFF && size > 32));
+        }
+        return *this;
+    }
+
+    /// Encode as compact bits (shortest form, sign bit never set)
+    constexpr uint32_t GetCompact() const {
+        unsigned size = static_cast<unsigned>(bits() + 7) / 8;
+        uint32_t compact = 0;
+        if (size <= 3) {
+            compact = static_cast<uint32_t>(GetLow64() << (8 * (3 - size)));
+        } else {
+            compact = static_cast<uint32_t>((*this >> (8 * (size - 3))).GetLow64());
+        }
+        if (compact & 0x00800000) {
+            compact >>= 8;
+            size++;
+        }
+        return compact | (size << 24);
+    }
+
+    // ------------------------------------------------------------------------
+    // Conversion
+    // ------------------------------------------------------------------------
+
+    friend constexpr arith_uint256 UintToArith256(const uint256& a);
+    friend constexpr uint256 ArithToUint256(const arith_uint256& a);
+
+private:
+    std::array<uint64_t, WIDTH> limbs_{};
+};
+
+/// Little-endian bytes -> limbs
+constexpr arith_uint256 UintToArith256(const uint256& a) {
+    arith_uint256 r;
+    for (int i = 0; i < arith_uint256::WIDTH; ++i) {
+        uint64_t limb = 0;
+        for (int j = 7; j >= 0; --j) {
+            limb = (limb << 8) | a[i * 8 + j];
+        }
+        r.limbs_[i] = limb;
+    }
+    return r;
+}
+
+/// Limbs -> little-endian bytes
+constexpr uint256 ArithToUint256(const arith_uint256& a) {
+    uint256 r{};
+    for (int i = 0; i < arith_uint256::WIDTH; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            r[i * 8 + j] = static_cast<uint8_t>(a.limbs_[i] >> (8 * j));
+        }
+    }
+    return r;
+}
+
+} // namespace intcoin
+
+#endif // INTCOIN_ARITH_UINT256_H
@@ -10,6 +10,7 @@
 #include "transaction.h"
 #include <vector>
 #include <memory>
+#include <memory_resource>
 
 namespace intcoin {
 
@@ -42,9 +43,41 @@ struct BlockHeader {
     /// RandomX key
     uint256 randomx_key;
 
+    /// Serialized size (fixed)
+    static constexpr size_t SERIALIZED_SIZE = 4 + 32 + 32 + 8 + 4 + 8 + 32 + 32;
+
     /// Calculate block hash
     uint256 GetHash() const;
 
+    /// Serialize to a stream (VectorWriter, HashWriter, ...)
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint32(s, version);
+        SerializeUint256(s, prev_block_hash);
+        SerializeUint256(s, merkle_root);
+        SerializeUint64(s, timestamp);
+        SerializeUint32(s, bits);
+        SerializeUint64(s, nonce);
+        SerializeUint256(s, randomx_hash);
+        SerializeUint256(s, randomx_key);
+    }
+
+    /// Deserialize from a stream (SpanReader, ...)
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        if (!UnserializeUint32(s, version) ||
+            !UnserializeUint256(s, prev_block_hash) ||
+            !UnserializeUint256(s, merkle_root) ||
+            !UnserializeUint64(s, timestamp) ||
+            !UnserializeUint32(s, bits) ||
+            !UnserializeUint64(s, nonce) ||
+            !UnserializeUint256(s, randomx_hash) ||
+            !UnserializeUint256(s, randomx_key)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for block header");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize to bytes
     std::vector<uint8_t> Serialize() const;
 
@@ -82,6 +115,19 @@ public:
     /// Calculate merkle root from transactions
     uint256 CalculateMerkleRoot() const;
 
+    /// Txids of all transactions, in block order. Each transaction caches
+    /// its own hash, so receive, validation, storage and template building
+    /// only serialize it once; blocks of at least PARALLEL_HASH_THRESHOLD
+    /// transactions hash the uncached ones across threads.
+    std::vector<uint256> GetTransactionHashes() const;
+
+    /// Merkle branch (sibling hashes, leaf level first) proving the
+    /// transaction at index; empty if index is out of range
+    std::vector<uint256> GetMerkleBranch(size_t index) const;
+
+    /// Transaction count from which txids are hashed in parallel
+    static constexpr size_t PARALLEL_HASH_THRESHOLD = 64;
+
     /// Verify block structure and PoW
     Result<void> Verify(const class Blockchain& chain) const;
 
@@ -99,6 +145,40 @@ public:
     /// Check if this is genesis block
     bool IsGenesis() const;
 
+    /// Serialize to a stream (VectorWriter, SizeComputer, ...)
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        header.Serialize(s);
+        SerializeUint64(s, transactions.size());
+        for (const auto& tx : transactions) {
+            tx.Serialize(s);
+        }
+    }
+
+    /// Deserialize from a stream (SpanReader, ...)
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        cached_hash_.reset();
+        auto header_result = header.Unserialize(s);
+        if (header_result.IsError()) {
+            return header_result;
+        }
+
+        uint64_t tx_count = 0;
+        if (!UnserializeUint64(s, tx_count)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for transaction count");
+        }
+        transactions.clear();
+        transactions.reserve(BoundedReserve(s, tx_count, Transaction::MIN_SERIALIZED_SIZE));
+        for (uint64_t i = 0; i < tx_count; ++i) {
+            auto result = transactions.emplace_back().Unserialize(s);
+            if (result.IsError()) {
+                return Result<void>::Error("Failed to deserialize transaction " + std::to_string(i) + ": " + result.error);
+            }
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize to bytes
     std::vector<uint8_t> Serialize() const;
 
@@ -112,6 +192,46 @@ private:
     mutable std::optional<uint256> cached_hash_;
 };
 
+// ============================================================================
+// Block View (transient decoding)
+// ============================================================================
+
+/// Block decoded into TransactionViews (see transaction.h), for checks run
+/// before a received block is accepted. The transaction array and every
+/// transaction's input/output arrays come from one memory resource.
+class BlockView {
+public:
+    /// Block header
+    BlockHeader header;
+
+    /// Transactions, pointing into the serialized block
+    std::pmr::vector<TransactionView> transactions;
+
+    /// Arrays are allocated from resource
+    explicit BlockView(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : transactions(resource) {}
+
+    /// Decode in place (same wire format as Block)
+    Result<void> Unserialize(SpanReader& s);
+
+    /// Get block hash
+    uint256 GetHash() const { return header.GetHash(); }
+
+    /// Txids of all transactions, in block order (hashed across threads
+    /// from Block::PARALLEL_HASH_THRESHOLD transactions)
+    std::vector<uint256> GetTransactionHashes() const;
+
+    /// Calculate merkle root from transactions
+    uint256 CalculateMerkleRoot() const;
+
+    /// Owning copy; txids already computed are carried over
+    Block ToBlock() const;
+
+    /// Initial arena size that decodes a block of serialized_size bytes
+    /// without going back to the upstream allocator in the usual case
+    static size_t ArenaSizeHint(size_t serialized_size);
+};
+
 // ============================================================================
 // Genesis Block
 // ============================================================================
@@ -145,12 +265,18 @@ Result<void> ValidateProofOfWork(const BlockHeader& header);
 /// Calculate merkle root from transaction hashes
 uint256 CalculateMerkleRoot(const std::vector<uint256>& tx_hashes);
 
+/// Calculate merkle root, reusing tx_hashes' storage for every level
+uint256 CalculateMerkleRoot(std::vector<uint256>&& tx_hashes);
+
 /// Build merkle tree
 std::vector<uint256> BuildMerkleTree(const std::vector<uint256>& tx_hashes);
 
 /// Get merkle branch for transaction at index
 std::vector<uint256> GetMerkleBranch(const std::vector<uint256>& tx_hashes, size_t index);
 
+/// Get merkle branch for transaction at index, reusing tx_hashes' storage
+std::vector<uint256> GetMerkleBranch(std::vector<uint256>&& tx_hashes, size_t index);
+
 /// Verify merkle proof
 bool VerifyMerkleProof(const uint256& tx_hash, const uint256& merkle_root,
                        const std::vector<uint256>& branch, size_t index);
@@ -17,6 +17,11 @@
 
 namespace intcoin {
 
+namespace ibd {
+struct ScriptCheck;
+class ScriptCheckQueue;
+}
+
 // ============================================================================
 // Blockchain
 // ============================================================================
@@ -256,8 +261,12 @@ public:
     /// Validate difficulty
     Result<void> ValidateDifficulty(const BlockHeader& header) const;
 
+    /// Use a specific script check queue (default: ibd::ScriptCheckQueue::Global())
+    void SetCheckQueue(ibd::ScriptCheckQueue* queue) { check_queue_ = queue; }
+
 private:
     const Blockchain& chain_;
+    ibd::ScriptCheckQueue* check_queue_ = nullptr;
 };
 
 // ============================================================================
@@ -272,12 +281,21 @@ public:
     /// Validate transaction completely
     Result<void> Validate(const Transaction& tx) const;
 
+    /// Validate transaction, appending input script checks to deferred_checks
+    /// instead of running them (nullptr = run inline)
+    Result<void> Validate(const Transaction& tx,
+                          std::vector<ibd::ScriptCheck>* deferred_checks) const;
+
     /// Validate transaction structure
     Result<void> ValidateStructure(const Transaction& tx) const;
 
     /// Validate inputs
     Result<void> ValidateInputs(const Transaction& tx) const;
 
+    /// Validate inputs, deferring script checks (nullptr = run inline)
+    Result<void> ValidateInputs(const Transaction& tx,
+                                std::vector<ibd::ScriptCheck>* deferred_checks) const;
+
     /// Validate outputs
     Result<void> ValidateOutputs(const Transaction& tx) const;
 
@@ -7,6 +7,7 @@
 #include <intcoin/types.h>
 
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace intcoin {
@@ -149,6 +150,57 @@ private:
     bool is_full_;
 };
 
+/// Rolling bloom filter for local bookkeeping (not BIP37): remembers at
+/// least the last `elements` insertions, at most 1.5x that many.
+/// Each cell stores a 2-bit generation rather than a single bit. Every
+/// elements/2 insertions a new generation starts and the cells of the
+/// oldest one are wiped, so old entries age out without a full reset.
+class RollingBloomFilter {
+public:
+    /// Constructor
+    /// @param elements Number of most recent insertions always remembered
+    /// @param fp_rate Desired false positive rate (0.0 - 1.0)
+    RollingBloomFilter(uint32_t elements, double fp_rate);
+
+    /// Add element to the filter
+    /// @param data Element to add
+    void Insert(std::span<const uint8_t> data);
+
+    /// Check if element matches the filter
+    /// @param data Element to check
+    /// @return True if element was inserted recently (may be false positive)
+    bool Contains(std::span<const uint8_t> data) const;
+
+    /// Forget everything and pick a new hash tweak
+    void Reset();
+
+    /// Get filter size in bytes
+    /// @return Size of the cell array
+    size_t GetSize() const { return data_.size() * sizeof(uint64_t); }
+
+private:
+    /// Cell index and bit for hash function hash_num
+    void CellFor(uint32_t hash_num, std::span<const uint8_t> data,
+                 size_t& pos, uint32_t& bit) const;
+
+    /// Cells, as pairs of words holding the low and high generation bits
+    /// of 64 cells each
+    std::vector<uint64_t> data_;
+
+    /// Number of hash functions
+    uint32_t hash_funcs_;
+
+    /// Random tweak for hash functions (re-rolled by Reset)
+    uint32_t tweak_;
+
+    /// Insertions per generation, and so far in the current one
+    uint32_t entries_per_generation_;
+    uint32_t entries_this_generation_;
+
+    /// Current generation (1..3; 0 marks an empty cell)
+    uint32_t generation_;
+};
+
 }  // namespace intcoin
 
 #endif  // INTCOIN_BLOOM_H
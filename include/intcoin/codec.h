@@ -0,0 +1,120 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_CODEC_H
+#define INTCOIN_CODEC_H
+
+#include "types.h"
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace intcoin {
+namespace codec {
+
+// ============================================================================
+// Text Codecs (Hex, Base58, Bech32)
+// ============================================================================
+//
+// The *ToChars() encoders follow std::to_chars: they write into
+// [first, last) and return {end, errc{}}, or {last, errc::value_too_large}
+// (with the buffer contents unspecified) if the output does not fit. They
+// never allocate, so hashes can be formatted into stack buffers or straight
+// into a pre-sized JSON string. The std::string wrappers allocate once, at
+// the exact size.
+//
+// Hex encoding and decoding run 16/32 bytes per step with SSSE3/AVX2 when
+// the build targets them (-march=native), and through lookup tables otherwise.
+
+// ----------------------------------------------------------------------------
+// Hex
+// ----------------------------------------------------------------------------
+
+/// Characters produced by EncodeHex for len bytes
+constexpr size_t HexEncodedSize(size_t len) { return len * 2; }
+
+/// Lowercase hex of data, in byte order
+std::to_chars_result HexToChars(char* first, char* last, std::span<const uint8_t> data);
+
+/// Lowercase hex of data, in byte order
+std::string EncodeHex(std::span<const uint8_t> data);
+
+/// Decode exactly 2 * out.size() hex digits (either case) into out.
+/// Returns false on a length mismatch or any non-hex character.
+bool DecodeHex(std::string_view hex, std::span<uint8_t> out);
+
+/// Decode an even-length hex string; false on odd length or a non-hex character
+bool DecodeHex(std::string_view hex, std::vector<uint8_t>& out);
+
+/// Position of the first non-hex character, or hex.size() if there is none
+size_t FindInvalidHex(std::string_view hex);
+
+// ----------------------------------------------------------------------------
+// Base58
+// ----------------------------------------------------------------------------
+
+/// Upper bound on the characters produced by EncodeBase58 for len bytes
+constexpr size_t Base58MaxEncodedSize(size_t len) { return len * 138 / 100 + 1; }
+
+/// Base58 (Bitcoin alphabet); leading zero bytes become '1'
+std::to_chars_result Base58ToChars(char* first, char* last, std::span<const uint8_t> data);
+
+/// Base58 (Bitcoin alphabet); leading zero bytes become '1'
+std::string EncodeBase58(std::span<const uint8_t> data);
+
+/// Decode Base58; false if any character is outside the alphabet
+bool DecodeBase58(std::string_view encoded, std::vector<uint8_t>& out);
+
+/// Position of the first non-Base58 character, or encoded.size()
+size_t FindInvalidBase58(std::string_view encoded);
+
+// ----------------------------------------------------------------------------
+// Bech32
+// ----------------------------------------------------------------------------
+//
+// "Words" are the 5-bit groups Bech32 actually encodes; the byte-level
+// functions regroup 8-bit data into words (zero padded) first. Checksums
+// are computed on the fly, so encoding needs no intermediate buffers.
+
+/// Characters produced by EncodeBech32 for hrp_len / data_len bytes
+constexpr size_t Bech32EncodedSize(size_t hrp_len, size_t data_len) {
+    return hrp_len + 1 + (data_len * 8 + 4) / 5 + 6;
+}
+
+/// hrp + '1' + words + checksum; words must all be below 32
+std::to_chars_result Bech32WordsToChars(char* first, char* last, std::string_view hrp,
+                                        std::span<const uint8_t> words);
+
+/// hrp + '1' + data (regrouped into 5-bit words) + checksum
+std::to_chars_result Bech32ToChars(char* first, char* last, std::string_view hrp,
+                                   std::span<const uint8_t> data);
+
+/// hrp + '1' + words + checksum; empty if a word is out of range
+std::string EncodeBech32Words(std::string_view hrp, std::span<const uint8_t> words);
+
+/// hrp + '1' + data (regrouped into 5-bit words) + checksum
+std::string EncodeBech32(std::string_view hrp, std::span<const uint8_t> data);
+
+/// Split a Bech32 string at its last '1' and verify the checksum. hrp is
+/// returned lowercase and words exclude the 6 checksum characters.
+Result<void> DecodeBech32Words(std::string_view encoded, std::string& hrp,
+                               std::vector<uint8_t>& words);
+
+/// DecodeBech32Words, then regroup the words into bytes (padding must be zero)
+Result<void> DecodeBech32(std::string_view encoded, std::string& hrp,
+                          std::vector<uint8_t>& data);
+
+/// Regroup frombits-wide values into tobits-wide values (both at most 8),
+/// appending to out. With pad, a final partial group is zero filled;
+/// without, leftover bits must be zero and fewer than frombits.
+bool ConvertBits(std::span<const uint8_t> in, int frombits, int tobits, bool pad,
+                 std::vector<uint8_t>& out);
+
+} // namespace codec
+} // namespace intcoin
+
+#endif // INTCOIN_CODEC_H
@@ -8,9 +8,12 @@
 
 #include "types.h"
 #include "block.h"
+#include "arith_uint256.h"
 #include <cstdint>
 #include <vector>
 #include <map>
+#include <memory>
+#include <optional>
 
 namespace intcoin {
 
@@ -69,6 +72,16 @@ constexpr uint32_t MIN_DIFFICULTY_BITS = 0x207fffff;
 /// Maximum difficulty (hardest possible)
 constexpr uint32_t MAX_DIFFICULTY_BITS = 0x03010000;
 
+/// Easiest allowed target (proof-of-work limit), decoded at compile time
+constexpr arith_uint256 POW_LIMIT = arith_uint256().SetCompact(MIN_DIFFICULTY_BITS);
+
+/// Hardest allowed target
+constexpr arith_uint256 MIN_POW_TARGET = arith_uint256().SetCompact(MAX_DIFFICULTY_BITS);
+
+static_assert(POW_LIMIT.GetCompact() == MIN_DIFFICULTY_BITS, "MIN_DIFFICULTY_BITS must be canonical");
+static_assert(MIN_POW_TARGET.GetCompact() == MAX_DIFFICULTY_BITS, "MAX_DIFFICULTY_BITS must be canonical");
+static_assert(MIN_POW_TARGET < POW_LIMIT, "difficulty bounds are inverted");
+
 /// Maximum nonce value
 constexpr uint64_t MAX_NONCE = 0xFFFFFFFFFFFFFFFFULL;
 
@@ -122,6 +135,13 @@ public:
     /// Convert target to compact bits
     static uint32_t TargetToCompact(const uint256& target);
 
+    /// Decode compact bits; zero for negative or out-of-range encodings
+    static arith_uint256 CompactToArith(uint32_t compact);
+
+    /// Expected number of hashes to find a block at this target
+    /// (2^256 / (target + 1)); zero for invalid bits
+    static arith_uint256 GetBlockWork(uint32_t bits);
+
     /// Check if hash meets difficulty target
     static bool CheckProofOfWork(const uint256& hash, uint32_t bits);
 
@@ -148,9 +168,21 @@ public:
     /// Validate block's RandomX hash
     static Result<void> ValidateBlockHash(const BlockHeader& header);
 
+    /// Validate block's RandomX hash when the header hash is already known
+    static Result<void> ValidateBlockHash(const BlockHeader& header,
+                                          const uint256& header_hash);
+
     /// Calculate RandomX hash for header
     static Result<uint256> CalculateHash(const BlockHeader& header);
 
+    /// Validate RandomX PoW for a batch of headers (e.g. a HEADERS message).
+    /// Headers are split into chunks and hashed in parallel on a VM pool;
+    /// results are merged in order and any failure rejects the batch.
+    /// num_threads = 0 uses all hardware threads.
+    static Result<void> ValidateHeaderBatch(const std::vector<BlockHeader>& headers,
+                                            const std::vector<uint256>& header_hashes,
+                                            size_t num_threads = 0);
+
     /// Get RandomX key for block height
     static uint256 GetRandomXKey(uint64_t height);
 
@@ -162,6 +194,61 @@ public:
 
 private:
     static constexpr uint64_t RANDOMX_EPOCH_BLOCKS = 2048; // ~2.8 days
+    static constexpr size_t HEADER_BATCH_CHUNK_SIZE = 16;   // Headers per work item
+};
+
+// ============================================================================
+// PoW Result Cache
+// ============================================================================
+
+/// Bounded, thread-safe LRU cache of verified RandomX hashes, keyed by the
+/// SHA3-256 digest of the serialized header (i.e. the block hash). Lets a
+/// header that is seen again via headers sync, block relay or a reorg skip
+/// the RandomX evaluation.
+class PowCache {
+public:
+    /// Default capacity (~3 MB worst case)
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 32768;
+
+    struct Stats {
+        uint64_t hits = 0;          ///< RandomX evaluations avoided
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t max_entries = 0;
+    };
+
+    /// Process-wide cache shared by all PoW check sites
+    static PowCache& Instance();
+
+    explicit PowCache(size_t max_entries = DEFAULT_MAX_ENTRIES);
+    ~PowCache();
+
+    PowCache(const PowCache&) = delete;
+    PowCache& operator=(const PowCache&) = delete;
+
+    /// Look up the verified RandomX hash for a header hash
+    std::optional<uint256> Lookup(const uint256& header_hash);
+
+    /// Record a verified RandomX hash (evicts least recently used when full)
+    void Insert(const uint256& header_hash, const uint256& randomx_hash);
+
+    /// Check for an entry without touching LRU order or statistics
+    bool Contains(const uint256& header_hash) const;
+
+    /// Change capacity (evicts immediately if shrinking)
+    void SetMaxEntries(size_t max_entries);
+
+    /// Drop all entries (statistics are kept)
+    void Clear();
+
+    /// Get cache statistics
+    Stats GetStats() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
 };
 
 // ============================================================================
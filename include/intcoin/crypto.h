@@ -10,6 +10,7 @@
 #include <array>
 #include <vector>
 #include <optional>
+#include <memory>
 
 namespace intcoin {
 
@@ -70,6 +71,12 @@ public:
                                    const Signature& signature,
                                    const PublicKey& public_key);
 
+    /// Verify signature on hash, consulting the process-wide SignatureCache
+    /// first and recording successful verifications in it
+    static Result<void> VerifyHashCached(const uint256& hash,
+                                         const Signature& signature,
+                                         const PublicKey& public_key);
+
     /// Import public key from bytes
     static Result<PublicKey> ImportPublicKey(const std::vector<uint8_t>& bytes);
 
@@ -82,13 +89,22 @@ public:
     /// Export secret key to bytes
     static std::vector<uint8_t> ExportSecretKey(const SecretKey& key);
 
-    /// Batch verify signatures (more efficient than individual verification)
-    /// All vectors must have the same size
-    static Result<void> BatchVerify(
+    /// Verify signatures in parallel, one result per item (in input order).
+    /// All vectors must have the same size; otherwise every item fails.
+    static std::vector<Result<void>> BatchVerify(
         const std::vector<std::vector<uint8_t>>& messages,
         const std::vector<Signature>& signatures,
         const std::vector<PublicKey>& public_keys);
 
+    /// One hash to sign in a BatchSign call; secret_key must outlive the call
+    struct SignRequest {
+        uint256 hash{};
+        const SecretKey* secret_key = nullptr;
+    };
+
+    /// Sign hashes in parallel, one result per request (in input order)
+    static std::vector<Result<Signature>> BatchSign(const std::vector<SignRequest>& requests);
+
     /// Get public key fingerprint (first 8 bytes of SHA3-256 hash)
     static uint64_t GetPublicKeyFingerprint(const PublicKey& key);
 
@@ -99,6 +115,74 @@ public:
     static Result<PublicKey> DecompressPublicKey(const std::vector<uint8_t>& compressed);
 };
 
+// ============================================================================
+// Signature Cache
+// ============================================================================
+
+/// Process-wide cache of successful signature verifications, shared by
+/// mempool admission and block validation so a transaction verified when it
+/// entered the mempool is not verified again when its block connects.
+/// Entries are a salted SHA3-256 of (sighash, pubkey, signature); the salt is
+/// random per process so peers cannot engineer collisions. Storage is split
+/// into lock-striped shards with FIFO eviction under a memory budget.
+class SignatureCache {
+public:
+    /// Default memory budget (32 MB)
+    static constexpr size_t DEFAULT_MAX_BYTES = 32 * 1024 * 1024;
+
+    /// Approximate memory cost of one entry (key + hash-set node + FIFO slot)
+    static constexpr size_t ENTRY_BYTES = 96;
+
+    /// Number of independently locked shards
+    static constexpr size_t NUM_STRIPES = 16;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t max_bytes = 0;
+    };
+
+    /// Process-wide cache shared by mempool and block validation
+    static SignatureCache& Instance();
+
+    explicit SignatureCache(size_t max_bytes = DEFAULT_MAX_BYTES);
+    ~SignatureCache();
+
+    SignatureCache(const SignatureCache&) = delete;
+    SignatureCache& operator=(const SignatureCache&) = delete;
+
+    /// Salted cache key of (hash, signature, pubkey). Compute it once to
+    /// look up and then record the same verification.
+    uint256 ComputeEntry(const uint256& hash, const Signature& signature,
+                         const PublicKey& public_key) const;
+
+    /// Check whether this (hash, signature, pubkey) was already verified
+    bool Contains(const uint256& hash, const Signature& signature,
+                  const PublicKey& public_key);
+    bool Contains(const uint256& entry);
+
+    /// Record a successful verification
+    void Insert(const uint256& hash, const Signature& signature,
+                const PublicKey& public_key);
+    void Insert(const uint256& entry);
+
+    /// Change memory budget (evicts immediately if shrinking)
+    void SetMaxBytes(size_t max_bytes);
+
+    /// Drop all entries (statistics are kept)
+    void Clear();
+
+    /// Get cache statistics
+    Stats GetStats() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 // ============================================================================
 // Kyber768 Cryptography (Key Encapsulation)
 // ============================================================================
@@ -153,6 +237,16 @@ public:
     /// Hash buffer with specific size (SHA3-256)
     static uint256 Hash(const uint8_t* data, size_t len);
 
+    /// Hash count equal-length messages stored back to back (SHA3-256)
+    /// out[i] = Hash(data + i * len, len); runs 4/8 messages per Keccak
+    /// permutation on AVX2/AVX-512 CPUs (e.g. a whole merkle level).
+    /// out may overlap data if it does not run ahead of it (out <= data),
+    /// so a merkle level can be hashed in place.
+    static void HashBatch(const uint8_t* data, size_t len, size_t count, uint256* out);
+
+    /// Name of the batch kernel selected at runtime ("avx512", "avx2" or "scalar")
+    static const char* GetBatchImplementation();
+
     /// HMAC-SHA3-256
     static uint256 HMAC(const std::vector<uint8_t>& key,
                         const std::vector<uint8_t>& message);
@@ -175,6 +269,28 @@ public:
         const std::vector<uint8_t>& message);
 };
 
+/// Incremental SHA3-256: absorb data in pieces, finalize once.
+/// The sponge state lives inline (no allocation); copying a hasher copies
+/// its midstate.
+class SHA3Hasher {
+public:
+    /// Absorb bytes
+    SHA3Hasher& Write(const uint8_t* data, size_t len);
+
+    /// Absorb a buffer
+    SHA3Hasher& Write(const std::vector<uint8_t>& data) { return Write(data.data(), data.size()); }
+
+    /// Produce the digest (the hasher must not be written to afterwards)
+    uint256 Finalize();
+
+private:
+    static constexpr size_t RATE = 136;
+
+    uint64_t state_[25] = {};
+    uint8_t buffer_[RATE];
+    size_t buffered_ = 0;
+};
+
 // ============================================================================
 // Address Generation (Bech32 with 'int1' prefix)
 // ============================================================================
@@ -0,0 +1,69 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_FEE_HISTOGRAM_H
+#define INTCOIN_FEE_HISTOGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace intcoin {
+
+/// Feerate distribution of a set of transactions: count, size and fees per
+/// feerate bucket. Mempools keep one up to date as transactions come and
+/// go, so fee estimation and dashboards read it in O(buckets) instead of
+/// walking every entry.
+class FeeHistogram {
+public:
+    /// Number of buckets
+    static constexpr size_t NUM_BUCKETS = 46;
+
+    /// Lowest feerate (ints/byte) of each bucket; the last one is open ended
+    static constexpr std::array<uint64_t, NUM_BUCKETS> BUCKET_MIN_FEE_RATES = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 14, 17, 20, 25, 30,
+        40, 50, 60, 70, 80, 100, 120, 140, 170, 200, 250, 300, 400, 500, 600, 700,
+        800, 1000, 1200, 1400, 1700, 2000, 2500, 3000, 4000, 5000, 6000, 7000, 8000, 10000
+    };
+
+    struct Bucket {
+        uint64_t count = 0;       // Transactions
+        uint64_t size_bytes = 0;  // Their total serialized size
+        uint64_t fees = 0;        // Their total fees (ints)
+    };
+
+    /// Bucket holding a feerate (ints/byte)
+    static size_t BucketIndex(uint64_t fee_rate);
+
+    /// Count a transaction of size_bytes paying fee
+    void Add(uint64_t fee, uint64_t size_bytes);
+
+    /// Uncount a transaction previously added with the same values
+    void Remove(uint64_t fee, uint64_t size_bytes);
+
+    /// Empty every bucket
+    void Clear();
+
+    /// Buckets, lowest feerate first (parallel to BUCKET_MIN_FEE_RATES)
+    const std::array<Bucket, NUM_BUCKETS>& GetBuckets() const { return buckets_; }
+
+    /// Totals over all buckets
+    uint64_t GetCount() const { return count_; }
+    uint64_t GetSizeBytes() const { return size_bytes_; }
+    uint64_t GetFees() const { return fees_; }
+
+    /// Feerate (ints/byte) that a fraction (0.0 - 1.0) of the transactions
+    /// pay less than: the average feerate of the bucket holding that rank.
+    /// Zero when empty.
+    double GetFeeRatePercentile(double fraction) const;
+
+private:
+    std::array<Bucket, NUM_BUCKETS> buckets_{};
+    uint64_t count_ = 0;
+    uint64_t size_bytes_ = 0;
+    uint64_t fees_ = 0;
+};
+
+} // namespace intcoin
+
+#endif // INTCOIN_FEE_HISTOGRAM_H
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_IBD_CHECK_QUEUE_H
+#define INTCOIN_IBD_CHECK_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <intcoin/types.h>
+#include <intcoin/script.h>
+
+namespace intcoin {
+
+// Forward declarations
+class Transaction;
+struct PrecomputedTxData;
+
+namespace ibd {
+
+class ThreadPool;
+
+/**
+ * A single deferred input script check
+ *
+ * Holds everything needed to run ExecuteScript() for one input without
+ * touching the UTXO set, so it can run on any thread. The transaction must
+ * outlive the check.
+ */
+struct ScriptCheck {
+    const Transaction* tx{nullptr};
+    size_t tx_index{0};      // Position of tx in its block (for error reporting)
+    size_t input_index{0};
+    Script script_pubkey;    // Copied from the spent UTXO
+    std::shared_ptr<const PrecomputedTxData> txdata;  // Shared by all checks of tx (optional)
+
+    /**
+     * Execute script_sig against script_pubkey (includes signature checks)
+     */
+    ScriptExecutionResult operator()() const;
+};
+
+/**
+ * Script check queue statistics
+ */
+struct CheckQueueStats {
+    uint64_t batches_run{0};
+    uint64_t checks_run{0};
+    uint64_t checks_skipped{0};   // Not run because an earlier failure aborted the batch
+    uint64_t batches_failed{0};
+};
+
+/**
+ * Parallel script/signature check queue for block connection
+ *
+ * Fans out per-input script checks to worker threads on an ibd::ThreadPool.
+ * The calling (master) thread participates in the work and joins before
+ * returning. The first failing check aborts the remaining work, and the
+ * failure with the lowest index is reported so results are deterministic.
+ */
+class ScriptCheckQueue {
+public:
+    /// Checks handed to a thread per grab (amortises the shared counter)
+    static constexpr size_t BATCH_SIZE = 8;
+
+    /// Below this many checks the master runs them inline
+    static constexpr size_t MIN_PARALLEL_CHECKS = 2;
+
+    /**
+     * @param num_threads Total threads including the master (0 = auto-detect,
+     *                    1 = run everything on the calling thread)
+     */
+    explicit ScriptCheckQueue(size_t num_threads = 0);
+    ~ScriptCheckQueue();
+
+    ScriptCheckQueue(const ScriptCheckQueue&) = delete;
+    ScriptCheckQueue& operator=(const ScriptCheckQueue&) = delete;
+
+    /**
+     * Run all checks, aborting early on first failure
+     *
+     * Only one batch runs at a time; concurrent callers are serialised.
+     *
+     * @param checks Checks to run
+     * @return Ok if every check passed, otherwise the lowest-index failure
+     */
+    Result<void> RunChecks(const std::vector<ScriptCheck>& checks);
+
+    /**
+     * Get total thread count (workers + master)
+     */
+    size_t GetThreadCount() const;
+
+    /**
+     * Get queue statistics
+     */
+    CheckQueueStats GetStats() const;
+
+    /**
+     * Process-wide queue used by BlockValidator
+     */
+    static ScriptCheckQueue& Global();
+
+    /**
+     * Configure the process-wide queue's thread count (0 = auto-detect)
+     *
+     * Call at startup, before any block validation: an existing global queue
+     * is replaced.
+     */
+    static void SetGlobalThreadCount(size_t num_threads);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace ibd
+} // namespace intcoin
+
+#endif // INTCOIN_IBD_CHECK_QUEUE_H
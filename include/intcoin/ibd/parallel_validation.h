@@ -91,11 +91,29 @@ public:
      */
     void SubmitTask(std::function<void()> task);
 
+    /**
+     * Run fn(i) for every i in [0, count) on the pool and the calling
+     * thread, returning once all items are done. Items are claimed one
+     * at a time. The caller never waits on a task that has not started,
+     * so this is safe to call from inside a pool task.
+     *
+     * @param count Number of items
+     * @param fn Item function (called concurrently)
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
 private:
     class Impl;
     std::unique_ptr<Impl> pimpl_;
 };
 
+/**
+ * Process-wide pool for short data-parallel jobs (batch signing and
+ * verification, merkle leaf hashing). It has one thread fewer than the
+ * hardware because ParallelFor callers work too.
+ */
+ThreadPool& GetSharedThreadPool();
+
 /**
  * Parallel Block Processor
  *
@@ -5,6 +5,7 @@
 #define INTCOIN_MEMPOOL_H
 
 #include <intcoin/blockchain.h>
+#include <intcoin/fee_histogram.h>
 #include <intcoin/util.h>
 
 #include <string>
@@ -13,6 +14,7 @@
 #include <set>
 #include <memory>
 #include <functional>
+#include <optional>
 #include <cstdint>
 #include <ctime>
 
@@ -36,6 +38,7 @@ struct MempoolEntry {
     uint64_t fee;
     uint64_t fee_per_byte;
     uint64_t size_bytes;
+    int64_t fee_delta = 0;         // Operator adjustment, counted in scores and package fees
     std::time_t added_time;
     uint32_t height_added;
 
@@ -43,6 +46,23 @@ struct MempoolEntry {
     std::set<uint256> depends_on;  // Parent transactions this depends on
     std::set<uint256> depended_by; // Child transactions depending on this
 
+    // Package aggregates, maintained incrementally by the mempool.
+    // Ancestor totals include this entry and every in-mempool ancestor;
+    // descendant totals include this entry and every in-mempool descendant.
+    uint64_t ancestor_count = 1;
+    uint64_t ancestor_size = 0;
+    uint64_t ancestor_fees = 0;
+    uint64_t descendant_count = 1;
+    uint64_t descendant_size = 0;
+    uint64_t descendant_fees = 0;
+
+    // Contract header, cached at admission so nothing re-parses
+    // contract_data (unset for UTXO transactions)
+    std::string contract_sender;   // Sender address
+    uint64_t contract_nonce = 0;
+    uint64_t gas_limit = 0;
+    uint64_t gas_price = 0;
+
     // Statistics
     uint32_t broadcast_count;
     std::time_t last_broadcast;
@@ -66,16 +86,37 @@ struct MempoolStats {
     // Resource usage
     uint64_t memory_usage_bytes;
     uint32_t orphan_count;
+    uint64_t total_gas;              // Gas limit of all contract transactions
+
+    // Admission floor raised by size trimming (decays back to zero)
+    uint64_t rolling_min_fee_per_kb;
+};
+
+/// Immutable view of the mempool at one point in time. Snapshots are
+/// shared, never modified, and stay valid after the mempool changes;
+/// entries unchanged between snapshots are shared between them too.
+struct MempoolSnapshot {
+    /// Entries in GetAllTransactions order (priority, then ancestor feerate)
+    std::vector<std::shared_ptr<const MempoolEntry>> entries;
+
+    /// Increases with every published snapshot
+    uint64_t sequence = 0;
 };
 
 /// Mempool configuration
 struct MempoolConfig {
     uint64_t max_size_mb = 300;                    // Max mempool size in MB
     uint64_t min_relay_fee_per_kb = 1000;          // Min fee to relay (ints/KB)
+    uint64_t incremental_relay_fee_per_kb = 1000;  // Rolling min fee bump on trimming (ints/KB)
     uint64_t max_orphan_tx = 100;                  // Max orphan transactions
+    uint64_t max_orphan_bytes = 5 * 1024 * 1024;   // Max total size of orphan transactions
+    uint32_t max_orphans_per_peer = 25;            // Max orphans held for a single peer
+    uint32_t orphan_expiry_minutes = 20;           // Drop orphans whose parents never arrive
     uint32_t expiry_hours = 72;                    // Expire transactions after 72h
     bool persist_on_shutdown = true;               // Save mempool to disk
     std::string persist_file = "mempool.dat";      // Persistence file path
+    uint32_t max_ancestor_count = 25;              // Max in-mempool ancestors (incl. self)
+    uint32_t max_descendant_count = 25;            // Max in-mempool descendants (incl. self)
 
     // Priority limits (max transactions per priority level)
     std::map<TxPriority, uint32_t> priority_limits = {
@@ -117,10 +158,11 @@ public:
     /// Get mempool entry (with metadata)
     virtual Result<MempoolEntry> GetEntry(const uint256& tx_hash) const = 0;
 
-    /// Get all transactions (ordered by priority and fee)
+    /// Get all transactions (ordered by priority and ancestor feerate)
     virtual std::vector<MempoolEntry> GetAllTransactions() const = 0;
 
-    /// Get transactions for block template (prioritized)
+    /// Get transactions for block template (prioritized, parents before children,
+    /// each sender's contract transactions in nonce order)
     virtual std::vector<Transaction> GetBlockTemplate(
         uint64_t max_size_bytes,
         uint64_t max_count = 0
@@ -176,18 +218,96 @@ public:
     Result<void> Restore() override;
     Result<void> Clear() override;
 
+    /// Current snapshot, for readers that iterate the whole pool (RPC,
+    /// explorer, analytics). A plain atomic load while the pool is
+    /// unchanged. Changes are only noted as they happen; the first call
+    /// after them publishes once for the whole batch, copying just the
+    /// changed entries and rebuilding outside the admission lock.
+    std::shared_ptr<const MempoolSnapshot> GetSnapshot() const;
+
+    /// Feerate histogram of the whole pool (or of one priority class),
+    /// kept up to date on every add and remove
+    FeeHistogram GetFeeHistogram() const;
+    FeeHistogram GetFeeHistogram(TxPriority priority) const;
+
+    /// Admit a batch: the lock-free checks for every transaction run in
+    /// parallel, then all of them are inserted under one short lock, in
+    /// order (so a batch may contain parents and their children).
+    std::vector<Result<void>> AddTransactions(const std::vector<Transaction>& txs,
+                                              TxPriority priority = TxPriority::NORMAL);
+
+    /// Add a transaction relayed by peer_id. If some inputs are neither in
+    /// the mempool nor found by the coin lookup, the transaction is held as
+    /// an orphan (and "Missing inputs" returned); it is admitted as soon as
+    /// the mempool accepts the parents it is waiting for.
+    Result<void> AddTransactionFromPeer(const Transaction& tx, uint64_t peer_id,
+                                        TxPriority priority = TxPriority::NORMAL);
+
+    /// Is tx_hash held in the orphan pool?
+    bool HasOrphan(const uint256& tx_hash) const;
+
+    /// Drop every orphan relayed by peer_id (e.g. on disconnect)
+    uint32_t EraseOrphansForPeer(uint64_t peer_id);
+
+    /// Coin lookup for outputs not in the mempool. When set, every input
+    /// must resolve to a coin or a mempool output and fees are computed
+    /// from input values. Set before submitting transactions; it is called
+    /// outside the mempool lock, from several threads at once.
+    using CoinLookup = std::function<std::optional<TxOut>(const OutPoint&)>;
+    void SetCoinLookup(CoinLookup lookup);
+
+    /// Extra per-transaction check (e.g. signature verification), run
+    /// outside the mempool lock and concurrently, like the coin lookup
+    using TxCheck = std::function<Result<void>(const Transaction&)>;
+    void SetTransactionCheck(TxCheck check);
+
+    /// Next nonce the chain expects from a contract sender (address), if
+    /// known. When set, contract transactions below it are rejected and a
+    /// sender's queue is only mined from that nonce on. Called outside the
+    /// mempool lock, like the coin lookup.
+    using NonceLookup = std::function<std::optional<uint64_t>(const std::string& sender)>;
+    void SetNonceLookup(NonceLookup lookup);
+
+    /// Evict whole packages, lowest descendant feerate first, until the
+    /// mempool holds at most max_bytes. Raises the rolling minimum fee
+    /// above the best package evicted. Returns the number removed.
+    Result<uint32_t> TrimToSize(uint64_t max_bytes);
+
+    /// Current admission floor: the larger of min_relay_fee_per_kb and the
+    /// rolling minimum fee
+    uint64_t GetMinFeePerKb() const;
+
+    /// Add fee_delta to the fee used for mining and eviction order
+    /// (persisted with the transaction)
+    Result<void> PrioritiseTransaction(const uint256& tx_hash, int64_t fee_delta);
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl_;
 
+    // Admission runs in two stages: PrepareTransaction does everything that
+    // needs no mempool state (stateless checks, hashing, the transaction
+    // check, coin lookups) without the lock; CommitTransaction then checks
+    // conflicts and inputs and inserts, with the lock held.
+    struct PreparedTx;
+    void PrepareTransaction(const Transaction& tx, PreparedTx& prepared) const;
+    Result<void> CommitTransaction(const PreparedTx& prepared, TxPriority priority);  // caller must hold mutex
+    void ProcessOrphans();  // Admit orphans whose parents were just accepted, caller must hold mutex
+
     // Internal helpers
     TxPriority DeterminePriority(const Transaction& tx, uint64_t fee_per_byte) const;
     bool ValidateTransaction(const Transaction& tx) const;
     void EvictLowPriority();
     uint64_t CalculateTxSize(const Transaction& tx) const;
-    std::vector<MempoolEntry> GetAllTransactionsInternal() const;  // Internal helper, caller must hold mutex
     Result<void> RemoveTransactionInternal(const uint256& tx_hash);  // Internal helper, caller must hold mutex
-    Result<void> AddContractTransaction(const Transaction& tx, TxPriority priority);  // Internal helper for contract txs
+    Result<void> AddContractTransaction(const PreparedTx& prepared, TxPriority priority);  // Internal helper for contract txs
+    Result<void> PersistInternal() const;  // Internal helper, caller must hold mutex
+
+    // Restore mirrors admission: ReadDump decodes mempool.dat and prepares
+    // every record without the lock, CommitDump inserts them with it held
+    struct DumpBatch;
+    Result<void> ReadDump(const std::string& path, DumpBatch& batch) const;
+    uint32_t CommitDump(const DumpBatch& batch);  // caller must hold mutex, returns the number restored
 };
 
 /// Helper functions
@@ -4,6 +4,8 @@
 #ifndef INTCOIN_MEMPOOL_ANALYTICS_ANALYTICS_H
 #define INTCOIN_MEMPOOL_ANALYTICS_ANALYTICS_H
 
+#include <intcoin/fee_histogram.h>
+
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -79,6 +81,14 @@ public:
      */
     MempoolStats GetCurrentStats() const;
 
+    /**
+     * Get the feerate histogram of the tracked transactions
+     *
+     * Maintained by OnTransactionAdded/OnTransactionRemoved, so this and
+     * the fee rates in GetCurrentStats() cost O(buckets)
+     */
+    FeeHistogram GetFeeHistogram() const;
+
     /**
      * Get historical mempool snapshots
      *
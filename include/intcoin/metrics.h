@@ -212,6 +212,8 @@ namespace metrics {
     extern Counter& messages_sent;
     extern Counter& messages_received;
     extern Histogram& message_processing_duration;
+    extern Counter& tx_recently_rejected_hits;
+    extern Counter& tx_recently_confirmed_hits;
 
     // Mining metrics
     extern Counter& blocks_mined;
@@ -219,6 +221,11 @@ namespace metrics {
     extern Gauge& hashrate;
     extern Histogram& mining_duration;
 
+    // Consensus metrics
+    extern Counter& pow_cache_hits;
+    extern Counter& pow_cache_misses;
+    extern Gauge& pow_cache_entries;
+
     // Wallet metrics
     extern Gauge& wallet_balance;
     extern Counter& wallet_transactions;
@@ -9,7 +9,9 @@
 
 #include "types.h"
 #include "block.h"
+#include "bloom.h"
 #include "transaction.h"
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -90,6 +92,34 @@ struct NetworkAddress {
     /// Constructor from IP and port
     NetworkAddress(const std::string& ip_str, uint16_t port);
 
+    /// Serialized size (fixed)
+    static constexpr size_t SERIALIZED_SIZE = 8 + 8 + 16 + 2;
+
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint64(s, timestamp);
+        SerializeUint64(s, services);
+        SerializeBytes(s, ip.data(), ip.size());
+        // Port is big-endian (network byte order)
+        const uint8_t port_bytes[2] = {static_cast<uint8_t>(port >> 8), static_cast<uint8_t>(port)};
+        SerializeBytes(s, port_bytes, sizeof(port_bytes));
+    }
+
+    /// Deserialize from a stream
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        uint8_t port_bytes[2];
+        if (!UnserializeUint64(s, timestamp) ||
+            !UnserializeUint64(s, services) ||
+            !UnserializeBytes(s, ip.data(), ip.size()) ||
+            !UnserializeBytes(s, port_bytes, sizeof(port_bytes))) {
+            return Result<void>::Error("NetworkAddress data too short");
+        }
+        port = static_cast<uint16_t>((port_bytes[0] << 8) | port_bytes[1]);
+        return Result<void>::Ok();
+    }
+
     /// Serialize
     std::vector<uint8_t> Serialize() const;
 
@@ -183,9 +213,32 @@ struct NetworkMessage {
     NetworkMessage(uint32_t magic, const std::string& cmd,
                   const std::vector<uint8_t>& data);
 
+    /// Constructor taking ownership of the payload (no copy)
+    NetworkMessage(uint32_t magic, const std::string& cmd,
+                  std::vector<uint8_t>&& data);
+
+    /// Header size (magic + command + length + checksum)
+    static constexpr size_t HEADER_SIZE = 4 + 12 + 4 + 4;
+
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint32(s, magic);
+        // Command is null-padded to 12 bytes
+        uint8_t cmd[12] = {};
+        std::copy_n(command.begin(), std::min<size_t>(command.size(), sizeof(cmd)), cmd);
+        SerializeBytes(s, cmd, sizeof(cmd));
+        SerializeUint32(s, length);
+        SerializeUint32(s, checksum);
+        SerializeBytes(s, payload.data(), payload.size());
+    }
+
     /// Serialize message
     std::vector<uint8_t> Serialize() const;
 
+    /// Get serialized size (header + payload)
+    size_t GetSerializedSize() const { return HEADER_SIZE + payload.size(); }
+
     /// Deserialize message
     static Result<NetworkMessage> Deserialize(const std::vector<uint8_t>& data);
 
@@ -212,6 +265,27 @@ struct InvVector {
     InvType type;
     uint256 hash;
 
+    /// Serialized size (fixed)
+    static constexpr size_t SERIALIZED_SIZE = 4 + 32;
+
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint32(s, static_cast<uint32_t>(type));
+        SerializeUint256(s, hash);
+    }
+
+    /// Deserialize from a stream
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        uint32_t type_val = 0;
+        if (!UnserializeUint32(s, type_val) || !UnserializeUint256(s, hash)) {
+            return Result<void>::Error("InvVector data too short");
+        }
+        type = static_cast<InvType>(type_val);
+        return Result<void>::Ok();
+    }
+
     /// Serialize
     std::vector<uint8_t> Serialize() const;
 
@@ -484,6 +558,44 @@ public:
                                   const std::vector<uint8_t>& payload);
 };
 
+// ============================================================================
+// Recent Transaction Filter
+// ============================================================================
+
+/// Txids not worth fetching or validating again when another peer announces
+/// them: ones recently rejected (forgotten whenever the tip changes, since
+/// a new block can make them valid) and ones recently confirmed (forgotten
+/// on a reorg). Shared by all peers.
+class RecentTxFilter {
+public:
+    /// Remembered rejections and confirmations (at least this many each)
+    static constexpr uint32_t MAX_REJECTED = 120000;
+    static constexpr uint32_t MAX_CONFIRMED = 48000;
+
+    /// Process-wide filter used by the message handlers
+    static RecentTxFilter& Instance();
+
+    RecentTxFilter();
+
+    /// Was txid recently rejected or confirmed? Counts a metrics hit if so.
+    bool Contains(const uint256& txid) const;
+
+    /// Remember a transaction that failed validation or mempool policy
+    void AddRejected(const uint256& txid);
+
+    /// New tip: remember its transactions and forget rejections
+    void BlockConnected(const Block& block);
+
+    /// Forget everything
+    void Clear();
+
+private:
+    RollingBloomFilter rejected_;
+    RollingBloomFilter confirmed_;
+    uint256 tip_hash_{};
+    mutable std::mutex mutex_;
+};
+
 // ============================================================================
 // Peer Reputation Manager
 // ============================================================================
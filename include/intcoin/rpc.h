@@ -248,6 +248,7 @@ public:
     static JSONValue getdifficulty(const JSONValue& params, Blockchain& blockchain);
     static JSONValue getmempoolinfo(const JSONValue& params, Blockchain& blockchain);
     static JSONValue getrawmempool(const JSONValue& params, Blockchain& blockchain);
+    static JSONValue getmempoolfeehistogram(const JSONValue& params, Blockchain& blockchain);
     static JSONValue getblockstats(const JSONValue& params, Blockchain& blockchain);
     static JSONValue gettxoutsetinfo(const JSONValue& params, Blockchain& blockchain);
 };
@@ -187,11 +187,15 @@ struct ScriptExecutionResult {
     }
 };
 
+struct PrecomputedTxData;
+
 /// Execute script (simplified interpreter)
+/// @param txdata Optional sighash data precomputed for tx (shared across its inputs)
 ScriptExecutionResult ExecuteScript(const Script& script_sig,
                                    const Script& script_pubkey,
                                    const class Transaction& tx,
-                                   size_t input_index);
+                                   size_t input_index,
+                                   const PrecomputedTxData* txdata = nullptr);
 
 } // namespace intcoin
 
@@ -0,0 +1,340 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#ifndef INTCOIN_SERIALIZE_H
+#define INTCOIN_SERIALIZE_H
+
+#include "types.h"
+#include "util.h"
+#include "crypto.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace intcoin {
+
+// ============================================================================
+// Stream Serialization
+// ============================================================================
+//
+// The SerializeUint*() helpers in util.h append to a std::vector<uint8_t>.
+// The overloads below accept any stream with Write(const uint8_t*, size_t),
+// so an object's Serialize(Stream&) can target a byte buffer (VectorWriter),
+// a hash (HashWriter) or just count bytes (SizeComputer) with the same code.
+// The non-template vector overloads in util.h are preferred when passed a
+// std::vector directly.
+//
+// Objects read themselves back with Unserialize(Stream&), returning
+// Result<void>. Input streams provide Read(uint8_t*, size_t), which fails
+// without consuming anything if too few bytes remain, and Remaining(), so
+// length prefixes can be checked before anything is allocated.
+
+/// Serialize raw bytes
+template <typename Stream>
+inline void SerializeBytes(Stream& s, const uint8_t* data, size_t len) {
+    s.Write(data, len);
+}
+
+/// Serialize uint8
+template <typename Stream>
+inline void SerializeUint8(Stream& s, uint8_t value) {
+    s.Write(&value, 1);
+}
+
+/// Serialize uint16 (little-endian)
+template <typename Stream>
+inline void SerializeUint16(Stream& s, uint16_t value) {
+    uint8_t buf[2] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8)};
+    s.Write(buf, sizeof(buf));
+}
+
+/// Serialize uint32 (little-endian)
+template <typename Stream>
+inline void SerializeUint32(Stream& s, uint32_t value) {
+    uint8_t buf[4];
+    for (int i = 0; i < 4; ++i) {
+        buf[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+    s.Write(buf, sizeof(buf));
+}
+
+/// Serialize uint64 (little-endian)
+template <typename Stream>
+inline void SerializeUint64(Stream& s, uint64_t value) {
+    uint8_t buf[8];
+    for (int i = 0; i < 8; ++i) {
+        buf[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+    s.Write(buf, sizeof(buf));
+}
+
+/// Serialize uint256
+template <typename Stream>
+inline void SerializeUint256(Stream& s, const uint256& value) {
+    s.Write(value.data(), value.size());
+}
+
+// ============================================================================
+// Stream Deserialization
+// ============================================================================
+
+/// Read raw bytes
+template <typename Stream>
+inline bool UnserializeBytes(Stream& s, uint8_t* data, size_t len) {
+    return s.Read(data, len);
+}
+
+/// Read len bytes into a vector (fails before allocating if fewer remain)
+template <typename Stream>
+inline bool UnserializeByteVector(Stream& s, std::vector<uint8_t>& out, uint64_t len) {
+    if (len > s.Remaining()) {
+        return false;
+    }
+    out.resize(static_cast<size_t>(len));
+    return s.Read(out.data(), out.size());
+}
+
+/// Read uint8
+template <typename Stream>
+inline bool UnserializeUint8(Stream& s, uint8_t& value) {
+    return s.Read(&value, 1);
+}
+
+/// Read uint16 (little-endian)
+template <typename Stream>
+inline bool UnserializeUint16(Stream& s, uint16_t& value) {
+    uint8_t buf[2];
+    if (!s.Read(buf, sizeof(buf))) return false;
+    value = static_cast<uint16_t>(buf[0] | (buf[1] << 8));
+    return true;
+}
+
+/// Read uint32 (little-endian)
+template <typename Stream>
+inline bool UnserializeUint32(Stream& s, uint32_t& value) {
+    uint8_t buf[4];
+    if (!s.Read(buf, sizeof(buf))) return false;
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(buf[i]) << (i * 8);
+    }
+    return true;
+}
+
+/// Read uint64 (little-endian)
+template <typename Stream>
+inline bool UnserializeUint64(Stream& s, uint64_t& value) {
+    uint8_t buf[8];
+    if (!s.Read(buf, sizeof(buf))) return false;
+    value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(buf[i]) << (i * 8);
+    }
+    return true;
+}
+
+/// Read uint256
+template <typename Stream>
+inline bool UnserializeUint256(Stream& s, uint256& value) {
+    return s.Read(value.data(), value.size());
+}
+
+// ============================================================================
+// Variable-Length Integers
+// ============================================================================
+//
+// Storage-only encoding (never used on the wire or in hashes): 7 bits per
+// byte, most significant group first, high bit set on every byte but the
+// last. Each continuation subtracts one, so every value has exactly one
+// encoding. Values below 128 take one byte, below 16512 two, and a full
+// uint64 at most ten.
+
+/// Serialize a variable-length integer
+template <typename Stream>
+inline void SerializeVarInt(Stream& s, uint64_t value) {
+    uint8_t buf[10];
+    size_t pos = sizeof(buf);
+    buf[--pos] = static_cast<uint8_t>(value & 0x7F);
+    while (value > 0x7F) {
+        value = (value >> 7) - 1;
+        buf[--pos] = static_cast<uint8_t>((value & 0x7F) | 0x80);
+    }
+    s.Write(buf + pos, sizeof(buf) - pos);
+}
+
+/// Read a variable-length integer (fails on truncation or overflow)
+template <typename Stream>
+inline bool UnserializeVarInt(Stream& s, uint64_t& value) {
+    value = 0;
+    while (true) {
+        uint8_t byte = 0;
+        if (!s.Read(&byte, 1) || value > (UINT64_MAX >> 7)) {
+            return false;
+        }
+        value = (value << 7) | (byte & 0x7F);
+        if (!(byte & 0x80)) {
+            return true;
+        }
+        if (value == UINT64_MAX) {
+            return false;
+        }
+        ++value;
+    }
+}
+
+/// Capacity to reserve for count elements of at least min_size bytes each,
+/// capped by what the stream can actually hold (hostile counts can't force
+/// a huge allocation)
+template <typename Stream>
+inline size_t BoundedReserve(const Stream& s, uint64_t count, size_t min_size) {
+    const uint64_t max_count = s.Remaining() / min_size;
+    return static_cast<size_t>(count < max_count ? count : max_count);
+}
+
+// ============================================================================
+// Streams
+// ============================================================================
+
+/// Appends serialized bytes to a vector
+class VectorWriter {
+public:
+    explicit VectorWriter(std::vector<uint8_t>& out) : out_(out) {}
+
+    VectorWriter& Write(const uint8_t* data, size_t len) {
+        out_.insert(out_.end(), data, data + len);
+        return *this;
+    }
+
+private:
+    std::vector<uint8_t>& out_;
+};
+
+/// Counts serialized bytes without storing them, so buffers can be
+/// allocated once at their exact size
+class SizeComputer {
+public:
+    SizeComputer& Write(const uint8_t*, size_t len) {
+        size_ += len;
+        return *this;
+    }
+
+    /// Serialize an object with a Serialize(Stream&) member into the count
+    template <typename T>
+    SizeComputer& operator<<(const T& obj) {
+        obj.Serialize(*this);
+        return *this;
+    }
+
+    size_t Size() const { return size_; }
+
+private:
+    size_t size_ = 0;
+};
+
+/// Reads serialized bytes from a borrowed buffer (which must outlive it)
+class SpanReader {
+public:
+    SpanReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+    explicit SpanReader(const std::vector<uint8_t>& data) : SpanReader(data.data(), data.size()) {}
+
+    /// Copy out len bytes; returns false (consuming nothing) if fewer remain
+    bool Read(uint8_t* out, size_t len) {
+        if (len > size_ - pos_) {
+            return false;
+        }
+        if (len > 0) {
+            std::memcpy(out, data_ + pos_, len);
+        }
+        pos_ += len;
+        return true;
+    }
+
+    /// Point out at the next len bytes without copying them (valid as long
+    /// as the underlying buffer); returns false (consuming nothing) if fewer
+    /// remain
+    bool ReadView(size_t len, std::span<const uint8_t>& out) {
+        if (len > size_ - pos_) {
+            return false;
+        }
+        out = std::span<const uint8_t>(data_ + pos_, len);
+        pos_ += len;
+        return true;
+    }
+
+    /// The bytes read since position begin, in place
+    std::span<const uint8_t> ConsumedSince(size_t begin) const {
+        return std::span<const uint8_t>(data_ + begin, pos_ - begin);
+    }
+
+    /// Bytes not yet read
+    size_t Remaining() const { return size_ - pos_; }
+
+    /// Bytes read so far
+    size_t Position() const { return pos_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+/// Absorbs serialized bytes straight into SHA3-256 (nothing is buffered
+/// beyond one Keccak block), e.g. for txids and block hashes
+class HashWriter {
+public:
+    HashWriter& Write(const uint8_t* data, size_t len) {
+        hasher_.Write(data, len);
+        return *this;
+    }
+
+    /// Serialize an object with a Serialize(Stream&) member into the hash
+    template <typename T>
+    HashWriter& operator<<(const T& obj) {
+        obj.Serialize(*this);
+        return *this;
+    }
+
+    /// SHA3-256 of everything written (call once)
+    uint256 GetHash() { return hasher_.Finalize(); }
+
+private:
+    SHA3Hasher hasher_;
+};
+
+// ============================================================================
+// Exact-Size Encoding
+// ============================================================================
+
+/// Run a serialization routine (a callable taking any stream) against a
+/// SizeComputer, then into a vector reserved to exactly that size. The
+/// routine runs twice, but the result is allocated once.
+template <typename F>
+std::vector<uint8_t> SerializeExact(F&& serialize) {
+    SizeComputer sizer;
+    serialize(sizer);
+    std::vector<uint8_t> out;
+    out.reserve(sizer.Size());
+    VectorWriter writer(out);
+    serialize(writer);
+    return out;
+}
+
+/// Serialized size of an object with a Serialize(Stream&) member
+template <typename T>
+size_t ComputeSerializedSize(const T& obj) {
+    SizeComputer sizer;
+    obj.Serialize(sizer);
+    return sizer.Size();
+}
+
+/// Serialize an object with a Serialize(Stream&) member in one allocation
+template <typename T>
+std::vector<uint8_t> SerializeToVector(const T& obj) {
+    return SerializeExact([&obj](auto& s) { obj.Serialize(s); });
+}
+
+} // namespace intcoin
+
+#endif // INTCOIN_SERIALIZE_H
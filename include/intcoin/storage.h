@@ -10,6 +10,7 @@
 #include "types.h"
 #include "block.h"
 #include "transaction.h"
+#include "fee_histogram.h"
 #include <string>
 #include <vector>
 #include <optional>
@@ -35,6 +36,15 @@ constexpr char PREFIX_CHAINSTATE = 'c';      // chainstate metadata
 constexpr char PREFIX_PEER = 'p';            // peer_id -> PeerInfo
 constexpr char PREFIX_BLOCK_INDEX = 'x';     // block_hash -> BlockIndex
 constexpr char PREFIX_SPENT_OUTPUTS = 's';   // block_hash -> [SpentOutput]
+constexpr char PREFIX_DB_VERSION = 'V';      // storage format version
+
+/// Storage formats for block, transaction, UTXO and undo records
+constexpr uint32_t STORAGE_VERSION_LEGACY = 1;   // fixed-width (wire) encoding
+constexpr uint32_t STORAGE_VERSION_COMPACT = 2;  // VarInts, compressed amounts/scripts (compressor.h)
+
+/// Units of the cumulative chain work in ChainState
+constexpr uint32_t CHAIN_WORK_VERSION_ESTIMATE = 0;  // per-block exponent heuristic
+constexpr uint32_t CHAIN_WORK_VERSION_EXACT = 1;     // sum of 2^256 / (target + 1)
 
 } // namespace db
 
@@ -61,6 +71,41 @@ struct ChainState {
     /// Total supply
     uint64_t total_supply;
 
+    /// Units of chain_work (db::CHAIN_WORK_VERSION_*). Records written
+    /// before this field existed hold the estimate.
+    uint32_t chain_work_version = db::CHAIN_WORK_VERSION_EXACT;
+
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint256(s, best_block_hash);
+        SerializeUint64(s, best_height);
+        SerializeUint256(s, chain_work);
+        SerializeUint64(s, total_transactions);
+        SerializeUint64(s, utxo_count);
+        SerializeUint64(s, total_supply);
+        SerializeUint32(s, chain_work_version);
+    }
+
+    /// Deserialize from a stream
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        if (!UnserializeUint256(s, best_block_hash) ||
+            !UnserializeUint64(s, best_height) ||
+            !UnserializeUint256(s, chain_work) ||
+            !UnserializeUint64(s, total_transactions) ||
+            !UnserializeUint64(s, utxo_count) ||
+            !UnserializeUint64(s, total_supply)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for chain state");
+        }
+        if (s.Remaining() == 0) {
+            chain_work_version = db::CHAIN_WORK_VERSION_ESTIMATE;
+        } else if (!UnserializeUint32(s, chain_work_version)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for chain work version");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize
     std::vector<uint8_t> Serialize() const;
 
@@ -100,6 +145,37 @@ struct BlockIndex {
     /// File position (for pruning)
     uint64_t file_pos;
 
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint256(s, hash);
+        SerializeUint64(s, height);
+        SerializeUint256(s, prev_hash);
+        SerializeUint64(s, timestamp);
+        SerializeUint32(s, bits);
+        SerializeUint256(s, chain_work);
+        SerializeUint32(s, tx_count);
+        SerializeUint32(s, size);
+        SerializeUint64(s, file_pos);
+    }
+
+    /// Deserialize from a stream
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        if (!UnserializeUint256(s, hash) ||
+            !UnserializeUint64(s, height) ||
+            !UnserializeUint256(s, prev_hash) ||
+            !UnserializeUint64(s, timestamp) ||
+            !UnserializeUint32(s, bits) ||
+            !UnserializeUint256(s, chain_work) ||
+            !UnserializeUint32(s, tx_count) ||
+            !UnserializeUint32(s, size) ||
+            !UnserializeUint64(s, file_pos)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for block index");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize
     std::vector<uint8_t> Serialize() const;
 
@@ -118,6 +194,27 @@ struct SpentOutput {
     /// The output that was spent
     TxOut output;
 
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        outpoint.Serialize(s);
+        output.Serialize(s);
+    }
+
+    /// Deserialize from a stream
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        auto outpoint_result = outpoint.Unserialize(s);
+        if (outpoint_result.IsError()) {
+            return Result<void>::Error("Failed to deserialize outpoint: " + outpoint_result.error);
+        }
+        auto output_result = output.Unserialize(s);
+        if (output_result.IsError()) {
+            return Result<void>::Error("Failed to deserialize output: " + output_result.error);
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize
     std::vector<uint8_t> Serialize() const;
 
@@ -217,6 +314,10 @@ public:
     /// Get data directory path
     std::string GetDataDir() const;
 
+    /// Get record format in use (db::STORAGE_VERSION_*). New databases are
+    /// compact; databases created before versioning stay legacy until rebuilt.
+    uint32_t GetStorageVersion() const;
+
     // ------------------------------------------------------------------------
     // Block Operations
     // ------------------------------------------------------------------------
@@ -541,6 +642,9 @@ public:
     /// Get total fees
     uint64_t GetTotalFees() const;
 
+    /// Get feerate histogram (maintained on every add and remove)
+    FeeHistogram GetFeeHistogram() const;
+
     /// Clear mempool
     void Clear();
 
@@ -8,8 +8,12 @@
 
 #include "types.h"
 #include "script.h"
-#include <vector>
+#include "serialize.h"
+#include <memory_resource>
 #include <optional>
+#include <span>
+#include <string>
+#include <vector>
 
 namespace intcoin {
 
@@ -71,6 +75,38 @@ struct TxIn {
     /// Default constructor
     TxIn() : prev_tx_index(0), sequence(0xFFFFFFFF) {}
 
+    /// Serialize to a stream (VectorWriter, HashWriter, ...)
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint256(s, prev_tx_hash);
+        SerializeUint32(s, prev_tx_index);
+        SerializeUint64(s, script_sig.GetSize());
+        SerializeBytes(s, script_sig.bytes.data(), script_sig.bytes.size());
+        SerializeUint32(s, sequence);
+    }
+
+    /// Deserialize from a stream (SpanReader, ...)
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        if (!UnserializeUint256(s, prev_tx_hash)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for prev_tx_hash");
+        }
+        if (!UnserializeUint32(s, prev_tx_index)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for prev_tx_index");
+        }
+        uint64_t script_len = 0;
+        if (!UnserializeUint64(s, script_len)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for script_sig length");
+        }
+        if (!UnserializeByteVector(s, script_sig.bytes, script_len)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for script_sig");
+        }
+        if (!UnserializeUint32(s, sequence)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for sequence");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize to bytes
     std::vector<uint8_t> Serialize() const;
 
@@ -98,6 +134,30 @@ struct TxOut {
     /// Constructor with value and script
     TxOut(uint64_t val, Script script) : value(val), script_pubkey(std::move(script)) {}
 
+    /// Serialize to a stream (VectorWriter, HashWriter, ...)
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint64(s, value);
+        SerializeUint64(s, script_pubkey.GetSize());
+        SerializeBytes(s, script_pubkey.bytes.data(), script_pubkey.bytes.size());
+    }
+
+    /// Deserialize from a stream (SpanReader, ...)
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        if (!UnserializeUint64(s, value)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for value");
+        }
+        uint64_t script_len = 0;
+        if (!UnserializeUint64(s, script_len)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for script_pubkey length");
+        }
+        if (!UnserializeByteVector(s, script_pubkey.bytes, script_len)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for script_pubkey");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize to bytes
     std::vector<uint8_t> Serialize() const;
 
@@ -131,6 +191,28 @@ struct OutPoint {
     /// Less-than comparison (for ordering)
     bool operator<(const OutPoint& other) const;
 
+    /// Serialized size (fixed)
+    static constexpr size_t SERIALIZED_SIZE = 32 + 4;
+
+    /// Serialize to a stream
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint256(s, tx_hash);
+        SerializeUint32(s, index);
+    }
+
+    /// Deserialize from a stream
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        if (!UnserializeUint256(s, tx_hash)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for tx_hash");
+        }
+        if (!UnserializeUint32(s, index)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for index");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize to bytes
     std::vector<uint8_t> Serialize() const;
 
@@ -155,6 +237,44 @@ enum class TxType : uint8_t {
     CONTRACT_CALL = 3       // Smart contract call
 };
 
+// ============================================================================
+// Precomputed Signature Hash Data
+// ============================================================================
+
+class Transaction;
+
+/// Per-transaction data shared by every input's signature hash.
+/// Each sighash commits to all inputs (script_sig cleared) and all outputs;
+/// serializing them once here makes signing or verifying an N-input
+/// transaction O(N) in serialization work instead of O(N^2). Digests are
+/// identical to those computed without it. Filling in script_sigs after
+/// construction is fine; any other change to the transaction requires Init().
+struct PrecomputedTxData {
+    /// Serialized size of an input with an empty script_sig
+    static constexpr size_t CLEARED_INPUT_SIZE = 32 + 4 + 8 + 4;
+
+    /// All inputs, script_sig cleared, back to back
+    std::vector<uint8_t> cleared_inputs;
+
+    /// All outputs, serialized back to back
+    std::vector<uint8_t> outputs;
+
+    /// Start of each output in outputs (plus one past the end)
+    std::vector<size_t> output_offsets;
+
+    /// Default constructor (empty; call Init before use)
+    PrecomputedTxData() = default;
+
+    /// Precompute for a transaction
+    explicit PrecomputedTxData(const Transaction& tx) { Init(tx); }
+
+    /// (Re)compute for a transaction
+    void Init(const Transaction& tx);
+
+    /// Check that this data was computed for tx's input/output layout
+    bool Matches(const Transaction& tx) const;
+};
+
 // ============================================================================
 // Transaction
 // ============================================================================
@@ -194,6 +314,11 @@ public:
     /// @param prev_scriptpubkey Previous output's script_pubkey (required for proper signing)
     uint256 GetHashForSigning(uint8_t sighash_type, size_t input_index, const Script& prev_scriptpubkey) const;
 
+    /// Calculate signature hash using data precomputed once for this transaction
+    /// (use when hashing several inputs of the same transaction)
+    uint256 GetHashForSigning(uint8_t sighash_type, size_t input_index, const Script& prev_scriptpubkey,
+                              const PrecomputedTxData& txdata) const;
+
     /// Sign transaction with private key (default: SIGHASH_ALL)
     /// @param secret_key Secret key to sign with
     /// @param sighash_type SIGHASH type
@@ -235,6 +360,65 @@ public:
     /// Verify transaction against UTXO set
     Result<void> VerifyAgainstUTXO(const class UTXOSet& utxo_set) const;
 
+    /// Serialize to a stream (VectorWriter, HashWriter, ...)
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        SerializeUint32(s, version);
+        SerializeUint64(s, inputs.size());
+        for (const auto& input : inputs) {
+            input.Serialize(s);
+        }
+        SerializeUint64(s, outputs.size());
+        for (const auto& output : outputs) {
+            output.Serialize(s);
+        }
+        SerializeUint64(s, locktime);
+        SerializeBytes(s, signature.data(), signature.size());
+    }
+
+    /// Deserialize from a stream (SpanReader, ...)
+    template <typename Stream>
+    Result<void> Unserialize(Stream& s) {
+        cached_hash_.reset();
+        if (!UnserializeUint32(s, version)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for version");
+        }
+
+        uint64_t inputs_count = 0;
+        if (!UnserializeUint64(s, inputs_count)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for inputs count");
+        }
+        inputs.clear();
+        inputs.reserve(BoundedReserve(s, inputs_count, MIN_TXIN_SIZE));
+        for (uint64_t i = 0; i < inputs_count; ++i) {
+            auto result = inputs.emplace_back().Unserialize(s);
+            if (result.IsError()) {
+                return Result<void>::Error("Failed to deserialize input " + std::to_string(i) + ": " + result.error);
+            }
+        }
+
+        uint64_t outputs_count = 0;
+        if (!UnserializeUint64(s, outputs_count)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for outputs count");
+        }
+        outputs.clear();
+        outputs.reserve(BoundedReserve(s, outputs_count, MIN_TXOUT_SIZE));
+        for (uint64_t i = 0; i < outputs_count; ++i) {
+            auto result = outputs.emplace_back().Unserialize(s);
+            if (result.IsError()) {
+                return Result<void>::Error("Failed to deserialize output " + std::to_string(i) + ": " + result.error);
+            }
+        }
+
+        if (!UnserializeUint64(s, locktime)) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for locktime");
+        }
+        if (!UnserializeBytes(s, signature.data(), signature.size())) {
+            return Result<void>::Error("Buffer underflow: not enough bytes for signature");
+        }
+        return Result<void>::Ok();
+    }
+
     /// Serialize to bytes
     std::vector<uint8_t> Serialize() const;
 
@@ -244,7 +428,87 @@ public:
     /// Get serialized size
     size_t GetSerializedSize() const;
 
+    /// Smallest serialized input (empty script_sig) and output (empty script_pubkey)
+    static constexpr size_t MIN_TXIN_SIZE = 32 + 4 + 8 + 4;
+    static constexpr size_t MIN_TXOUT_SIZE = 8 + 8;
+
+    /// Smallest serialized transaction (no inputs or outputs)
+    static constexpr size_t MIN_SERIALIZED_SIZE = 4 + 8 + 8 + 8 + DILITHIUM3_BYTES;
+
+private:
+    friend class TransactionView;
+
+    mutable std::optional<uint256> cached_hash_;
+};
+
+// ============================================================================
+// Transaction Views (transient decoding)
+// ============================================================================
+//
+// Decoding a Transaction allocates the input and output arrays and every
+// script separately. Data that only lives through validation (a block or tx
+// message checked before it is accepted) can be decoded into the views
+// below instead. Scripts and the signature point into the serialized buffer,
+// and the input/output arrays come from a caller-supplied
+// std::pmr::memory_resource, normally a monotonic arena scoped to one
+// message. A view is valid while both the buffer and the resource are.
+// ToTransaction() builds the owning type for anything that is kept.
+
+/// Transaction input whose script_sig points into the serialized buffer
+struct TxInView {
+    uint256 prev_tx_hash{};
+    uint32_t prev_tx_index = 0;
+    std::span<const uint8_t> script_sig;
+    uint32_t sequence = 0xFFFFFFFF;
+
+    /// Decode in place (same wire format as TxIn)
+    Result<void> Unserialize(SpanReader& s);
+
+    /// Owning copy
+    TxIn ToTxIn() const;
+};
+
+/// Transaction output whose script_pubkey points into the serialized buffer
+struct TxOutView {
+    uint64_t value = 0;
+    std::span<const uint8_t> script_pubkey;
+
+    /// Decode in place (same wire format as TxOut)
+    Result<void> Unserialize(SpanReader& s);
+
+    /// Owning copy
+    TxOut ToTxOut() const;
+};
+
+class TransactionView {
+public:
+    uint32_t version = 1;
+    std::pmr::vector<TxInView> inputs;
+    std::pmr::vector<TxOutView> outputs;
+    uint64_t locktime = 0;
+    std::span<const uint8_t> signature;
+
+    /// Arrays are allocated from resource
+    explicit TransactionView(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : inputs(resource), outputs(resource) {}
+
+    /// Decode in place (same wire format as Transaction)
+    Result<void> Unserialize(SpanReader& s);
+
+    /// The transaction's serialized bytes, in place
+    std::span<const uint8_t> GetSerialized() const { return serialized_; }
+
+    /// Transaction hash (txid), hashed straight from the serialized bytes
+    uint256 GetHash() const;
+
+    /// Check if this is a coinbase transaction
+    bool IsCoinbase() const;
+
+    /// Owning copy; its txid is carried over rather than recomputed
+    Transaction ToTransaction() const;
+
 private:
+    std::span<const uint8_t> serialized_;
     mutable std::optional<uint256> cached_hash_;
 };
 
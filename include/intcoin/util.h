@@ -7,6 +7,7 @@
 #define INTCOIN_UTIL_H
 
 #include "types.h"
+#include <span>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -19,8 +20,8 @@ namespace intcoin {
 // String Utilities
 // ============================================================================
 
-/// Convert bytes to hex string
-std::string BytesToHex(const std::vector<uint8_t>& bytes);
+/// Convert bytes to hex string (vectors, hashes and arrays alike)
+std::string BytesToHex(std::span<const uint8_t> bytes);
 
 /// Convert hex string to bytes
 Result<std::vector<uint8_t>> HexToBytes(const std::string& hex);
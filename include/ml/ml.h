@@ -9,6 +9,7 @@
 #include "../intcoin/transaction.h"
 #include "../intcoin/block.h"
 #include "../intcoin/network.h"
+#include "../intcoin/fee_histogram.h"
 #include <vector>
 #include <memory>
 #include <map>
@@ -215,6 +216,11 @@ public:
         const std::vector<Transaction>& mempool_txs,
         size_t tx_size_bytes);
 
+    // Same, from the mempool's feerate histogram (O(buckets))
+    Result<FeeRecommendation> EstimateFromMempool(
+        const FeeHistogram& histogram,
+        size_t tx_size_bytes);
+
 private:
     class Impl;
     std::unique_ptr<Impl> impl_;
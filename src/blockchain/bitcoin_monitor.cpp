@@ -10,6 +10,7 @@
 #include <intcoin/blockchain_monitor.h>
 #include <intcoin/crypto.h>
 #include <intcoin/util.h>
+#include <intcoin/codec.h>
 
 #include <curl/curl.h>
 #include <json/json.h>
@@ -19,7 +20,7 @@
 #include <mutex>
 #include <atomic>
 #include <sstream>
-#include <iomanip>
+#include <stdexcept>
 
 // Windows defines ERROR as a macro - undefine it to avoid conflicts with LogLevel::ERROR
 #ifdef ERROR
@@ -29,22 +30,11 @@
 namespace intcoin {
 namespace blockchain_monitor {
 
-// Helper: Convert bytes to hex string
-static std::string BytesToHex(const std::vector<uint8_t>& bytes) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (uint8_t byte : bytes) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    return oss.str();
-}
-
 // Helper: Convert hex string to bytes
 static std::vector<uint8_t> HexToBytes(const std::string& hex) {
     std::vector<uint8_t> bytes;
-    for (size_t i = 0; i < hex.length(); i += 2) {
-        std::string byte_str = hex.substr(i, 2);
-        bytes.push_back(static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16)));
+    if (!codec::DecodeHex(hex, bytes)) {
+        throw std::invalid_argument("Invalid hex string");
     }
     return bytes;
 }
@@ -225,7 +215,7 @@ struct BitcoinMonitor::Impl {
         std::lock_guard<std::mutex> lock(watched_htlcs_mutex);
         for (const auto& watched : watched_htlcs) {
             // Simple pattern matching - look for payment hash in script
-            std::string hash_hex = BytesToHex(watched.payment_hash);
+            std::string hash_hex = codec::EncodeHex(watched.payment_hash);
             if (script_hex.find(hash_hex) != std::string::npos) {
                 // Found matching HTLC!
                 NotifyHTLCDetected(txid, output_index, script, watched.payment_hash,
@@ -380,7 +370,7 @@ Result<void> BitcoinMonitor::WatchForHTLC(
     impl_->watched_htlcs.push_back(watched);
 
     LogF(LogLevel::INFO, "Now watching for Bitcoin HTLC with payment hash: %s",
-         BytesToHex(payment_hash).c_str());
+         codec::EncodeHex(payment_hash).c_str());
 
     return Result<void>::Ok();
 }
@@ -405,7 +395,7 @@ Result<HTLCTransaction> BitcoinMonitor::GetHTLCTransaction(
     const uint256& tx_hash,
     uint32_t output_index) {
 
-    std::string txid = BytesToHex(std::vector<uint8_t>(tx_hash.begin(), tx_hash.end()));
+    std::string txid = codec::EncodeHex(tx_hash);
 
     auto tx_result = impl_->GetRawTransaction(txid);
     if (tx_result.IsError()) {
@@ -439,7 +429,7 @@ Result<HTLCTransaction> BitcoinMonitor::GetHTLCTransaction(
 }
 
 Result<uint32_t> BitcoinMonitor::GetConfirmations(const uint256& tx_hash) {
-    std::string txid = BytesToHex(std::vector<uint8_t>(tx_hash.begin(), tx_hash.end()));
+    std::string txid = codec::EncodeHex(tx_hash);
 
     auto tx_result = impl_->GetRawTransaction(txid);
     if (tx_result.IsError()) {
@@ -470,7 +460,7 @@ Result<bool> BitcoinMonitor::IsHTLCSpent(
     const uint256& htlc_tx_hash,
     uint32_t htlc_output_index) {
 
-    std::string txid = BytesToHex(std::vector<uint8_t>(htlc_tx_hash.begin(), htlc_tx_hash.end()));
+    std::string txid = codec::EncodeHex(htlc_tx_hash);
 
     Json::Value params(Json::arrayValue);
     params.append(txid);
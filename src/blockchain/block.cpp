@@ -8,7 +8,9 @@
 #include "intcoin/crypto.h"
 #include "intcoin/util.h"
 #include "intcoin/consensus.h"
+#include "intcoin/ibd/parallel_validation.h"
 #include <algorithm>
+#include <cstring>
 
 namespace intcoin {
 
@@ -17,88 +19,31 @@ namespace intcoin {
 // ============================================================================
 
 uint256 BlockHeader::GetHash() const {
-    auto serialized = Serialize();
-    return SHA3::Hash(serialized);
+    HashWriter writer;
+    Serialize(writer);
+    return writer.GetHash();
 }
 
 std::vector<uint8_t> BlockHeader::Serialize() const {
     std::vector<uint8_t> result;
-    SerializeUint32(result, version);
-    SerializeUint256(result, prev_block_hash);
-    SerializeUint256(result, merkle_root);
-    SerializeUint64(result, timestamp);
-    SerializeUint32(result, bits);
-    SerializeUint64(result, nonce);
-    SerializeUint256(result, randomx_hash);
-    SerializeUint256(result, randomx_key);
+    result.reserve(GetSerializedSize());
+    VectorWriter writer(result);
+    Serialize(writer);
     return result;
 }
 
 Result<BlockHeader> BlockHeader::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
+    SpanReader reader(data);
     BlockHeader header;
-
-    // Deserialize version (4 bytes)
-    auto version_result = DeserializeUint32(data, pos);
-    if (version_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize version: " + version_result.error);
-    }
-    header.version = version_result.GetValue();
-
-    // Deserialize prev_block_hash (32 bytes)
-    auto prev_hash_result = DeserializeUint256(data, pos);
-    if (prev_hash_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize prev_block_hash: " + prev_hash_result.error);
-    }
-    header.prev_block_hash = *prev_hash_result.value;
-
-    // Deserialize merkle_root (32 bytes)
-    auto merkle_result = DeserializeUint256(data, pos);
-    if (merkle_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize merkle_root: " + merkle_result.error);
-    }
-    header.merkle_root = *merkle_result.value;
-
-    // Deserialize timestamp (8 bytes)
-    auto timestamp_result = DeserializeUint64(data, pos);
-    if (timestamp_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize timestamp: " + timestamp_result.error);
-    }
-    header.timestamp = *timestamp_result.value;
-
-    // Deserialize bits (4 bytes)
-    auto bits_result = DeserializeUint32(data, pos);
-    if (bits_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize bits: " + bits_result.error);
-    }
-    header.bits = *bits_result.value;
-
-    // Deserialize nonce (8 bytes)
-    auto nonce_result = DeserializeUint64(data, pos);
-    if (nonce_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize nonce: " + nonce_result.error);
-    }
-    header.nonce = *nonce_result.value;
-
-    // Deserialize randomx_hash (32 bytes)
-    auto randomx_hash_result = DeserializeUint256(data, pos);
-    if (randomx_hash_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize randomx_hash: " + randomx_hash_result.error);
-    }
-    header.randomx_hash = *randomx_hash_result.value;
-
-    // Deserialize randomx_key (32 bytes)
-    auto randomx_key_result = DeserializeUint256(data, pos);
-    if (randomx_key_result.IsError()) {
-        return Result<BlockHeader>::Error("Failed to deserialize randomx_key: " + randomx_key_result.error);
+    auto result = header.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<BlockHeader>::Error(result.error);
     }
-    header.randomx_key = *randomx_key_result.value;
-
     return Result<BlockHeader>::Ok(std::move(header));
 }
 
 size_t BlockHeader::GetSerializedSize() const {
-    return 4 + 32 + 32 + 8 + 4 + 8 + 32 + 32; // 152 bytes
+    return SERIALIZED_SIZE; // 152 bytes
 }
 
 // ============================================================================
@@ -126,12 +71,36 @@ uint256 Block::CalculateMerkleRoot() const {
         return uint256();
     }
 
+    return intcoin::CalculateMerkleRoot(GetTransactionHashes());
+}
+
+std::vector<uint256> Block::GetTransactionHashes() const {
+    // One spare slot: an odd merkle level duplicates its last hash in place
     std::vector<uint256> tx_hashes;
-    for (const auto& tx : transactions) {
-        tx_hashes.push_back(tx.GetHash());
+    tx_hashes.reserve(transactions.size() + 1);
+    tx_hashes.resize(transactions.size());
+
+    // Serializing each transaction (signatures included) dominates merkle
+    // root computation, so large blocks spread it over the shared pool
+    if (transactions.size() >= PARALLEL_HASH_THRESHOLD) {
+        ibd::GetSharedThreadPool().ParallelFor(transactions.size(), [&](size_t i) {
+            tx_hashes[i] = transactions[i].GetHash();
+        });
+    } else {
+        for (size_t i = 0; i < transactions.size(); i++) {
+            tx_hashes[i] = transactions[i].GetHash();
+        }
     }
 
-    return intcoin::CalculateMerkleRoot(tx_hashes);
+    return tx_hashes;
+}
+
+std::vector<uint256> Block::GetMerkleBranch(size_t index) const {
+    if (index >= transactions.size()) {
+        return {};
+    }
+
+    return intcoin::GetMerkleBranch(GetTransactionHashes(), index);
 }
 
 Result<void> Block::Verify(const Blockchain& chain) const {
@@ -188,175 +157,100 @@ bool Block::IsGenesis() const {
 }
 
 std::vector<uint8_t> Block::Serialize() const {
+    // One allocation for the whole block (size is computed up front)
     std::vector<uint8_t> result;
-
-    // Serialize header
-    auto header_bytes = header.Serialize();
-    result.insert(result.end(), header_bytes.begin(), header_bytes.end());
-
-    // Serialize transaction count
-    SerializeUint64(result, transactions.size());
-
-    // Serialize transactions
-    for (const auto& tx : transactions) {
-        auto tx_bytes = tx.Serialize();
-        result.insert(result.end(), tx_bytes.begin(), tx_bytes.end());
-    }
-
+    result.reserve(GetSerializedSize());
+    VectorWriter writer(result);
+    Serialize(writer);
     return result;
 }
 
 Result<Block> Block::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
+    SpanReader reader(data);
     Block block;
+    auto result = block.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<Block>::Error(result.error);
+    }
+    return Result<Block>::Ok(std::move(block));
+}
 
-    // Deserialize header (152 bytes)
-    if (data.size() < 152) {
-        return Result<Block>::Error("Buffer underflow: not enough bytes for block header");
+size_t Block::GetSerializedSize() const {
+    size_t size = header.GetSerializedSize() + 8; // header + tx count
+    for (const auto& tx : transactions) {
+        size += tx.GetSerializedSize();
     }
-    std::vector<uint8_t> header_bytes(data.begin(), data.begin() + 152);
-    auto header_result = BlockHeader::Deserialize(header_bytes);
+    return size;
+}
+
+// ============================================================================
+// BlockView Implementation
+// ============================================================================
+
+Result<void> BlockView::Unserialize(SpanReader& s) {
+    auto header_result = header.Unserialize(s);
     if (header_result.IsError()) {
-        return Result<Block>::Error("Failed to deserialize block header: " + header_result.error);
+        return header_result;
     }
-    block.header = *header_result.value;
-    pos += 152;
 
-    // Deserialize transaction count (8 bytes)
-    auto tx_count_result = DeserializeUint64(data, pos);
-    if (tx_count_result.IsError()) {
-        return Result<Block>::Error("Failed to deserialize transaction count: " + tx_count_result.error);
+    uint64_t tx_count = 0;
+    if (!UnserializeUint64(s, tx_count)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for transaction count");
     }
-    uint64_t tx_count = *tx_count_result.value;
-
-    // Deserialize each transaction
-    block.transactions.reserve(tx_count);
+    std::pmr::memory_resource* resource = transactions.get_allocator().resource();
+    transactions.clear();
+    transactions.reserve(BoundedReserve(s, tx_count, Transaction::MIN_SERIALIZED_SIZE));
     for (uint64_t i = 0; i < tx_count; ++i) {
-        // For each transaction, we need to deserialize it inline
-        // because we don't know the size beforehand
-        Transaction tx;
-
-        // Deserialize version (4 bytes)
-        auto version_result = DeserializeUint32(data, pos);
-        if (version_result.IsError()) {
-            return Result<Block>::Error("Failed to deserialize transaction " + std::to_string(i) + " version: " + version_result.error);
-        }
-        tx.version = *version_result.value;
-
-        // Deserialize inputs count (8 bytes)
-        auto inputs_count_result = DeserializeUint64(data, pos);
-        if (inputs_count_result.IsError()) {
-            return Result<Block>::Error("Failed to deserialize transaction " + std::to_string(i) + " inputs count: " + inputs_count_result.error);
-        }
-        uint64_t inputs_count = *inputs_count_result.value;
-
-        // Deserialize each input
-        tx.inputs.reserve(inputs_count);
-        for (uint64_t j = 0; j < inputs_count; ++j) {
-            TxIn txin;
-
-            // Deserialize prev_tx_hash (32 bytes)
-            auto hash_result = DeserializeUint256(data, pos);
-            if (hash_result.IsError()) {
-                return Result<Block>::Error("Failed to deserialize tx " + std::to_string(i) + " input " + std::to_string(j) + " prev_tx_hash: " + hash_result.error);
-            }
-            txin.prev_tx_hash = *hash_result.value;
-
-            // Deserialize prev_tx_index (4 bytes)
-            auto index_result = DeserializeUint32(data, pos);
-            if (index_result.IsError()) {
-                return Result<Block>::Error("Failed to deserialize tx " + std::to_string(i) + " input " + std::to_string(j) + " prev_tx_index: " + index_result.error);
-            }
-            txin.prev_tx_index = *index_result.value;
-
-            // Deserialize script_sig length (8 bytes)
-            auto script_len_result = DeserializeUint64(data, pos);
-            if (script_len_result.IsError()) {
-                return Result<Block>::Error("Failed to deserialize tx " + std::to_string(i) + " input " + std::to_string(j) + " script_sig length: " + script_len_result.error);
-            }
-            uint64_t script_len = *script_len_result.value;
-
-            // Deserialize script_sig bytes
-            if (pos + script_len > data.size()) {
-                return Result<Block>::Error("Buffer underflow: not enough bytes for tx " + std::to_string(i) + " input " + std::to_string(j) + " script_sig");
-            }
-            std::vector<uint8_t> script_bytes(data.begin() + pos, data.begin() + pos + script_len);
-            txin.script_sig = Script::Deserialize(script_bytes);
-            pos += script_len;
-
-            // Deserialize sequence (4 bytes)
-            auto seq_result = DeserializeUint32(data, pos);
-            if (seq_result.IsError()) {
-                return Result<Block>::Error("Failed to deserialize tx " + std::to_string(i) + " input " + std::to_string(j) + " sequence: " + seq_result.error);
-            }
-            txin.sequence = *seq_result.value;
-
-            tx.inputs.push_back(std::move(txin));
-        }
-
-        // Deserialize outputs count (8 bytes)
-        auto outputs_count_result = DeserializeUint64(data, pos);
-        if (outputs_count_result.IsError()) {
-            return Result<Block>::Error("Failed to deserialize transaction " + std::to_string(i) + " outputs count: " + outputs_count_result.error);
-        }
-        uint64_t outputs_count = *outputs_count_result.value;
-
-        // Deserialize each output
-        tx.outputs.reserve(outputs_count);
-        for (uint64_t j = 0; j < outputs_count; ++j) {
-            TxOut txout;
-
-            // Deserialize value (8 bytes)
-            auto value_result = DeserializeUint64(data, pos);
-            if (value_result.IsError()) {
-                return Result<Block>::Error("Failed to deserialize tx " + std::to_string(i) + " output " + std::to_string(j) + " value: " + value_result.error);
-            }
-            txout.value = *value_result.value;
-
-            // Deserialize script_pubkey length (8 bytes)
-            auto script_len_result = DeserializeUint64(data, pos);
-            if (script_len_result.IsError()) {
-                return Result<Block>::Error("Failed to deserialize tx " + std::to_string(i) + " output " + std::to_string(j) + " script_pubkey length: " + script_len_result.error);
-            }
-            uint64_t script_len = *script_len_result.value;
-
-            // Deserialize script_pubkey bytes
-            if (pos + script_len > data.size()) {
-                return Result<Block>::Error("Buffer underflow: not enough bytes for tx " + std::to_string(i) + " output " + std::to_string(j) + " script_pubkey");
-            }
-            std::vector<uint8_t> script_bytes(data.begin() + pos, data.begin() + pos + script_len);
-            txout.script_pubkey = Script::Deserialize(script_bytes);
-            pos += script_len;
-
-            tx.outputs.push_back(std::move(txout));
+        auto result = transactions.emplace_back(resource).Unserialize(s);
+        if (result.IsError()) {
+            return Result<void>::Error("Failed to deserialize transaction " + std::to_string(i) + ": " + result.error);
         }
+    }
+    return Result<void>::Ok();
+}
 
-        // Deserialize locktime (8 bytes)
-        auto locktime_result = DeserializeUint64(data, pos);
-        if (locktime_result.IsError()) {
-            return Result<Block>::Error("Failed to deserialize transaction " + std::to_string(i) + " locktime: " + locktime_result.error);
+std::vector<uint256> BlockView::GetTransactionHashes() const {
+    // One spare slot for CalculateMerkleRoot's in-place levels
+    std::vector<uint256> tx_hashes;
+    tx_hashes.reserve(transactions.size() + 1);
+    tx_hashes.resize(transactions.size());
+
+    if (transactions.size() >= Block::PARALLEL_HASH_THRESHOLD) {
+        ibd::GetSharedThreadPool().ParallelFor(transactions.size(), [&](size_t i) {
+            tx_hashes[i] = transactions[i].GetHash();
+        });
+    } else {
+        for (size_t i = 0; i < transactions.size(); i++) {
+            tx_hashes[i] = transactions[i].GetHash();
         }
-        tx.locktime = *locktime_result.value;
+    }
 
-        // Deserialize signature (DILITHIUM3_BYTES = 3293 bytes)
-        if (pos + DILITHIUM3_BYTES > data.size()) {
-            return Result<Block>::Error("Buffer underflow: not enough bytes for transaction " + std::to_string(i) + " signature");
-        }
-        std::copy(data.begin() + pos, data.begin() + pos + DILITHIUM3_BYTES, tx.signature.begin());
-        pos += DILITHIUM3_BYTES;
+    return tx_hashes;
+}
 
-        block.transactions.push_back(std::move(tx));
+uint256 BlockView::CalculateMerkleRoot() const {
+    if (transactions.empty()) {
+        return uint256();
     }
 
-    return Result<Block>::Ok(std::move(block));
+    return intcoin::CalculateMerkleRoot(GetTransactionHashes());
 }
 
-size_t Block::GetSerializedSize() const {
-    size_t size = header.GetSerializedSize() + 8; // header + tx count
+Block BlockView::ToBlock() const {
+    Block block;
+    block.header = header;
+    block.transactions.reserve(transactions.size());
     for (const auto& tx : transactions) {
-        size += tx.GetSerializedSize();
+        block.transactions.push_back(tx.ToTransaction());
     }
-    return size;
+    return block;
+}
+
+size_t BlockView::ArenaSizeHint(size_t serialized_size) {
+    // Every transaction carries a full Dilithium signature, so the views
+    // (one TransactionView plus a few input/output views per transaction)
+    // come to well under a tenth of the serialized size
+    return serialized_size / 8 + 4096;
 }
 
 // ============================================================================
@@ -455,32 +349,47 @@ Result<void> ValidateProofOfWork(const BlockHeader& header) {
 // Merkle Tree
 // ============================================================================
 
+namespace {
+
+/// Hash two adjacent tree nodes (left || right)
+uint256 HashMerklePair(const uint256& left, const uint256& right) {
+    uint8_t combined[64];
+    std::memcpy(combined, left.data(), 32);
+    std::memcpy(combined + 32, right.data(), 32);
+    return SHA3::Hash(combined, sizeof(combined));
+}
+
+/// Hash a level's adjacent pairs in one batch: out[i] = H(level[2i] || level[2i+1])
+void HashMerkleLevel(const uint256* level, size_t pairs, uint256* out) {
+    SHA3::HashBatch(reinterpret_cast<const uint8_t*>(level), 64, pairs, out);
+}
+
+} // namespace
+
 uint256 CalculateMerkleRoot(const std::vector<uint256>& tx_hashes) {
+    std::vector<uint256> hashes;
+    hashes.reserve(tx_hashes.size() + 1);
+    hashes.assign(tx_hashes.begin(), tx_hashes.end());
+    return CalculateMerkleRoot(std::move(hashes));
+}
+
+uint256 CalculateMerkleRoot(std::vector<uint256>&& tx_hashes) {
     if (tx_hashes.empty()) {
         return uint256();
     }
 
-    std::vector<uint256> hashes = tx_hashes;
-
-    // Build merkle tree bottom-up
+    // Build merkle tree bottom-up, one batched hash call per level; each
+    // level overwrites the front of the one below it
+    std::vector<uint256>& hashes = tx_hashes;
     while (hashes.size() > 1) {
-        std::vector<uint256> next_level;
-
-        for (size_t i = 0; i < hashes.size(); i += 2) {
-            std::vector<uint8_t> combined;
-            SerializeUint256(combined, hashes[i]);
-
-            // If odd number, duplicate last hash
-            if (i + 1 < hashes.size()) {
-                SerializeUint256(combined, hashes[i + 1]);
-            } else {
-                SerializeUint256(combined, hashes[i]);
-            }
-
-            next_level.push_back(SHA3::Hash(combined));
+        // If odd number, duplicate last hash
+        if (hashes.size() % 2 != 0) {
+            hashes.push_back(hashes.back());
         }
 
-        hashes = std::move(next_level);
+        size_t pairs = hashes.size() / 2;
+        HashMerkleLevel(hashes.data(), pairs, hashes.data());
+        hashes.resize(pairs);
     }
 
     return hashes[0];
@@ -493,22 +402,24 @@ std::vector<uint256> BuildMerkleTree(const std::vector<uint256>& tx_hashes) {
 
     // Build complete merkle tree
     std::vector<uint256> tree = tx_hashes;
+    tree.reserve(tx_hashes.size() * 2 + 64);
     size_t level_offset = 0;
     size_t level_size = tx_hashes.size();
 
     // Build tree bottom-up
     while (level_size > 1) {
+        size_t pairs = level_size / 2;
         size_t next_level_size = (level_size + 1) / 2;
 
-        for (size_t i = 0; i < next_level_size; i++) {
-            size_t left_idx = level_offset + i * 2;
-            size_t right_idx = std::min(left_idx + 1, level_offset + level_size - 1);
+        tree.resize(level_offset + level_size + next_level_size);
+        const uint256* level = tree.data() + level_offset;
+        uint256* next_level = tree.data() + level_offset + level_size;
 
-            std::vector<uint8_t> combined;
-            SerializeUint256(combined, tree[left_idx]);
-            SerializeUint256(combined, tree[right_idx]);
+        HashMerkleLevel(level, pairs, next_level);
 
-            tree.push_back(SHA3::Hash(combined));
+        // If odd number, the last node is paired with itself
+        if (level_size % 2 != 0) {
+            next_level[pairs] = HashMerklePair(level[level_size - 1], level[level_size - 1]);
         }
 
         level_offset += level_size;
@@ -524,33 +435,34 @@ std::vector<uint256> GetMerkleBranch(const std::vector<uint256>& tx_hashes,
         return {};
     }
 
-    // Build complete merkle tree
-    auto tree = BuildMerkleTree(tx_hashes);
-    if (tree.empty()) {
+    std::vector<uint256> hashes;
+    hashes.reserve(tx_hashes.size() + 1);
+    hashes.assign(tx_hashes.begin(), tx_hashes.end());
+    return GetMerkleBranch(std::move(hashes), index);
+}
+
+std::vector<uint256> GetMerkleBranch(std::vector<uint256>&& tx_hashes, size_t index) {
+    if (index >= tx_hashes.size()) {
         return {};
     }
 
-    // Extract branch from tree
+    // Walk the levels in place (as CalculateMerkleRoot does), taking the
+    // sibling of the current node before each level is hashed
+    std::vector<uint256>& hashes = tx_hashes;
     std::vector<uint256> branch;
-    size_t level_offset = 0;
-    size_t level_size = tx_hashes.size();
     size_t current_index = index;
 
-    while (level_size > 1) {
-        // Get sibling index
-        size_t sibling_index = (current_index % 2 == 0) ? current_index + 1 : current_index - 1;
-
-        // Add sibling to branch if it exists
-        if (sibling_index < level_size) {
-            branch.push_back(tree[level_offset + sibling_index]);
-        } else {
-            // If no sibling (odd number of nodes), duplicate current node
-            branch.push_back(tree[level_offset + current_index]);
+    while (hashes.size() > 1) {
+        // If odd number, the last node is paired with itself
+        if (hashes.size() % 2 != 0) {
+            hashes.push_back(hashes.back());
         }
 
-        // Move to next level
-        level_offset += level_size;
-        level_size = (level_size + 1) / 2;
+        branch.push_back(hashes[current_index ^ 1]);
+
+        size_t pairs = hashes.size() / 2;
+        HashMerkleLevel(hashes.data(), pairs, hashes.data());
+        hashes.resize(pairs);
         current_index /= 2;
     }
 
@@ -570,21 +482,14 @@ bool VerifyMerkleProof(const uint256& tx_hash, const uint256& merkle_root,
 
     // Walk up the tree using the branch
     for (const auto& sibling : branch) {
-        std::vector<uint8_t> combined;
-
-        // Determine order based on index
+        // Determine order based on index, then hash to get parent
         if (current_index % 2 == 0) {
             // Current is left, sibling is right
-            SerializeUint256(combined, current_hash);
-            SerializeUint256(combined, sibling);
+            current_hash = HashMerklePair(current_hash, sibling);
         } else {
             // Current is right, sibling is left
-            SerializeUint256(combined, sibling);
-            SerializeUint256(combined, current_hash);
+            current_hash = HashMerklePair(sibling, current_hash);
         }
-
-        // Hash to get parent
-        current_hash = SHA3::Hash(combined);
         current_index /= 2;
     }
 
@@ -68,6 +68,7 @@ public:
         chain_state_.best_block_hash = uint256{};
         chain_state_.best_height = 0;
         chain_state_.chain_work = uint256{};
+        chain_state_.chain_work_version = db::CHAIN_WORK_VERSION_EXACT;
         chain_state_.total_transactions = 0;
         chain_state_.utxo_count = 0;
         chain_state_.total_supply = 0;
@@ -81,6 +82,31 @@ public:
         return db_->StoreChainState(chain_state_);
     }
 
+    // Recompute cumulative chain work from the stored block index. Used once
+    // to convert a total kept in older units, which cannot be mixed with the
+    // work added by new blocks.
+    Result<void> RecomputeChainWork() {
+        LogF(LogLevel::INFO, "Recomputing chain work over %llu blocks...",
+             chain_state_.best_height + 1);
+
+        arith_uint256 work;
+        for (uint64_t height = 0; height <= chain_state_.best_height; height++) {
+            auto hash_result = db_->GetBlockHash(height);
+            if (hash_result.IsError()) {
+                return Result<void>::Error("Failed to recompute chain work: " + hash_result.error);
+            }
+            auto index_result = db_->GetBlockIndex(*hash_result.value);
+            if (index_result.IsError()) {
+                return Result<void>::Error("Failed to recompute chain work: " + index_result.error);
+            }
+            work += DifficultyCalculator::GetBlockWork(index_result.value->bits);
+        }
+
+        chain_state_.chain_work = ArithToUint256(work);
+        chain_state_.chain_work_version = db::CHAIN_WORK_VERSION_EXACT;
+        return SaveChainState();
+    }
+
     // Load UTXO set from database (expensive operation)
     Result<void> LoadUTXOSet() {
         if (!utxo_set_) {
@@ -177,65 +203,15 @@ public:
         return Result<void>::Ok();
     }
 
-    // Calculate chain work for a block
+    // Calculate chain work for a block (expected hashes at its target)
     uint256 CalculateChainWork(uint32_t bits) const {
-        // Chain work = difficulty = max_target / current_target
-        // Compact format: bits = exponent || mantissa
-        // Target = mantissa * 256^(exponent - 3)
-
-        uint256 work{};
-
-        if (bits == 0) {
-            return work;  // Zero work for invalid bits
-        }
-
-        // Extract components from compact representation
-        uint32_t exponent = bits >> 24;
-        uint32_t mantissa = bits & 0x00FFFFFF;
-
-        // Sanity checks
-        if (exponent > 32 || mantissa == 0) {
-            work[0] = 1;  // Minimal work for invalid encoding
-            return work;
-        }
-
-        // For chain work calculation, we approximate:
-        // work ≈ 2^256 / target
-        // Simplified: work[0] = difficulty approximation
-        // A proper implementation would use big integer division
-
-        // Calculate approximate difficulty based on how hard the target is
-        // Lower target (higher difficulty) = more work
-        // This is a simplified calculation suitable for alpha
-        uint64_t difficulty_approx = 1;
-        if (exponent < 32) {
-            // Scale difficulty based on exponent and mantissa
-            difficulty_approx = (uint64_t(1) << (32 - exponent)) / (mantissa + 1);
-        }
-
-        // Store approximation in work (first 8 bytes)
-        work[0] = difficulty_approx & 0xFF;
-        work[1] = (difficulty_approx >> 8) & 0xFF;
-        work[2] = (difficulty_approx >> 16) & 0xFF;
-        work[3] = (difficulty_approx >> 24) & 0xFF;
-        work[4] = (difficulty_approx >> 32) & 0xFF;
-        work[5] = (difficulty_approx >> 40) & 0xFF;
-        work[6] = (difficulty_approx >> 48) & 0xFF;
-        work[7] = (difficulty_approx >> 56) & 0xFF;
-
-        return work;
+        return ArithToUint256(DifficultyCalculator::GetBlockWork(bits));
     }
 
     // Add work to cumulative chain work
     void AddChainWork(const uint256& work) {
-        // Simple addition (with overflow handling)
-        bool carry = false;
-        for (int i = 0; i < 32; i++) {
-            uint16_t sum = chain_state_.chain_work[i] + work[i];
-            if (carry) sum++;
-            chain_state_.chain_work[i] = sum & 0xFF;
-            carry = (sum > 0xFF);
-        }
+        chain_state_.chain_work = ArithToUint256(
+            UintToArith256(chain_state_.chain_work) + UintToArith256(work));
     }
 };
 
@@ -268,6 +244,8 @@ Result<void> Blockchain::Initialize() {
         // Reset chain state since genesis doesn't exist
         impl_->chain_state_.best_block_hash = uint256{};
         impl_->chain_state_.best_height = 0;
+        impl_->chain_state_.chain_work = uint256{};
+        impl_->chain_state_.chain_work_version = db::CHAIN_WORK_VERSION_EXACT;
 
         // Create and store genesis block (use internal method since we already hold mutex)
         Block genesis = CreateGenesisBlock();
@@ -278,6 +256,11 @@ Result<void> Blockchain::Initialize() {
             return Result<void>::Error("Failed to create genesis block: " + add_result.error);
         }
         LogF(LogLevel::INFO, "Genesis block added, new height: %llu", impl_->chain_state_.best_height);
+    } else if (impl_->chain_state_.chain_work_version != db::CHAIN_WORK_VERSION_EXACT) {
+        auto work_result = impl_->RecomputeChainWork();
+        if (work_result.IsError()) {
+            return work_result;
+        }
     }
 
     // Load UTXO set (TODO: optimize this for large chains)
@@ -1401,20 +1384,26 @@ const Mempool& Blockchain::GetMempool() const {
 }
 
 Result<void> Blockchain::AddToMempool(const Transaction& tx) {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-
-    if (!impl_->mempool_) {
+    // The mempool has its own lock; the chain lock is only needed to read
+    // the callback list, so admissions from many peers don't serialize on it
+    Mempool* mempool = impl_->mempool_.get();
+    if (!mempool) {
         return Result<void>::Error("Mempool not initialized");
     }
 
     // Add transaction to mempool
-    auto add_result = impl_->mempool_->AddTransaction(tx);
+    auto add_result = mempool->AddTransaction(tx);
     if (add_result.IsError()) {
         return add_result;
     }
 
     // Notify transaction callbacks
-    for (const auto& callback : impl_->tx_callbacks_) {
+    std::vector<TransactionCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        callbacks = impl_->tx_callbacks_;
+    }
+    for (const auto& callback : callbacks) {
         callback(tx);
     }
 
@@ -7,6 +7,9 @@
 #include "intcoin/util.h"
 #include "intcoin/transaction.h"
 #include "intcoin/crypto.h"
+#include <algorithm>
+#include <array>
+#include <span>
 
 namespace intcoin {
 
@@ -469,20 +472,143 @@ std::string Script::ToString() const {
 // Script Execution
 // ============================================================================
 
+namespace {
+
+/// SIGHASH_ALL hash of tx for input_index (the only sighash scripts check)
+uint256 ComputeSigningHash(const Transaction& tx, size_t input_index, const Script& script_pubkey,
+                           const PrecomputedTxData* txdata) {
+    return txdata ? tx.GetHashForSigning(SIGHASH_ALL, input_index, script_pubkey, *txdata)
+                  : tx.GetHashForSigning(SIGHASH_ALL, input_index, script_pubkey);
+}
+
+/// Verify a Dilithium3 signature over hash (sizes already checked)
+bool CheckSignature(const uint256& hash, const uint8_t* signature_bytes, const uint8_t* pubkey_bytes) {
+    PublicKey pubkey;
+    Signature signature;
+    std::copy(pubkey_bytes, pubkey_bytes + pubkey.size(), pubkey.begin());
+    std::copy(signature_bytes, signature_bytes + signature.size(), signature.begin());
+    return DilithiumCrypto::VerifyHashCached(hash, signature, pubkey).IsOk();
+}
+
+/// Interpreter stack element: either a view of bytes pushed by a script
+/// (which must outlive the VM) or a small computed value (hash, boolean)
+/// held inline. Copies never allocate.
+class StackItem {
+public:
+    static constexpr size_t MAX_INLINE = 32;
+
+    StackItem() = default;
+
+    static StackItem View(const uint8_t* data, size_t size) {
+        StackItem item;
+        item.view_ = data;
+        item.size_ = size;
+        return item;
+    }
+
+    static StackItem Value(const uint8_t* data, size_t size) {
+        StackItem item;
+        std::copy(data, data + size, item.inline_.begin());
+        item.size_ = size;
+        return item;
+    }
+
+    static StackItem Bool(bool value) {
+        const uint8_t byte = value ? 1 : 0;
+        return Value(&byte, 1);
+    }
+
+    const uint8_t* data() const { return view_ ? view_ : inline_.data(); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    uint8_t operator[](size_t i) const { return data()[i]; }
+
+    bool operator==(const StackItem& other) const {
+        return size_ == other.size_ && std::equal(data(), data() + size_, other.data());
+    }
+
+private:
+    const uint8_t* view_ = nullptr;
+    size_t size_ = 0;
+    std::array<uint8_t, MAX_INLINE> inline_{};
+};
+
+/// Interpreter stack: the first INLINE_CAPACITY items live inside the VM;
+/// only unusually deep stacks spill to the heap
+class ScriptStack {
+public:
+    static constexpr size_t INLINE_CAPACITY = 8;
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    StackItem& operator[](size_t i) {
+        return i < INLINE_CAPACITY ? inline_[i] : overflow_[i - INLINE_CAPACITY];
+    }
+    const StackItem& operator[](size_t i) const {
+        return i < INLINE_CAPACITY ? inline_[i] : overflow_[i - INLINE_CAPACITY];
+    }
+
+    StackItem& back() { return (*this)[size_ - 1]; }
+    const StackItem& back() const { return (*this)[size_ - 1]; }
+
+    void push_back(const StackItem& item) {
+        if (size_ < INLINE_CAPACITY) {
+            inline_[size_] = item;
+        } else {
+            overflow_.push_back(item);
+        }
+        size_++;
+    }
+
+    void pop_back() {
+        size_--;
+        if (size_ >= INLINE_CAPACITY) {
+            overflow_.pop_back();
+        }
+    }
+
+    /// Pop the top item
+    StackItem pop() {
+        StackItem item = back();
+        pop_back();
+        return item;
+    }
+
+private:
+    std::array<StackItem, INLINE_CAPACITY> inline_;
+    std::vector<StackItem> overflow_;
+    size_t size_ = 0;
+};
+
+} // namespace
+
 /// Stack-based virtual machine for script execution
 class ScriptVM {
 private:
-    std::vector<std::vector<uint8_t>> stack;
+    ScriptStack stack;
     const Transaction* tx;
     size_t input_index;
     const Script* script_pubkey;  // Previous output's script_pubkey (for signature verification)
+    const PrecomputedTxData* txdata;  // Optional, shared by all inputs of tx
+    std::optional<uint256> signing_hash;  // Same for every signature check of this input
+
+    /// SIGHASH_ALL hash for this input (computed on first use)
+    const uint256& GetSigningHash() {
+        if (!signing_hash.has_value()) {
+            signing_hash = ComputeSigningHash(*tx, input_index, *script_pubkey, txdata);
+        }
+        return *signing_hash;
+    }
 
 public:
-    ScriptVM(const Transaction* transaction, size_t input_idx, const Script* prev_script_pubkey)
-        : tx(transaction), input_index(input_idx), script_pubkey(prev_script_pubkey) {
+    ScriptVM(const Transaction* transaction, size_t input_idx, const Script* prev_script_pubkey,
+             const PrecomputedTxData* precomputed = nullptr)
+        : tx(transaction), input_index(input_idx), script_pubkey(prev_script_pubkey), txdata(precomputed) {
     }
 
-    /// Execute a script on this VM
+    /// Execute a script on this VM (pushed items reference script's bytes,
+    /// so it must stay alive until the VM is done)
     ScriptExecutionResult Execute(const Script& script) {
         const auto& bytes = script.bytes;
         size_t pc = 0;  // Program counter
@@ -501,8 +627,7 @@ public:
                 if (pc + len > bytes.size()) {
                     return ScriptExecutionResult::Error("OP_PUSHDATA: truncated data");
                 }
-                std::vector<uint8_t> data(bytes.begin() + pc, bytes.begin() + pc + len);
-                stack.push_back(data);
+                stack.push_back(StackItem::View(bytes.data() + pc, len));
                 pc += len;
             }
             // OP_DUP: Duplicate top stack item
@@ -518,10 +643,9 @@ public:
                 if (stack.empty()) {
                     return ScriptExecutionResult::Error("OP_HASH: stack underflow");
                 }
-                auto data = stack.back();
-                stack.pop_back();
-                uint256 hash = SHA3::Hash(data);
-                stack.push_back(std::vector<uint8_t>(hash.begin(), hash.end()));
+                StackItem& top = stack.back();
+                uint256 hash = SHA3::Hash(top.data(), top.size());
+                top = StackItem::Value(hash.data(), hash.size());
                 pc++;
             }
             // OP_CHECKSIG: Verify Dilithium signature
@@ -532,31 +656,21 @@ public:
                     return ScriptExecutionResult::Error("OP_CHECKSIG: stack underflow");
                 }
                 // Pop in correct order: pubkey is on top, signature below
-                auto pubkey_bytes = stack.back();
-                stack.pop_back();
-                auto signature_bytes = stack.back();
-                stack.pop_back();
+                StackItem pubkey = stack.pop();
+                StackItem signature = stack.pop();
 
                 // Verify Dilithium signature
-                if (pubkey_bytes.size() != 1952) {
-                    stack.push_back({0});  // Push false
-                } else if (signature_bytes.size() != 3309) {  // Dilithium3 signature size
-                    stack.push_back({0});  // Push false
+                if (pubkey.size() != DILITHIUM3_PUBLICKEYBYTES) {
+                    stack.push_back(StackItem::Bool(false));
+                } else if (signature.size() != DILITHIUM3_BYTES) {
+                    stack.push_back(StackItem::Bool(false));
                 } else if (!script_pubkey) {
                     return ScriptExecutionResult::Error("OP_CHECKSIG: no script_pubkey provided");
                 } else {
-                    // Copy vectors to arrays
-                    PublicKey pubkey;
-                    Signature signature;
-                    std::copy(pubkey_bytes.begin(), pubkey_bytes.end(), pubkey.begin());
-                    std::copy(signature_bytes.begin(), signature_bytes.end(), signature.begin());
-
-                    // Get transaction hash for signing with the previous output's script_pubkey
-                    // This ensures the same hash is used during both signing and verification
-                    uint256 tx_hash = tx->GetHashForSigning(SIGHASH_ALL, input_index, *script_pubkey);
-
-                    auto result = DilithiumCrypto::VerifyHash(tx_hash, signature, pubkey);
-                    stack.push_back(result.IsOk() ? std::vector<uint8_t>{1} : std::vector<uint8_t>{0});
+                    // Signing hash uses the previous output's script_pubkey, so
+                    // it matches the hash signed by the wallet
+                    stack.push_back(StackItem::Bool(
+                        CheckSignature(GetSigningHash(), signature.data(), pubkey.data())));
                 }
                 pc++;
             }
@@ -570,39 +684,35 @@ public:
                 }
 
                 // Pop N (number of public keys)
-                auto n_bytes = stack.back();
-                stack.pop_back();
-                if (n_bytes.empty() || n_bytes.size() > 1) {
+                StackItem n_item = stack.pop();
+                if (n_item.size() != 1) {
                     return ScriptExecutionResult::Error("OP_CHECKMULTISIG: invalid N");
                 }
-                uint8_t n = n_bytes[0];
+                uint8_t n = n_item[0];
                 if (n > 0x51) n -= 0x50;  // Convert OP_1..OP_16 to 1..16
 
                 // Pop N public keys
                 if (stack.size() < n) {
                     return ScriptExecutionResult::Error("OP_CHECKMULTISIG: not enough pubkeys on stack");
                 }
-                std::vector<std::vector<uint8_t>> pubkeys;
-                for (uint8_t i = 0; i < n; i++) {
-                    pubkeys.push_back(stack.back());
-                    stack.pop_back();
+                std::vector<StackItem> pubkeys(n);
+                for (size_t i = n; i > 0; i--) {
+                    pubkeys[i - 1] = stack.pop();  // Stack is LIFO
                 }
-                std::reverse(pubkeys.begin(), pubkeys.end());  // Stack is LIFO
 
                 // Pop M (required signatures)
                 if (stack.empty()) {
                     return ScriptExecutionResult::Error("OP_CHECKMULTISIG: stack underflow (M)");
                 }
-                auto m_bytes = stack.back();
-                stack.pop_back();
-                if (m_bytes.empty() || m_bytes.size() > 1) {
+                StackItem m_item = stack.pop();
+                if (m_item.size() != 1) {
                     return ScriptExecutionResult::Error("OP_CHECKMULTISIG: invalid M");
                 }
-                uint8_t m = m_bytes[0];
+                uint8_t m = m_item[0];
                 if (m > 0x51) m -= 0x50;  // Convert OP_1..OP_16 to 1..16
 
                 if (m > n) {
-                    stack.push_back({0});  // Invalid: M > N
+                    stack.push_back(StackItem::Bool(false));  // Invalid: M > N
                     pc++;
                     continue;
                 }
@@ -611,12 +721,10 @@ public:
                 if (stack.size() < m) {
                     return ScriptExecutionResult::Error("OP_CHECKMULTISIG: not enough sigs on stack");
                 }
-                std::vector<std::vector<uint8_t>> sigs;
-                for (uint8_t i = 0; i < m; i++) {
-                    sigs.push_back(stack.back());
-                    stack.pop_back();
+                std::vector<StackItem> sigs(m);
+                for (size_t i = m; i > 0; i--) {
+                    sigs[i - 1] = stack.pop();  // Stack is LIFO
                 }
-                std::reverse(sigs.begin(), sigs.end());  // Stack is LIFO
 
                 // Pop dummy element (Bitcoin bug compatibility)
                 if (stack.empty()) {
@@ -630,21 +738,14 @@ public:
                 size_t pubkey_idx = 0;
 
                 while (sig_idx < sigs.size() && pubkey_idx < pubkeys.size()) {
-                    if (sigs[sig_idx].size() != 3309 || pubkeys[pubkey_idx].size() != 1952) {
+                    if (sigs[sig_idx].size() != DILITHIUM3_BYTES ||
+                        pubkeys[pubkey_idx].size() != DILITHIUM3_PUBLICKEYBYTES) {
                         pubkey_idx++;
                         continue;
                     }
 
                     // Try to verify signature with current pubkey
-                    PublicKey pubkey;
-                    Signature signature;
-                    std::copy(pubkeys[pubkey_idx].begin(), pubkeys[pubkey_idx].end(), pubkey.begin());
-                    std::copy(sigs[sig_idx].begin(), sigs[sig_idx].end(), signature.begin());
-
-                    uint256 tx_hash = tx->GetHashForSigning(SIGHASH_ALL, input_index, *script_pubkey);
-                    auto result = DilithiumCrypto::VerifyHash(tx_hash, signature, pubkey);
-
-                    if (result.IsOk()) {
+                    if (CheckSignature(GetSigningHash(), sigs[sig_idx].data(), pubkeys[pubkey_idx].data())) {
                         // Signature verified with this pubkey, move to next sig
                         sig_idx++;
                     }
@@ -653,11 +754,7 @@ public:
                 }
 
                 // All signatures must have been verified
-                if (sig_idx == sigs.size()) {
-                    stack.push_back({1});  // All signatures valid
-                } else {
-                    stack.push_back({0});  // Not all signatures verified
-                }
+                stack.push_back(StackItem::Bool(sig_idx == sigs.size()));
                 pc++;
             }
             // OP_DROP: Remove top stack item
@@ -681,11 +778,9 @@ public:
                 if (stack.size() < 2) {
                     return ScriptExecutionResult::Error("OP_EQUAL: stack underflow");
                 }
-                auto a = stack.back();
-                stack.pop_back();
-                auto b = stack.back();
-                stack.pop_back();
-                stack.push_back((a == b) ? std::vector<uint8_t>{1} : std::vector<uint8_t>{0});
+                StackItem a = stack.pop();
+                StackItem b = stack.pop();
+                stack.push_back(StackItem::Bool(a == b));
                 pc++;
             }
             // OP_VERIFY: Verify top item is true, fail otherwise
@@ -693,8 +788,7 @@ public:
                 if (stack.empty()) {
                     return ScriptExecutionResult::Error("OP_VERIFY: stack underflow");
                 }
-                auto value = stack.back();
-                stack.pop_back();
+                StackItem value = stack.pop();
                 if (value.empty() || value[0] == 0) {
                     return ScriptExecutionResult::Error("OP_VERIFY: failed");
                 }
@@ -705,11 +799,9 @@ public:
                 if (stack.size() < 2) {
                     return ScriptExecutionResult::Error("OP_EQUALVERIFY: stack underflow");
                 }
-                auto a = stack.back();
-                stack.pop_back();
-                auto b = stack.back();
-                stack.pop_back();
-                if (a != b) {
+                StackItem a = stack.pop();
+                StackItem b = stack.pop();
+                if (!(a == b)) {
                     return ScriptExecutionResult::Error("OP_EQUALVERIFY: not equal");
                 }
                 pc++;
@@ -725,8 +817,7 @@ public:
                 if (pc + len > bytes.size()) {
                     return ScriptExecutionResult::Error("Direct push: truncated data");
                 }
-                std::vector<uint8_t> data(bytes.begin() + pc, bytes.begin() + pc + len);
-                stack.push_back(data);
+                stack.push_back(StackItem::View(bytes.data() + pc, len));
                 pc += len;
             }
             else {
@@ -747,12 +838,110 @@ public:
     }
 };
 
+// ============================================================================
+// Standard Script Fast Path
+// ============================================================================
+//
+// Nearly every spend is a P2PKH or P2PK output unlocked by the matching
+// push-only script_sig. Those pairs are verified directly - one hash compare
+// and one signature check - with exactly the outcome (and error text) the
+// interpreter would produce. Anything else runs through ScriptVM.
+
+namespace {
+
+/// Pushed items of a push-only script_sig, as views into its bytes.
+/// Returns false if the script has a non-push opcode, a malformed push or
+/// more than MAX_ITEMS pushes (the interpreter then handles it).
+struct PushedItems {
+    static constexpr size_t MAX_ITEMS = 2;
+
+    std::array<std::span<const uint8_t>, MAX_ITEMS> items;
+    size_t count = 0;
+
+    bool Parse(const Script& script) {
+        const auto& bytes = script.bytes;
+        size_t pc = 0;
+        while (pc < bytes.size()) {
+            if (count == MAX_ITEMS) {
+                return false;
+            }
+            const uint8_t opcode = bytes[pc++];
+            size_t len = 0;
+            if (opcode == static_cast<uint8_t>(OpCode::OP_PUSHDATA)) {
+                if (pc + 1 >= bytes.size()) {
+                    return false;
+                }
+                len = bytes[pc] | (bytes[pc + 1] << 8);
+                pc += 2;
+            } else if (opcode > 0 && opcode <= 75) {
+                len = opcode;
+            } else {
+                return false;
+            }
+            if (pc + len > bytes.size()) {
+                return false;
+            }
+            items[count++] = std::span<const uint8_t>(bytes.data() + pc, len);
+            pc += len;
+        }
+        return true;
+    }
+};
+
+const char* const FAILED_STACK_ERROR = "Script failed: stack is empty or top is false";
+
+/// <signature> <pubkey> against OP_DUP OP_HASH <hash> OP_EQUALVERIFY OP_CHECKSIG
+ScriptExecutionResult VerifyP2PKH(std::span<const uint8_t> signature, std::span<const uint8_t> pubkey,
+                                  const Script& script_pubkey, const Transaction& tx,
+                                  size_t input_index, const PrecomputedTxData* txdata) {
+    const uint256 pubkey_hash = SHA3::Hash(pubkey.data(), pubkey.size());
+    if (!std::equal(pubkey_hash.begin(), pubkey_hash.end(), script_pubkey.bytes.begin() + 3)) {
+        return ScriptExecutionResult::Error("script_pubkey execution failed: OP_EQUALVERIFY: not equal");
+    }
+    if (pubkey.size() != DILITHIUM3_PUBLICKEYBYTES || signature.size() != DILITHIUM3_BYTES) {
+        return ScriptExecutionResult::Error(FAILED_STACK_ERROR);
+    }
+    const uint256 sighash = ComputeSigningHash(tx, input_index, script_pubkey, txdata);
+    if (!CheckSignature(sighash, signature.data(), pubkey.data())) {
+        return ScriptExecutionResult::Error(FAILED_STACK_ERROR);
+    }
+    return ScriptExecutionResult::Ok();
+}
+
+/// <signature> against <pubkey> OP_CHECKSIG
+ScriptExecutionResult VerifyP2PK(std::span<const uint8_t> signature, const Script& script_pubkey,
+                                 const Transaction& tx, size_t input_index,
+                                 const PrecomputedTxData* txdata) {
+    if (signature.size() != DILITHIUM3_BYTES) {
+        return ScriptExecutionResult::Error(FAILED_STACK_ERROR);
+    }
+    const uint256 sighash = ComputeSigningHash(tx, input_index, script_pubkey, txdata);
+    if (!CheckSignature(sighash, signature.data(), script_pubkey.bytes.data() + 3)) {
+        return ScriptExecutionResult::Error(FAILED_STACK_ERROR);
+    }
+    return ScriptExecutionResult::Ok();
+}
+
+} // namespace
+
 ScriptExecutionResult ExecuteScript(const Script& script_sig,
                                    const Script& script_pubkey,
                                    const class Transaction& tx,
-                                   size_t input_index) {
+                                   size_t input_index,
+                                   const PrecomputedTxData* txdata) {
+    // Fast path: standard script pairs skip the interpreter entirely
+    PushedItems pushed;
+    if (pushed.Parse(script_sig)) {
+        if (pushed.count == 2 && script_pubkey.IsP2PKH()) {
+            return VerifyP2PKH(pushed.items[0], pushed.items[1], script_pubkey, tx, input_index, txdata);
+        }
+        if (pushed.count == 1 && script_pubkey.IsP2PK()) {
+            return VerifyP2PK(pushed.items[0], script_pubkey, tx, input_index, txdata);
+        }
+    }
+
     // Create VM with transaction context and prev_scriptpubkey for signature verification
-    ScriptVM vm(&tx, input_index, &script_pubkey);
+    ScriptVM vm(&tx, input_index, &script_pubkey, txdata);
 
     // Phase 1: Execute script_sig (unlocking script)
     auto result = vm.Execute(script_sig);
@@ -768,7 +957,7 @@ ScriptExecutionResult ExecuteScript(const Script& script_sig,
 
     // Phase 3: Verify final stack state
     if (!vm.IsSuccess()) {
-        return ScriptExecutionResult::Error("Script failed: stack is empty or top is false");
+        return ScriptExecutionResult::Error(FAILED_STACK_ERROR);
     }
 
     return ScriptExecutionResult::Ok();
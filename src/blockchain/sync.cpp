@@ -6,6 +6,7 @@
 
 #include "../../include/intcoin/sync.h"
 #include "../../include/intcoin/util.h"
+#include "../../include/intcoin/consensus.h"
 #include <algorithm>
 #include <thread>
 #include <iostream>
@@ -687,6 +688,32 @@ Result<void> HeadersSyncManager::AddHeader(const BlockHeader& header) {
 }
 
 Result<void> HeadersSyncManager::AddHeaders(const std::vector<BlockHeader>& headers) {
+    if (headers.empty()) {
+        return Result<void>{};
+    }
+
+    std::vector<uint256> header_hashes;
+    header_hashes.reserve(headers.size());
+    for (const auto& header : headers) {
+        header_hashes.push_back(header.GetHash());
+    }
+
+    // Cheap linkage and difficulty checks before any RandomX work
+    for (size_t i = 0; i < headers.size(); i++) {
+        if (i > 0 && headers[i].prev_block_hash != header_hashes[i - 1]) {
+            return Result<void>::Error("Headers do not form a valid chain");
+        }
+        if (headers[i].bits == 0) {
+            return Result<void>::Error("Header has invalid difficulty bits");
+        }
+    }
+
+    // Verify PoW for the whole batch in parallel; any failure rejects it
+    auto pow_result = RandomXValidator::ValidateHeaderBatch(headers, header_hashes);
+    if (pow_result.IsError()) {
+        return pow_result;
+    }
+
     for (const auto& header : headers) {
         auto result = AddHeader(header);
         if (!result.IsOk()) {
@@ -17,55 +17,19 @@ namespace intcoin {
 
 std::vector<uint8_t> TxIn::Serialize() const {
     std::vector<uint8_t> result;
-    SerializeUint256(result, prev_tx_hash);
-    SerializeUint32(result, prev_tx_index);
-    auto script_bytes = script_sig.Serialize();
-    SerializeUint64(result, script_bytes.size());
-    result.insert(result.end(), script_bytes.begin(), script_bytes.end());
-    SerializeUint32(result, sequence);
+    result.reserve(GetSerializedSize());
+    VectorWriter writer(result);
+    Serialize(writer);
     return result;
 }
 
 Result<TxIn> TxIn::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
+    SpanReader reader(data);
     TxIn txin;
-
-    // Deserialize prev_tx_hash (32 bytes)
-    auto hash_result = DeserializeUint256(data, pos);
-    if (hash_result.IsError()) {
-        return Result<TxIn>::Error("Failed to deserialize prev_tx_hash: " + hash_result.error);
-    }
-    txin.prev_tx_hash = *hash_result.value;
-
-    // Deserialize prev_tx_index (4 bytes)
-    auto index_result = DeserializeUint32(data, pos);
-    if (index_result.IsError()) {
-        return Result<TxIn>::Error("Failed to deserialize prev_tx_index: " + index_result.error);
-    }
-    txin.prev_tx_index = *index_result.value;
-
-    // Deserialize script_sig length (8 bytes)
-    auto script_len_result = DeserializeUint64(data, pos);
-    if (script_len_result.IsError()) {
-        return Result<TxIn>::Error("Failed to deserialize script_sig length: " + script_len_result.error);
-    }
-    uint64_t script_len = *script_len_result.value;
-
-    // Deserialize script_sig bytes
-    if (pos + script_len > data.size()) {
-        return Result<TxIn>::Error("Buffer underflow: not enough bytes for script_sig");
-    }
-    std::vector<uint8_t> script_bytes(data.begin() + pos, data.begin() + pos + script_len);
-    txin.script_sig = Script::Deserialize(script_bytes);
-    pos += script_len;
-
-    // Deserialize sequence (4 bytes)
-    auto seq_result = DeserializeUint32(data, pos);
-    if (seq_result.IsError()) {
-        return Result<TxIn>::Error("Failed to deserialize sequence: " + seq_result.error);
+    auto result = txin.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<TxIn>::Error(result.error);
     }
-    txin.sequence = *seq_result.value;
-
     return Result<TxIn>::Ok(std::move(txin));
 }
 
@@ -79,39 +43,19 @@ size_t TxIn::GetSerializedSize() const {
 
 std::vector<uint8_t> TxOut::Serialize() const {
     std::vector<uint8_t> result;
-    SerializeUint64(result, value);
-    auto script_bytes = script_pubkey.Serialize();
-    SerializeUint64(result, script_bytes.size());
-    result.insert(result.end(), script_bytes.begin(), script_bytes.end());
+    result.reserve(GetSerializedSize());
+    VectorWriter writer(result);
+    Serialize(writer);
     return result;
 }
 
 Result<TxOut> TxOut::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
+    SpanReader reader(data);
     TxOut txout;
-
-    // Deserialize value (8 bytes)
-    auto value_result = DeserializeUint64(data, pos);
-    if (value_result.IsError()) {
-        return Result<TxOut>::Error("Failed to deserialize value: " + value_result.error);
-    }
-    txout.value = *value_result.value;
-
-    // Deserialize script_pubkey length (8 bytes)
-    auto script_len_result = DeserializeUint64(data, pos);
-    if (script_len_result.IsError()) {
-        return Result<TxOut>::Error("Failed to deserialize script_pubkey length: " + script_len_result.error);
-    }
-    uint64_t script_len = *script_len_result.value;
-
-    // Deserialize script_pubkey bytes
-    if (pos + script_len > data.size()) {
-        return Result<TxOut>::Error("Buffer underflow: not enough bytes for script_pubkey");
+    auto result = txout.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<TxOut>::Error(result.error);
     }
-    std::vector<uint8_t> script_bytes(data.begin() + pos, data.begin() + pos + script_len);
-    txout.script_pubkey = Script::Deserialize(script_bytes);
-    pos += script_len;
-
     return Result<TxOut>::Ok(std::move(txout));
 }
 
@@ -135,29 +79,19 @@ bool OutPoint::operator<(const OutPoint& other) const {
 
 std::vector<uint8_t> OutPoint::Serialize() const {
     std::vector<uint8_t> result;
-    SerializeUint256(result, tx_hash);
-    SerializeUint32(result, index);
+    result.reserve(SERIALIZED_SIZE);
+    VectorWriter writer(result);
+    Serialize(writer);
     return result;
 }
 
 Result<OutPoint> OutPoint::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
+    SpanReader reader(data);
     OutPoint outpoint;
-
-    // Deserialize tx_hash (32 bytes)
-    auto hash_result = DeserializeUint256(data, pos);
-    if (hash_result.IsError()) {
-        return Result<OutPoint>::Error("Failed to deserialize tx_hash: " + hash_result.error);
-    }
-    outpoint.tx_hash = *hash_result.value;
-
-    // Deserialize index (4 bytes)
-    auto index_result = DeserializeUint32(data, pos);
-    if (index_result.IsError()) {
-        return Result<OutPoint>::Error("Failed to deserialize index: " + index_result.error);
+    auto result = outpoint.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<OutPoint>::Error(result.error);
     }
-    outpoint.index = *index_result.value;
-
     return Result<OutPoint>::Ok(std::move(outpoint));
 }
 
@@ -168,6 +102,36 @@ std::size_t OutPointHash::operator()(const OutPoint& outpoint) const noexcept {
     return h1 ^ (h2 << 1);
 }
 
+// ============================================================================
+// PrecomputedTxData Implementation
+// ============================================================================
+
+void PrecomputedTxData::Init(const Transaction& tx) {
+    cleared_inputs.clear();
+    cleared_inputs.reserve(tx.inputs.size() * CLEARED_INPUT_SIZE);
+    for (const auto& input : tx.inputs) {
+        SerializeUint256(cleared_inputs, input.prev_tx_hash);
+        SerializeUint32(cleared_inputs, input.prev_tx_index);
+        SerializeUint64(cleared_inputs, 0);  // Empty script_sig
+        SerializeUint32(cleared_inputs, input.sequence);
+    }
+
+    outputs.clear();
+    output_offsets.clear();
+    output_offsets.reserve(tx.outputs.size() + 1);
+    VectorWriter writer(outputs);
+    for (const auto& output : tx.outputs) {
+        output_offsets.push_back(outputs.size());
+        output.Serialize(writer);
+    }
+    output_offsets.push_back(outputs.size());
+}
+
+bool PrecomputedTxData::Matches(const Transaction& tx) const {
+    return cleared_inputs.size() == tx.inputs.size() * CLEARED_INPUT_SIZE &&
+           output_offsets.size() == tx.outputs.size() + 1;
+}
+
 // ============================================================================
 // Transaction Implementation
 // ============================================================================
@@ -177,18 +141,38 @@ uint256 Transaction::GetHash() const {
         return *cached_hash_;
     }
 
-    auto serialized = Serialize();
-    uint256 hash = SHA3::Hash(serialized);
+    // Serialize straight into the hash (no intermediate buffer)
+    HashWriter writer;
+    Serialize(writer);
+    uint256 hash = writer.GetHash();
     cached_hash_ = hash;
     return hash;
 }
 
 uint256 Transaction::GetHashForSigning(uint8_t sighash_type, size_t input_index, const Script& prev_scriptpubkey) const {
-    // Create a copy of the transaction for signing
-    std::vector<uint8_t> signing_data;
+    return GetHashForSigning(sighash_type, input_index, prev_scriptpubkey, PrecomputedTxData(*this));
+}
+
+uint256 Transaction::GetHashForSigning(uint8_t sighash_type, size_t input_index, const Script& prev_scriptpubkey,
+                                       const PrecomputedTxData& txdata) const {
+    if (!txdata.Matches(*this)) {
+        return GetHashForSigning(sighash_type, input_index, prev_scriptpubkey);
+    }
+
+    // The preimage is streamed into the hash piece by piece
+    HashWriter writer;
+
+    // The input being signed, with script_sig replaced by prev_scriptpubkey
+    auto serialize_signed_input = [&](const TxIn& input) {
+        SerializeUint256(writer, input.prev_tx_hash);
+        SerializeUint32(writer, input.prev_tx_index);
+        SerializeUint64(writer, prev_scriptpubkey.GetSize());
+        SerializeBytes(writer, prev_scriptpubkey.bytes.data(), prev_scriptpubkey.bytes.size());
+        SerializeUint32(writer, input.sequence);
+    };
 
     // Serialize version
-    SerializeUint32(signing_data, version);
+    SerializeUint32(writer, version);
 
     // Determine base SIGHASH type
     SigHashType base_type = GetBaseSigHashType(sighash_type);
@@ -197,79 +181,61 @@ uint256 Transaction::GetHashForSigning(uint8_t sighash_type, size_t input_index,
     // Serialize inputs based on ANYONECANPAY flag
     if (anyonecanpay) {
         // ANYONECANPAY: Only serialize the input being signed
-        SerializeUint64(signing_data, 1);
+        SerializeUint64(writer, 1);
         if (input_index < inputs.size()) {
-            // For the input being signed, replace script_sig with prev_scriptpubkey
-            TxIn input = inputs[input_index];
-            input.script_sig = prev_scriptpubkey;
-            auto input_bytes = input.Serialize();
-            signing_data.insert(signing_data.end(), input_bytes.begin(), input_bytes.end());
+            serialize_signed_input(inputs[input_index]);
         }
     } else {
-        // Normal: Serialize all inputs (with script_sig cleared for others)
-        SerializeUint64(signing_data, inputs.size());
-        for (size_t i = 0; i < inputs.size(); ++i) {
-            TxIn input = inputs[i];
-            if (i != input_index) {
-                // Clear script_sig for inputs other than the one being signed
-                input.script_sig = Script(std::vector<uint8_t>());
-            } else {
-                // For the input being signed, replace script_sig with prev_scriptpubkey
-                input.script_sig = prev_scriptpubkey;
-            }
-            auto input_bytes = input.Serialize();
-            signing_data.insert(signing_data.end(), input_bytes.begin(), input_bytes.end());
+        // Normal: All inputs, with script_sig cleared for the others
+        SerializeUint64(writer, inputs.size());
+        const auto& cleared = txdata.cleared_inputs;
+        if (input_index < inputs.size()) {
+            const size_t before = input_index * PrecomputedTxData::CLEARED_INPUT_SIZE;
+            const size_t after = before + PrecomputedTxData::CLEARED_INPUT_SIZE;
+            SerializeBytes(writer, cleared.data(), before);
+            serialize_signed_input(inputs[input_index]);
+            SerializeBytes(writer, cleared.data() + after, cleared.size() - after);
+        } else {
+            SerializeBytes(writer, cleared.data(), cleared.size());
         }
     }
 
     // Serialize outputs based on SIGHASH type
     switch (base_type) {
-        case SigHashType::ALL:
-            // SIGHASH_ALL: Include all outputs
-            SerializeUint64(signing_data, outputs.size());
-            for (const auto& output : outputs) {
-                auto output_bytes = output.Serialize();
-                signing_data.insert(signing_data.end(), output_bytes.begin(), output_bytes.end());
-            }
-            break;
-
         case SigHashType::NONE:
             // SIGHASH_NONE: No outputs
-            SerializeUint64(signing_data, 0);
+            SerializeUint64(writer, 0);
             break;
 
         case SigHashType::SINGLE:
             // SIGHASH_SINGLE: Only output at same index
             if (input_index < outputs.size()) {
-                SerializeUint64(signing_data, 1);
-                auto output_bytes = outputs[input_index].Serialize();
-                signing_data.insert(signing_data.end(), output_bytes.begin(), output_bytes.end());
+                SerializeUint64(writer, 1);
+                SerializeBytes(writer, txdata.outputs.data() + txdata.output_offsets[input_index],
+                               txdata.output_offsets[input_index + 1] - txdata.output_offsets[input_index]);
             } else {
                 // If no corresponding output, serialize 0 outputs
-                SerializeUint64(signing_data, 0);
+                SerializeUint64(writer, 0);
             }
             break;
 
+        case SigHashType::ALL:
         case SigHashType::ANYONECANPAY:
-            // ANYONECANPAY is a modifier, not a base type
-            // It should have been filtered out by GetBaseSigHashType
-            // Default to ALL behavior
-            SerializeUint64(signing_data, outputs.size());
-            for (const auto& output : outputs) {
-                auto output_bytes = output.Serialize();
-                signing_data.insert(signing_data.end(), output_bytes.begin(), output_bytes.end());
-            }
+            // SIGHASH_ALL: Include all outputs (ANYONECANPAY is a modifier,
+            // filtered out by GetBaseSigHashType; treated as ALL)
+            SerializeUint64(writer, outputs.size());
+            SerializeBytes(writer, txdata.outputs.data(), txdata.outputs.size());
             break;
     }
 
     // Serialize locktime
-    SerializeUint64(signing_data, locktime);
+    SerializeUint64(writer, locktime);
 
     // Append SIGHASH type
-    signing_data.push_back(sighash_type);
+    SerializeUint8(writer, sighash_type);
 
     // Hash the signing data
-    return SHA3::Hash(signing_data);
+    return writer.GetHash();
 }
 
 Result<void> Transaction::Sign(const SecretKey& secret_key, uint8_t sighash_type, const Script& prev_scriptpubkey) {
@@ -296,7 +262,7 @@ Result<void> Transaction::VerifySignature(const PublicKey& public_key, uint8_t s
     uint256 hash = GetHashForSigning(sighash_type, 0, prev_scriptpubkey);
 
     // Verify the signature using Dilithium3
-    auto verify_result = DilithiumCrypto::VerifyHash(hash, signature, public_key);
+    auto verify_result = DilithiumCrypto::VerifyHashCached(hash, signature, public_key);
     if (!verify_result.IsOk()) {
         return Result<void>::Error("Signature verification failed: " + verify_result.error);
     }
@@ -361,148 +327,163 @@ uint64_t Transaction::GetFee(const UTXOSet& utxo_set) const {
 
 std::vector<uint8_t> Transaction::Serialize() const {
     std::vector<uint8_t> result;
-    SerializeUint32(result, version);
-    SerializeUint64(result, inputs.size());
-    for (const auto& input : inputs) {
-        auto input_bytes = input.Serialize();
-        result.insert(result.end(), input_bytes.begin(), input_bytes.end());
-    }
-    SerializeUint64(result, outputs.size());
-    for (const auto& output : outputs) {
-        auto output_bytes = output.Serialize();
-        result.insert(result.end(), output_bytes.begin(), output_bytes.end());
-    }
-    SerializeUint64(result, locktime);
-    // Serialize signature (convert std::array to bytes)
-    result.insert(result.end(), signature.begin(), signature.end());
+    result.reserve(GetSerializedSize());
+    VectorWriter writer(result);
+    Serialize(writer);
     return result;
 }
 
 Result<Transaction> Transaction::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
+    SpanReader reader(data);
     Transaction tx;
-
-    // Deserialize version (4 bytes)
-    auto version_result = DeserializeUint32(data, pos);
-    if (version_result.IsError()) {
-        return Result<Transaction>::Error("Failed to deserialize version: " + version_result.error);
+    auto result = tx.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<Transaction>::Error(result.error);
     }
-    tx.version = *version_result.value;
+    return Result<Transaction>::Ok(std::move(tx));
+}
 
-    // Deserialize inputs count (8 bytes)
-    auto inputs_count_result = DeserializeUint64(data, pos);
-    if (inputs_count_result.IsError()) {
-        return Result<Transaction>::Error("Failed to deserialize inputs count: " + inputs_count_result.error);
+size_t Transaction::GetSerializedSize() const {
+    size_t size = 4 + 8 + 8 + 8 + DILITHIUM3_BYTES;
+    for (const auto& input : inputs) {
+        size += input.GetSerializedSize();
     }
-    uint64_t inputs_count = *inputs_count_result.value;
-
-    // Deserialize each input
-    tx.inputs.reserve(inputs_count);
-    for (uint64_t i = 0; i < inputs_count; ++i) {
-        TxIn txin;
-
-        // Deserialize prev_tx_hash (32 bytes)
-        auto hash_result = DeserializeUint256(data, pos);
-        if (hash_result.IsError()) {
-            return Result<Transaction>::Error("Failed to deserialize input " + std::to_string(i) + " prev_tx_hash: " + hash_result.error);
-        }
-        txin.prev_tx_hash = *hash_result.value;
+    for (const auto& output : outputs) {
+        size += output.GetSerializedSize();
+    }
+    return size;
+}
 
-        // Deserialize prev_tx_index (4 bytes)
-        auto index_result = DeserializeUint32(data, pos);
-        if (index_result.IsError()) {
-            return Result<Transaction>::Error("Failed to deserialize input " + std::to_string(i) + " prev_tx_index: " + index_result.error);
-        }
-        txin.prev_tx_index = *index_result.value;
+// ============================================================================
+// Transaction View Implementation
+// ============================================================================
 
-        // Deserialize script_sig length (8 bytes)
-        auto script_len_result = DeserializeUint64(data, pos);
-        if (script_len_result.IsError()) {
-            return Result<Transaction>::Error("Failed to deserialize input " + std::to_string(i) + " script_sig length: " + script_len_result.error);
-        }
-        uint64_t script_len = *script_len_result.value;
+Result<void> TxInView::Unserialize(SpanReader& s) {
+    if (!UnserializeUint256(s, prev_tx_hash)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for prev_tx_hash");
+    }
+    if (!UnserializeUint32(s, prev_tx_index)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for prev_tx_index");
+    }
+    uint64_t script_len = 0;
+    if (!UnserializeUint64(s, script_len)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for script_sig length");
+    }
+    if (script_len > s.Remaining() || !s.ReadView(static_cast<size_t>(script_len), script_sig)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for script_sig");
+    }
+    if (!UnserializeUint32(s, sequence)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for sequence");
+    }
+    return Result<void>::Ok();
+}
 
-        // Deserialize script_sig bytes
-        if (pos + script_len > data.size()) {
-            return Result<Transaction>::Error("Buffer underflow: not enough bytes for input " + std::to_string(i) + " script_sig");
-        }
-        std::vector<uint8_t> script_bytes(data.begin() + pos, data.begin() + pos + script_len);
-        txin.script_sig = Script::Deserialize(script_bytes);
-        pos += script_len;
-
-        // Deserialize sequence (4 bytes)
-        auto seq_result = DeserializeUint32(data, pos);
-        if (seq_result.IsError()) {
-            return Result<Transaction>::Error("Failed to deserialize input " + std::to_string(i) + " sequence: " + seq_result.error);
-        }
-        txin.sequence = *seq_result.value;
+TxIn TxInView::ToTxIn() const {
+    TxIn input;
+    input.prev_tx_hash = prev_tx_hash;
+    input.prev_tx_index = prev_tx_index;
+    input.script_sig.bytes.assign(script_sig.begin(), script_sig.end());
+    input.sequence = sequence;
+    return input;
+}
 
-        tx.inputs.push_back(std::move(txin));
+Result<void> TxOutView::Unserialize(SpanReader& s) {
+    if (!UnserializeUint64(s, value)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for value");
     }
-
-    // Deserialize outputs count (8 bytes)
-    auto outputs_count_result = DeserializeUint64(data, pos);
-    if (outputs_count_result.IsError()) {
-        return Result<Transaction>::Error("Failed to deserialize outputs count: " + outputs_count_result.error);
+    uint64_t script_len = 0;
+    if (!UnserializeUint64(s, script_len)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for script_pubkey length");
+    }
+    if (script_len > s.Remaining() || !s.ReadView(static_cast<size_t>(script_len), script_pubkey)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for script_pubkey");
     }
-    uint64_t outputs_count = *outputs_count_result.value;
+    return Result<void>::Ok();
+}
 
-    // Deserialize each output
-    tx.outputs.reserve(outputs_count);
-    for (uint64_t i = 0; i < outputs_count; ++i) {
-        TxOut txout;
+TxOut TxOutView::ToTxOut() const {
+    return TxOut(value, Script(std::vector<uint8_t>(script_pubkey.begin(), script_pubkey.end())));
+}
 
-        // Deserialize value (8 bytes)
-        auto value_result = DeserializeUint64(data, pos);
-        if (value_result.IsError()) {
-            return Result<Transaction>::Error("Failed to deserialize output " + std::to_string(i) + " value: " + value_result.error);
-        }
-        txout.value = *value_result.value;
+Result<void> TransactionView::Unserialize(SpanReader& s) {
+    cached_hash_.reset();
+    const size_t begin = s.Position();
 
-        // Deserialize script_pubkey length (8 bytes)
-        auto script_len_result = DeserializeUint64(data, pos);
-        if (script_len_result.IsError()) {
-            return Result<Transaction>::Error("Failed to deserialize output " + std::to_string(i) + " script_pubkey length: " + script_len_result.error);
-        }
-        uint64_t script_len = *script_len_result.value;
+    if (!UnserializeUint32(s, version)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for version");
+    }
 
-        // Deserialize script_pubkey bytes
-        if (pos + script_len > data.size()) {
-            return Result<Transaction>::Error("Buffer underflow: not enough bytes for output " + std::to_string(i) + " script_pubkey");
+    uint64_t inputs_count = 0;
+    if (!UnserializeUint64(s, inputs_count)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for inputs count");
+    }
+    inputs.clear();
+    inputs.reserve(BoundedReserve(s, inputs_count, Transaction::MIN_TXIN_SIZE));
+    for (uint64_t i = 0; i < inputs_count; ++i) {
+        auto result = inputs.emplace_back().Unserialize(s);
+        if (result.IsError()) {
+            return Result<void>::Error("Failed to deserialize input " + std::to_string(i) + ": " + result.error);
         }
-        std::vector<uint8_t> script_bytes(data.begin() + pos, data.begin() + pos + script_len);
-        txout.script_pubkey = Script::Deserialize(script_bytes);
-        pos += script_len;
+    }
 
-        tx.outputs.push_back(std::move(txout));
+    uint64_t outputs_count = 0;
+    if (!UnserializeUint64(s, outputs_count)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for outputs count");
+    }
+    outputs.clear();
+    outputs.reserve(BoundedReserve(s, outputs_count, Transaction::MIN_TXOUT_SIZE));
+    for (uint64_t i = 0; i < outputs_count; ++i) {
+        auto result = outputs.emplace_back().Unserialize(s);
+        if (result.IsError()) {
+            return Result<void>::Error("Failed to deserialize output " + std::to_string(i) + ": " + result.error);
+        }
     }
 
-    // Deserialize locktime (8 bytes)
-    auto locktime_result = DeserializeUint64(data, pos);
-    if (locktime_result.IsError()) {
-        return Result<Transaction>::Error("Failed to deserialize locktime: " + locktime_result.error);
+    if (!UnserializeUint64(s, locktime)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for locktime");
+    }
+    if (!s.ReadView(DILITHIUM3_BYTES, signature)) {
+        return Result<void>::Error("Buffer underflow: not enough bytes for signature");
     }
-    tx.locktime = *locktime_result.value;
 
-    // Deserialize signature (DILITHIUM3_BYTES = 3293 bytes)
-    if (pos + DILITHIUM3_BYTES > data.size()) {
-        return Result<Transaction>::Error("Buffer underflow: not enough bytes for signature");
+    serialized_ = s.ConsumedSince(begin);
+    return Result<void>::Ok();
+}
+
+uint256 TransactionView::GetHash() const {
+    if (cached_hash_.has_value()) {
+        return *cached_hash_;
     }
-    std::copy(data.begin() + pos, data.begin() + pos + DILITHIUM3_BYTES, tx.signature.begin());
-    pos += DILITHIUM3_BYTES;
 
-    return Result<Transaction>::Ok(std::move(tx));
+    // The wire encoding is what Transaction::GetHash serializes, so the
+    // bytes can be hashed as they are
+    uint256 hash = SHA3::Hash(serialized_.data(), serialized_.size());
+    cached_hash_ = hash;
+    return hash;
 }
 
-size_t Transaction::GetSerializedSize() const {
-    size_t size = 4 + 8 + 8 + 8 + DILITHIUM3_BYTES;
+bool TransactionView::IsCoinbase() const {
+    if (inputs.size() != 1) return false;
+    // Check if prev_tx_hash is all zeros
+    return std::all_of(inputs[0].prev_tx_hash.begin(), inputs[0].prev_tx_hash.end(),
+                      [](uint8_t b) { return b == 0; });
+}
+
+Transaction TransactionView::ToTransaction() const {
+    Transaction tx;
+    tx.version = version;
+    tx.inputs.reserve(inputs.size());
     for (const auto& input : inputs) {
-        size += input.GetSerializedSize();
+        tx.inputs.push_back(input.ToTxIn());
     }
+    tx.outputs.reserve(outputs.size());
     for (const auto& output : outputs) {
-        size += output.GetSerializedSize();
+        tx.outputs.push_back(output.ToTxOut());
     }
-    return size;
+    tx.locktime = locktime;
+    std::copy(signature.begin(), signature.end(), tx.signature.begin());
+    tx.cached_hash_ = cached_hash_;
+    return tx;
 }
 
 // ============================================================================
@@ -7,6 +7,7 @@
 #include "intcoin/consensus.h"
 #include "intcoin/util.h"
 #include "intcoin/contracts/validator.h"
+#include "intcoin/ibd/check_queue.h"
 #include <algorithm>
 #include <set>
 
@@ -96,13 +97,25 @@ Result<void> BlockValidator::ValidateTransactions(const Block& block) const {
         }
     }
 
-    // Validate each transaction
+    // Validate each transaction; input script checks (the Dilithium work)
+    // are collected and run in parallel once the cheap checks have passed
     TxValidator tx_validator(chain_);
+    std::vector<ibd::ScriptCheck> script_checks;
     for (size_t i = 0; i < block.transactions.size(); i++) {
-        auto result = tx_validator.Validate(block.transactions[i]);
+        size_t first_check = script_checks.size();
+        auto result = tx_validator.Validate(block.transactions[i], &script_checks);
         if (result.IsError()) {
             return Result<void>::Error("Transaction " + std::to_string(i) + " invalid: " + result.error);
         }
+        for (size_t c = first_check; c < script_checks.size(); c++) {
+            script_checks[c].tx_index = i;
+        }
+    }
+
+    ibd::ScriptCheckQueue& queue = check_queue_ ? *check_queue_ : ibd::ScriptCheckQueue::Global();
+    auto scripts_result = queue.RunChecks(script_checks);
+    if (scripts_result.IsError()) {
+        return scripts_result;
     }
 
     // Validate coinbase reward
@@ -165,8 +178,8 @@ Result<void> BlockValidator::ValidateProofOfWork(const BlockHeader& header) cons
         return Result<void>::Error("Proof of work failed");
     }
 
-    // Validate RandomX hash (ASIC-resistant mining)
-    auto randomx_result = RandomXValidator::ValidateBlockHash(header);
+    // Validate RandomX hash (ASIC-resistant mining, served from PoW cache when seen before)
+    auto randomx_result = RandomXValidator::ValidateBlockHash(header, block_hash);
     if (randomx_result.IsError()) {
         return Result<void>::Error("RandomX validation failed: " + randomx_result.error);
     }
@@ -228,6 +241,11 @@ TxValidator::TxValidator(const Blockchain& chain)
     : chain_(chain) {}
 
 Result<void> TxValidator::Validate(const Transaction& tx) const {
+    return Validate(tx, nullptr);
+}
+
+Result<void> TxValidator::Validate(const Transaction& tx,
+                                   std::vector<ibd::ScriptCheck>* deferred_checks) const {
     // Handle contract transactions separately
     if (tx.IsContractTransaction()) {
         contracts::ContractTxValidator contract_validator(chain_);
@@ -246,7 +264,7 @@ Result<void> TxValidator::Validate(const Transaction& tx) const {
     }
 
     // 2. Validate inputs
-    auto inputs_result = ValidateInputs(tx);
+    auto inputs_result = ValidateInputs(tx, deferred_checks);
     if (inputs_result.IsError()) {
         return inputs_result;
     }
@@ -329,10 +347,18 @@ Result<void> TxValidator::ValidateStructure(const Transaction& tx) const {
 }
 
 Result<void> TxValidator::ValidateInputs(const Transaction& tx) const {
+    return ValidateInputs(tx, nullptr);
+}
+
+Result<void> TxValidator::ValidateInputs(const Transaction& tx,
+                                         std::vector<ibd::ScriptCheck>* deferred_checks) const {
     if (tx.IsCoinbase()) {
         return Result<void>::Ok();
     }
 
+    // Signature hash data shared by every input's checks
+    auto txdata = std::make_shared<const PrecomputedTxData>(tx);
+
     // Validate each input
     for (size_t i = 0; i < tx.inputs.size(); i++) {
         const auto& input = tx.inputs[i];
@@ -347,8 +373,19 @@ Result<void> TxValidator::ValidateInputs(const Transaction& tx) const {
             return Result<void>::Error("Input " + std::to_string(i) + " references non-existent UTXO");
         }
 
+        // Defer script execution to the caller's check queue if requested
+        if (deferred_checks) {
+            ibd::ScriptCheck check;
+            check.tx = &tx;
+            check.input_index = i;
+            check.script_pubkey = std::move(utxo->script_pubkey);
+            check.txdata = txdata;
+            deferred_checks->push_back(std::move(check));
+            continue;
+        }
+
         // Validate script_sig against script_pubkey
-        auto script_result = ExecuteScript(input.script_sig, utxo->script_pubkey, tx, i);
+        auto script_result = ExecuteScript(input.script_sig, utxo->script_pubkey, tx, i, txdata.get());
         if (!script_result.success) {
             return Result<void>::Error("Input " + std::to_string(i) + " script validation failed: " +
                                       script_result.error);
@@ -11,9 +11,11 @@
 
 namespace intcoin {
 
+namespace {
+
 // MurmurHash3 implementation (32-bit) for bloom filters
 // Based on Austin Appleby's MurmurHash3 public domain implementation
-uint32_t BloomFilter::MurmurHash3(uint32_t seed, const std::vector<uint8_t>& data) {
+uint32_t MurmurHash3Span(uint32_t seed, std::span<const uint8_t> data) {
     uint32_t h = seed;
     const uint32_t c1 = 0xcc9e2d51;
     const uint32_t c2 = 0x1b873593;
@@ -64,6 +66,12 @@ uint32_t BloomFilter::MurmurHash3(uint32_t seed, const std::vector<uint8_t>& dat
     return h;
 }
 
+} // namespace
+
+uint32_t BloomFilter::MurmurHash3(uint32_t seed, const std::vector<uint8_t>& data) {
+    return MurmurHash3Span(seed, data);
+}
+
 BloomFilter::BloomFilter(uint32_t elements, double fp_rate, uint32_t tweak, BloomFlags flags)
     : tweak_(tweak), flags_(flags), is_empty_(true), is_full_(false) {
 
@@ -376,4 +384,85 @@ uint32_t BloomFilter::Hash(uint32_t hash_num, const std::vector<uint8_t>& data)
     return hash % (filter_.size() * 8);
 }
 
+// ============================================================================
+// RollingBloomFilter
+// ============================================================================
+
+RollingBloomFilter::RollingBloomFilter(uint32_t elements, double fp_rate) {
+    // k = log2(1/p) hash functions; three half-size generations are live
+    // at most, so size the filter for 1.5x elements
+    double log_fp_rate = std::log(fp_rate);
+    hash_funcs_ = std::max(1, std::min(static_cast<int>(std::round(log_fp_rate / std::log(0.5))),
+                                       static_cast<int>(BloomFilter::MAX_HASH_FUNCS)));
+    entries_per_generation_ = std::max<uint32_t>((elements + 1) / 2, 1);
+    uint32_t max_elements = entries_per_generation_ * 3;
+
+    // m = -k * n / ln(1 - p^(1/k))
+    uint64_t filter_bits = static_cast<uint64_t>(std::ceil(
+        -1.0 * hash_funcs_ * max_elements / std::log(1.0 - std::exp(log_fp_rate / hash_funcs_))));
+    data_.resize(((filter_bits + 63) / 64) * 2);
+
+    Reset();
+}
+
+void RollingBloomFilter::CellFor(uint32_t hash_num, std::span<const uint8_t> data,
+                                 size_t& pos, uint32_t& bit) const {
+    uint32_t h = MurmurHash3Span(hash_num * 0xFBA4C795 + tweak_, data);
+    bit = h & 0x3F;
+    // Map onto the word pairs with the upper bits (the low 6 chose the bit)
+    pos = static_cast<size_t>((static_cast<uint64_t>(h) * (data_.size() / 2)) >> 32) * 2;
+}
+
+void RollingBloomFilter::Insert(std::span<const uint8_t> data) {
+    if (entries_this_generation_ == entries_per_generation_) {
+        entries_this_generation_ = 0;
+        generation_++;
+        if (generation_ == 4) {
+            generation_ = 1;
+        }
+
+        // Wipe every cell holding the generation we are about to reuse
+        uint64_t mask_low = 0 - static_cast<uint64_t>(generation_ & 1);
+        uint64_t mask_high = 0 - static_cast<uint64_t>(generation_ >> 1);
+        for (size_t p = 0; p < data_.size(); p += 2) {
+            uint64_t low = data_[p];
+            uint64_t high = data_[p + 1];
+            uint64_t keep = (low ^ mask_low) | (high ^ mask_high);
+            data_[p] = low & keep;
+            data_[p + 1] = high & keep;
+        }
+    }
+    entries_this_generation_++;
+
+    for (uint32_t i = 0; i < hash_funcs_; i++) {
+        size_t pos;
+        uint32_t bit;
+        CellFor(i, data, pos, bit);
+        data_[pos] = (data_[pos] & ~(uint64_t{1} << bit)) |
+                     (static_cast<uint64_t>(generation_ & 1) << bit);
+        data_[pos + 1] = (data_[pos + 1] & ~(uint64_t{1} << bit)) |
+                         (static_cast<uint64_t>(generation_ >> 1) << bit);
+    }
+}
+
+bool RollingBloomFilter::Contains(std::span<const uint8_t> data) const {
+    for (uint32_t i = 0; i < hash_funcs_; i++) {
+        size_t pos;
+        uint32_t bit;
+        CellFor(i, data, pos, bit);
+        // A cell is set if it holds any generation
+        if (!(((data_[pos] | data_[pos + 1]) >> bit) & 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void RollingBloomFilter::Reset() {
+    tweak_ = static_cast<uint32_t>(GetRandomUint64());
+    entries_this_generation_ = 0;
+    generation_ = 1;
+    std::fill(data_.begin(), data_.end(), 0);
+}
+
 }  // namespace intcoin
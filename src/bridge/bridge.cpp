@@ -9,8 +9,6 @@
 #include <mutex>
 #include <algorithm>
 #include <ctime>
-#include <sstream>
-#include <iomanip>
 
 namespace intcoin {
 namespace bridge {
@@ -75,21 +73,6 @@ struct INTcoinBridge::Impl {
 
     Impl() : is_initialized(false) {}
 
-    // Helper: Convert bytes to hex
-    std::string BytesToHex(const std::vector<uint8_t>& bytes) {
-        std::ostringstream oss;
-        oss << std::hex << std::setfill('0');
-        for (uint8_t byte : bytes) {
-            oss << std::setw(2) << static_cast<int>(byte);
-        }
-        return oss.str();
-    }
-
-    // Helper: Convert uint256 to hex
-    std::string Uint256ToHex(const uint256& hash) {
-        return BytesToHex(std::vector<uint8_t>(hash.begin(), hash.end()));
-    }
-
     // Helper: Generate unique ID
     uint256 GenerateID() {
         std::vector<uint8_t> random_data(32);
@@ -176,7 +159,7 @@ Result<uint256> INTcoinBridge::SubmitDepositProof(const DepositProof& proof) {
     uint256 proof_id = impl_->GenerateID();
 
     // Store deposit proof
-    impl_->deposit_proofs[impl_->Uint256ToHex(proof_id)] = proof;
+    impl_->deposit_proofs[Uint256ToHex(proof_id)] = proof;
 
     // Trigger callback
     if (impl_->deposit_callback) {
@@ -197,7 +180,7 @@ Result<bool> INTcoinBridge::VerifyDepositProof(const DepositProof& proof) {
 
     // Verify all signatures are from active validators
     for (const auto& sig : proof.validator_signatures) {
-        std::string pubkey_hex = impl_->BytesToHex(sig);
+        std::string pubkey_hex = BytesToHex(sig);
         if (impl_->validators.find(pubkey_hex) == impl_->validators.end()) {
             return Result<bool>::Error("Invalid validator signature");
         }
@@ -222,7 +205,7 @@ Result<void> INTcoinBridge::MintWrappedTokens(
     }
 
     // Verify proof exists
-    std::string proof_hex = impl_->Uint256ToHex(proof_id);
+    std::string proof_hex = Uint256ToHex(proof_id);
     if (impl_->deposit_proofs.find(proof_hex) == impl_->deposit_proofs.end()) {
         return Result<void>::Error("Deposit proof not found");
     }
@@ -233,7 +216,7 @@ Result<void> INTcoinBridge::MintWrappedTokens(
     }
 
     // Mint tokens (increase balance)
-    std::string address_hex = impl_->BytesToHex(recipient);
+    std::string address_hex = BytesToHex(recipient);
     if (impl_->balances.find(address_hex) == impl_->balances.end()) {
         impl_->balances[address_hex] = {};
     }
@@ -275,7 +258,7 @@ Result<uint256> INTcoinBridge::RequestWithdrawal(
     std::vector<uint8_t> requester_address = requester_signature; // Placeholder
 
     // Check balance
-    std::string address_hex = impl_->BytesToHex(requester_address);
+    std::string address_hex = BytesToHex(requester_address);
     if (impl_->balances.find(address_hex) == impl_->balances.end() ||
         impl_->balances[address_hex].find(token.symbol) == impl_->balances[address_hex].end()) {
         return Result<uint256>::Error("Insufficient balance");
@@ -303,7 +286,7 @@ Result<uint256> INTcoinBridge::RequestWithdrawal(
     impl_->wrapped_tokens[token.symbol].total_supply -= amount;
 
     // Store withdrawal request
-    impl_->withdrawals[impl_->Uint256ToHex(request.withdrawal_id)] = request;
+    impl_->withdrawals[Uint256ToHex(request.withdrawal_id)] = request;
 
     // Trigger callback
     if (impl_->withdrawal_callback) {
@@ -327,7 +310,7 @@ Result<void> INTcoinBridge::SignWithdrawal(
     }
 
     // Get withdrawal request
-    std::string withdrawal_hex = impl_->Uint256ToHex(withdrawal_id);
+    std::string withdrawal_hex = Uint256ToHex(withdrawal_id);
     if (impl_->withdrawals.find(withdrawal_hex) == impl_->withdrawals.end()) {
         return Result<void>::Error("Withdrawal not found");
     }
@@ -359,7 +342,7 @@ Result<uint256> INTcoinBridge::ExecuteWithdrawal(const uint256& withdrawal_id) {
     }
 
     // Get withdrawal request
-    std::string withdrawal_hex = impl_->Uint256ToHex(withdrawal_id);
+    std::string withdrawal_hex = Uint256ToHex(withdrawal_id);
     if (impl_->withdrawals.find(withdrawal_hex) == impl_->withdrawals.end()) {
         return Result<uint256>::Error("Withdrawal not found");
     }
@@ -397,7 +380,7 @@ Result<uint256> INTcoinBridge::ExecuteWithdrawal(const uint256& withdrawal_id) {
 Result<WithdrawalRequest> INTcoinBridge::GetWithdrawal(const uint256& withdrawal_id) {
     std::lock_guard<std::mutex> lock(impl_->mutex);
 
-    std::string withdrawal_hex = impl_->Uint256ToHex(withdrawal_id);
+    std::string withdrawal_hex = Uint256ToHex(withdrawal_id);
     if (impl_->withdrawals.find(withdrawal_hex) == impl_->withdrawals.end()) {
         return Result<WithdrawalRequest>::Error("Withdrawal not found");
     }
@@ -431,7 +414,7 @@ Result<uint64_t> INTcoinBridge::GetWrappedBalance(
 
     std::lock_guard<std::mutex> lock(impl_->mutex);
 
-    std::string address_hex = impl_->BytesToHex(address);
+    std::string address_hex = BytesToHex(address);
 
     if (impl_->balances.find(address_hex) == impl_->balances.end() ||
         impl_->balances[address_hex].find(token_symbol) == impl_->balances[address_hex].end()) {
@@ -469,7 +452,7 @@ Result<void> INTcoinBridge::AddValidator(const BridgeValidator& validator) {
         return Result<void>::Error("Bridge not initialized");
     }
 
-    std::string pubkey_hex = impl_->BytesToHex(validator.public_key);
+    std::string pubkey_hex = BytesToHex(validator.public_key);
 
     // Check if already exists
     if (impl_->validators.find(pubkey_hex) != impl_->validators.end()) {
@@ -496,7 +479,7 @@ Result<void> INTcoinBridge::RemoveValidator(const std::vector<uint8_t>& validato
         return Result<void>::Error("Bridge not initialized");
     }
 
-    std::string pubkey_hex = impl_->BytesToHex(validator_pubkey);
+    std::string pubkey_hex = BytesToHex(validator_pubkey);
 
     if (impl_->validators.find(pubkey_hex) == impl_->validators.end()) {
         return Result<void>::Error("Validator not found");
@@ -525,7 +508,7 @@ Result<std::vector<BridgeValidator>> INTcoinBridge::GetValidators() {
 Result<bool> INTcoinBridge::IsValidator(const std::vector<uint8_t>& pubkey) {
     std::lock_guard<std::mutex> lock(impl_->mutex);
 
-    std::string pubkey_hex = impl_->BytesToHex(pubkey);
+    std::string pubkey_hex = BytesToHex(pubkey);
     bool is_validator = impl_->validators.find(pubkey_hex) != impl_->validators.end();
 
     return Result<bool>::Ok(is_validator);
@@ -10,8 +10,6 @@
 #include <mutex>
 #include <algorithm>
 #include <ctime>
-#include <sstream>
-#include <iomanip>
 
 namespace intcoin {
 namespace bridge {
@@ -72,16 +70,6 @@ struct INTcoinBridgeMonitor::Impl {
     const double min_validator_uptime = 0.95;  // 95%
 
     Impl() : bridge(nullptr), is_initialized(false) {}
-
-    // Helper: Convert bytes to hex string
-    std::string BytesToHex(const std::vector<uint8_t>& bytes) {
-        std::ostringstream oss;
-        oss << std::hex << std::setfill('0');
-        for (uint8_t byte : bytes) {
-            oss << std::setw(2) << static_cast<int>(byte);
-        }
-        return oss.str();
-    }
 };
 
 INTcoinBridgeMonitor::INTcoinBridgeMonitor()
@@ -251,7 +239,7 @@ Result<bool> INTcoinBridgeMonitor::DetectAnomalies() {
         const ValidatorStats& stats = pair.second;
         if (stats.uptime_percentage < impl_->min_validator_uptime) {
             std::map<std::string, std::string> metadata;
-            metadata["validator"] = impl_->BytesToHex(stats.public_key).substr(0, 16);
+            metadata["validator"] = BytesToHex(stats.public_key).substr(0, 16);
             metadata["uptime"] = std::to_string(stats.uptime_percentage * 100.0) + "%";
             metadata["threshold"] = std::to_string(impl_->min_validator_uptime * 100.0) + "%";
 
@@ -429,7 +417,7 @@ Result<ValidatorStats> INTcoinBridgeMonitor::GetValidatorStatus(
         return Result<ValidatorStats>::Error("Monitor not initialized");
     }
 
-    std::string key = impl_->BytesToHex(validator_pubkey);
+    std::string key = BytesToHex(validator_pubkey);
     auto it = impl_->validator_stats.find(key);
 
     if (it == impl_->validator_stats.end()) {
@@ -450,7 +438,7 @@ void INTcoinBridgeMonitor::CheckValidatorActivity() {
         const ValidatorStats& stats = pair.second;
         if (stats.last_active < inactive_threshold) {
             std::map<std::string, std::string> metadata;
-            metadata["validator"] = impl_->BytesToHex(stats.public_key).substr(0, 16);
+            metadata["validator"] = BytesToHex(stats.public_key).substr(0, 16);
             metadata["last_active"] = std::to_string(stats.last_active);
             metadata["hours_inactive"] = std::to_string((now - stats.last_active) / 3600);
 
@@ -7,10 +7,16 @@
 #include "intcoin/blockchain.h"
 #include "intcoin/util.h"
 #include "intcoin/crypto.h"
+#include "intcoin/metrics.h"
+#include "intcoin/ibd/parallel_validation.h"
 #include <randomx.h>
 #include <mutex>
 #include <memory>
 #include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <atomic>
+#include <thread>
 
 namespace intcoin {
 
@@ -22,10 +28,25 @@ namespace {
     // Global RandomX resources
     randomx_cache* g_randomx_cache = nullptr;
     randomx_vm* g_randomx_vm = nullptr;
+    std::vector<randomx_vm*> g_randomx_vm_pool;  // Extra VMs for batch validation
+    randomx_flags g_randomx_flags = RANDOMX_FLAG_DEFAULT;
     uint256 g_current_key{};
     uint64_t g_current_epoch = 0;
     std::mutex g_randomx_mutex;
     bool g_randomx_initialized = false;
+
+    // Re-key the shared cache and rebind every VM to it: light-mode VMs
+    // compile their programs from the cache when it is set, so a VM that is
+    // not rebound keeps hashing with the previous key. Caller holds
+    // g_randomx_mutex.
+    void RekeyRandomX(const uint256& key) {
+        randomx_init_cache(g_randomx_cache, key.data(), key.size());
+        randomx_vm_set_cache(g_randomx_vm, g_randomx_cache);
+        for (randomx_vm* vm : g_randomx_vm_pool) {
+            randomx_vm_set_cache(vm, g_randomx_cache);
+        }
+        g_current_key = key;
+    }
 }
 
 // ============================================================================
@@ -73,67 +94,48 @@ uint64_t GetNextHalvingHeight(uint64_t height) {
 // Difficulty Adjustment (Digishield V3)
 // ============================================================================
 
-uint256 DifficultyCalculator::CompactToTarget(uint32_t compact) {
-    // Compact format: 0xNNSSSSS
+arith_uint256 DifficultyCalculator::CompactToArith(uint32_t compact) {
+    // Compact format: 0xNNSSSSSS
     // NN = exponent (number of bytes)
     // SSSSSS = mantissa (3-byte coefficient)
-
+    //
+    // This is the consensus decoding and intentionally not Bitcoin's
+    // SetCompact(): for exponents below 3 the sign bit is tested after the
+    // mantissa has been shifted down, so it can never reject those targets.
     uint32_t exponent = compact >> 24;
     uint32_t mantissa = compact & 0x00FFFFFF;
 
-    uint256 target{};
-
-    // Check for valid exponent (must be 1-32)
+    arith_uint256 target;
     if (exponent <= 3) {
-        // For exponent ≤ 3, shift mantissa right
         mantissa >>= (8 * (3 - exponent));
-        if (mantissa > 0) {
-            target[0] = mantissa & 0xFF;
-            target[1] = (mantissa >> 8) & 0xFF;
-            target[2] = (mantissa >> 16) & 0xFF;
-        }
+        target = mantissa;
     } else if (exponent <= 32) {
-        // For exponent > 3, place mantissa at the appropriate position
-        int start_byte = exponent - 3;
-        if (start_byte + 2 < 32) {
-            target[start_byte] = mantissa & 0xFF;
-            target[start_byte + 1] = (mantissa >> 8) & 0xFF;
-            target[start_byte + 2] = (mantissa >> 16) & 0xFF;
-        }
+        target = arith_uint256(mantissa) << (8 * (exponent - 3));
     }
 
-    // Check for negative (should not happen in valid blocks)
+    // Sign bit set - invalid
     if (mantissa & 0x00800000) {
-        // Sign bit set - invalid
-        return uint256{};
+        return arith_uint256();
     }
-
     return target;
 }
 
-uint32_t DifficultyCalculator::TargetToCompact(const uint256& target) {
-    // Find the most significant non-zero byte
-    int size = 32;
-    while (size > 0 && target[size - 1] == 0) {
-        size--;
-    }
+uint256 DifficultyCalculator::CompactToTarget(uint32_t compact) {
+    return ArithToUint256(CompactToArith(compact));
+}
 
+uint32_t DifficultyCalculator::TargetToCompact(const uint256& target) {
+    arith_uint256 value = UintToArith256(target);
+    uint32_t size = static_cast<uint32_t>(value.bits() + 7) / 8;
     if (size == 0) {
         return 0;
     }
 
-    // Extract 3-byte mantissa
-    uint32_t mantissa = 0;
-    if (size >= 3) {
-        mantissa = target[size - 1];
-        mantissa = (mantissa << 8) | target[size - 2];
-        mantissa = (mantissa << 8) | target[size - 3];
-    } else if (size == 2) {
-        mantissa = target[size - 1];
-        mantissa = (mantissa << 8) | target[size - 2];
-    } else {
-        mantissa = target[0];
-    }
+    // Top three bytes; shorter targets keep their value unshifted, as the
+    // original encoder did (unreachable past the difficulty clamp)
+    uint32_t mantissa = size >= 3
+        ? static_cast<uint32_t>((value >> (8 * (size - 3))).GetLow64())
+        : static_cast<uint32_t>(value.GetLow64());
 
     // Check if we need to adjust for sign bit
     if (mantissa & 0x00800000) {
@@ -141,60 +143,41 @@ uint32_t DifficultyCalculator::TargetToCompact(const uint256& target) {
         size++;
     }
 
-    uint32_t compact = (size << 24) | mantissa;
-    return compact;
+    return (size << 24) | mantissa;
+}
+
+arith_uint256 DifficultyCalculator::GetBlockWork(uint32_t bits) {
+    arith_uint256 target = CompactToArith(bits);
+    if (target.IsZero()) {
+        return arith_uint256();
+    }
+    // 2^256 / (target + 1) doesn't fit in 256 bits, but it equals
+    // (2^256 - target - 1) / (target + 1) + 1 = ~target / (target + 1) + 1
+    arith_uint256 work = ~target / (target + 1);
+    ++work;
+    return work;
 }
 
 bool DifficultyCalculator::CheckProofOfWork(const uint256& hash, uint32_t bits) {
-    uint256 target = CompactToTarget(bits);
+    arith_uint256 target = CompactToArith(bits);
 
     // Check target is non-zero
-    bool is_zero = true;
-    for (size_t i = 0; i < 32; i++) {
-        if (target[i] != 0) {
-            is_zero = false;
-            break;
-        }
-    }
-    if (is_zero) {
+    if (target.IsZero()) {
         return false;
     }
 
-    // Check hash < target (little-endian comparison)
-    for (int i = 31; i >= 0; i--) {
-        if (hash[i] < target[i]) {
-            return true;
-        } else if (hash[i] > target[i]) {
-            return false;
-        }
-    }
-
-    // hash == target (should still pass)
-    return true;
+    // hash <= target
+    return UintToArith256(hash) <= target;
 }
 
 double DifficultyCalculator::GetDifficulty(uint32_t bits) {
     // Difficulty = max_target / current_target
     // max_target is the genesis block target (minimum difficulty)
-
-    uint256 max_target = CompactToTarget(consensus::MIN_DIFFICULTY_BITS);
-    uint256 current_target = CompactToTarget(bits);
-
-    // Calculate difficulty as a double
-    // For simplicity, we use the first 8 bytes of the target
-    uint64_t max_val = 0;
-    uint64_t current_val = 0;
-
-    for (int i = 0; i < 8 && i < 32; i++) {
-        max_val = (max_val << 8) | max_target[31 - i];
-        current_val = (current_val << 8) | current_target[31 - i];
-    }
-
-    if (current_val == 0) {
+    arith_uint256 current_target = CompactToArith(bits);
+    if (current_target.IsZero()) {
         return 0.0;
     }
-
-    return static_cast<double>(max_val) / static_cast<double>(current_val);
+    return consensus::POW_LIMIT.getdouble() / current_target.getdouble();
 }
 
 uint32_t DifficultyCalculator::GetNextWorkRequired(const BlockHeader& last_block,
@@ -233,83 +216,43 @@ uint32_t DifficultyCalculator::GetNextWorkRequired(const BlockHeader& last_block
     uint64_t max_timespan = expected_timespan * DAMPING_FACTOR;
     actual_timespan = std::max(min_timespan, std::min(actual_timespan, max_timespan));
 
-    // Calculate average target from last N blocks
-    uint256 total_target{};
+    // Average target over the window (the sum wraps modulo 2^256)
+    arith_uint256 avg_target;
     for (const auto& block : blocks) {
-        uint256 block_target = CompactToTarget(block.bits);
-
-        // Add to total (with overflow protection)
-        bool overflow = false;
-        for (int i = 0; i < 32; i++) {
-            uint16_t sum = total_target[i] + block_target[i];
-            if (i > 0 && overflow) {
-                sum++;
-            }
-            total_target[i] = sum & 0xFF;
-            overflow = (sum > 0xFF);
-        }
-    }
-
-    // Divide by AVERAGING_WINDOW to get average
-    uint256 avg_target{};
-    uint16_t remainder = 0;
-    for (int i = 31; i >= 0; i--) {
-        uint16_t value = (remainder << 8) | total_target[i];
-        avg_target[i] = value / AVERAGING_WINDOW;
-        remainder = value % AVERAGING_WINDOW;
+        avg_target += CompactToArith(block.bits);
     }
+    avg_target.DivMod64(AVERAGING_WINDOW);
 
-    // Adjust target based on actual vs expected timespan
-    // new_target = avg_target * actual_timespan / expected_timespan
-    uint256 new_target{};
+    // Adjust target based on actual vs expected timespan.
+    // Consensus-critical: this byte-wise pass is what every node has always
+    // computed. It is not avg_target * actual / expected, but block headers
+    // must carry exactly its result, so it can only be replaced together
+    // with an activation height.
+    const uint256 avg_bytes = ArithToUint256(avg_target);
+    uint256 new_bytes{};
     uint64_t carry = 0;
     for (int i = 0; i < 32; i++) {
-        uint64_t product = (uint64_t)avg_target[i] * actual_timespan + carry;
+        uint64_t product = (uint64_t)avg_bytes[i] * actual_timespan + carry;
         carry = product / expected_timespan;
-        new_target[i] = product % expected_timespan;
+        new_bytes[i] = product % expected_timespan;
     }
 
     // If there's still a carry, we're at maximum difficulty
     if (carry > 0) {
         // Saturate at maximum value
-        for (int i = 0; i < 32; i++) {
-            new_target[i] = 0xFF;
-        }
+        new_bytes.fill(0xFF);
     }
+    arith_uint256 new_target = UintToArith256(new_bytes);
 
     // Enforce minimum and maximum difficulty bounds
-    uint256 min_target = CompactToTarget(consensus::MAX_DIFFICULTY_BITS);
-    uint256 max_target = CompactToTarget(consensus::MIN_DIFFICULTY_BITS);
-
-    // Check if new_target < min_target (too difficult)
-    bool below_min = false;
-    for (int i = 31; i >= 0; i--) {
-        if (new_target[i] < min_target[i]) {
-            below_min = true;
-            break;
-        } else if (new_target[i] > min_target[i]) {
-            break;
-        }
+    if (new_target < consensus::MIN_POW_TARGET) {
+        new_target = consensus::MIN_POW_TARGET;
     }
-    if (below_min) {
-        new_target = min_target;
+    if (new_target > consensus::POW_LIMIT) {
+        new_target = consensus::POW_LIMIT;
     }
 
-    // Check if new_target > max_target (too easy)
-    bool above_max = false;
-    for (int i = 31; i >= 0; i--) {
-        if (new_target[i] > max_target[i]) {
-            above_max = true;
-            break;
-        } else if (new_target[i] < max_target[i]) {
-            break;
-        }
-    }
-    if (above_max) {
-        new_target = max_target;
-    }
-
-    return TargetToCompact(new_target);
+    return TargetToCompact(ArithToUint256(new_target));
 }
 
 // ============================================================================
@@ -342,6 +285,7 @@ Result<void> RandomXValidator::Initialize() {
     g_current_epoch = 0;
 
     // Create VM
+    g_randomx_flags = flags;
     g_randomx_vm = randomx_create_vm(flags, g_randomx_cache, nullptr);
     if (!g_randomx_vm) {
         randomx_release_cache(g_randomx_cache);
@@ -365,6 +309,11 @@ void RandomXValidator::Shutdown() {
         g_randomx_vm = nullptr;
     }
 
+    for (randomx_vm* vm : g_randomx_vm_pool) {
+        randomx_destroy_vm(vm);
+    }
+    g_randomx_vm_pool.clear();
+
     if (g_randomx_cache) {
         randomx_release_cache(g_randomx_cache);
         g_randomx_cache = nullptr;
@@ -374,19 +323,36 @@ void RandomXValidator::Shutdown() {
 }
 
 Result<void> RandomXValidator::ValidateBlockHash(const BlockHeader& header) {
-    // Calculate RandomX hash for the header
-    auto hash_result = CalculateHash(header);
-    if (hash_result.IsError()) {
-        return Result<void>::Error("Failed to calculate RandomX hash: " + hash_result.error);
-    }
+    return ValidateBlockHash(header, header.GetHash());
+}
 
-    uint256 calculated_hash = *hash_result.value;
+Result<void> RandomXValidator::ValidateBlockHash(const BlockHeader& header,
+                                                 const uint256& header_hash) {
+    PowCache& cache = PowCache::Instance();
+
+    // A header that was already verified does not need another RandomX evaluation
+    uint256 calculated_hash{};
+    auto cached = cache.Lookup(header_hash);
+    if (cached) {
+        calculated_hash = *cached;
+    } else {
+        // Calculate RandomX hash for the header
+        auto hash_result = CalculateHash(header);
+        if (hash_result.IsError()) {
+            return Result<void>::Error("Failed to calculate RandomX hash: " + hash_result.error);
+        }
+        calculated_hash = *hash_result.value;
+    }
 
     // Verify the hash meets the difficulty target
     if (!DifficultyCalculator::CheckProofOfWork(calculated_hash, header.bits)) {
         return Result<void>::Error("Block hash does not meet difficulty target");
     }
 
+    if (!cached) {
+        cache.Insert(header_hash, calculated_hash);
+    }
+
     return Result<void>::Ok();
 }
 
@@ -400,8 +366,7 @@ Result<uint256> RandomXValidator::CalculateHash(const BlockHeader& header) {
     // Check if we need to update the cache with the header's RandomX key
     if (header.randomx_key != g_current_key) {
         // Reinitialize cache with the new key
-        randomx_init_cache(g_randomx_cache, header.randomx_key.data(), header.randomx_key.size());
-        g_current_key = header.randomx_key;
+        RekeyRandomX(header.randomx_key);
     }
 
     // Serialize block header for hashing (excluding the randomx_hash field itself)
@@ -414,6 +379,134 @@ Result<uint256> RandomXValidator::CalculateHash(const BlockHeader& header) {
     return Result<uint256>::Ok(std::move(hash));
 }
 
+Result<void> RandomXValidator::ValidateHeaderBatch(const std::vector<BlockHeader>& headers,
+                                                   const std::vector<uint256>& header_hashes,
+                                                   size_t num_threads) {
+    if (headers.size() != header_hashes.size()) {
+        return Result<void>::Error("Header and hash count mismatch");
+    }
+
+    PowCache& cache = PowCache::Instance();
+    const size_t count = headers.size();
+
+    // Per-header state: 0 = pending, 1 = valid, 2 = invalid
+    std::vector<uint256> pow_hashes(count);
+    std::vector<uint8_t> status(count, 0);
+    std::vector<size_t> todo;
+    todo.reserve(count);
+
+    // Headers already verified (e.g. re-announced during sync overlap) skip RandomX
+    for (size_t i = 0; i < count; i++) {
+        auto cached = cache.Lookup(header_hashes[i]);
+        if (!cached) {
+            todo.push_back(i);
+            continue;
+        }
+        pow_hashes[i] = *cached;
+        if (!DifficultyCalculator::CheckProofOfWork(pow_hashes[i], headers[i].bits)) {
+            return Result<void>::Error("Header " + std::to_string(i) +
+                                       " does not meet difficulty target");
+        }
+        status[i] = 1;
+    }
+
+    if (todo.empty()) {
+        return Result<void>::Ok();
+    }
+
+    if (num_threads == 0) {
+        num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    std::atomic<bool> abort{false};
+    {
+        // The RandomX cache is shared read-only by all VMs while hashing, so
+        // single-header validation waits until the batch is done
+        std::lock_guard<std::mutex> lock(g_randomx_mutex);
+
+        if (!g_randomx_initialized) {
+            return Result<void>::Error("RandomX not initialized");
+        }
+
+        const size_t max_chunks = (todo.size() + HEADER_BATCH_CHUNK_SIZE - 1) / HEADER_BATCH_CHUNK_SIZE;
+        const size_t workers = std::min(num_threads, max_chunks);
+
+        // Grow the VM pool on demand (worker 0 uses the primary VM)
+        while (g_randomx_vm_pool.size() + 1 < workers) {
+            randomx_vm* vm = randomx_create_vm(g_randomx_flags, g_randomx_cache, nullptr);
+            if (!vm) {
+                break;
+            }
+            g_randomx_vm_pool.push_back(vm);
+        }
+        std::vector<randomx_vm*> vms{g_randomx_vm};
+        vms.insert(vms.end(), g_randomx_vm_pool.begin(),
+                   g_randomx_vm_pool.begin() + std::min(g_randomx_vm_pool.size(), workers - 1));
+
+        // Headers in one message nearly always share an epoch key; hash each
+        // run of equal keys in parallel, re-keying the cache between runs
+        size_t run_begin = 0;
+        while (run_begin < todo.size() && !abort.load()) {
+            const uint256& key = headers[todo[run_begin]].randomx_key;
+            size_t run_end = run_begin + 1;
+            while (run_end < todo.size() && headers[todo[run_end]].randomx_key == key) {
+                run_end++;
+            }
+
+            if (key != g_current_key) {
+                RekeyRandomX(key);
+            }
+
+            std::atomic<size_t> next_chunk{run_begin};
+            auto worker = [&](randomx_vm* vm) {
+                while (!abort.load(std::memory_order_relaxed)) {
+                    size_t begin = next_chunk.fetch_add(HEADER_BATCH_CHUNK_SIZE);
+                    if (begin >= run_end) {
+                        break;
+                    }
+                    size_t end = std::min(begin + HEADER_BATCH_CHUNK_SIZE, run_end);
+                    for (size_t t = begin; t < end && !abort.load(std::memory_order_relaxed); t++) {
+                        size_t i = todo[t];
+                        std::vector<uint8_t> header_data = headers[i].Serialize();
+                        randomx_calculate_hash(vm, header_data.data(), header_data.size(),
+                                               pow_hashes[i].data());
+                        if (DifficultyCalculator::CheckProofOfWork(pow_hashes[i], headers[i].bits)) {
+                            status[i] = 1;
+                        } else {
+                            status[i] = 2;
+                            abort.store(true);
+                        }
+                    }
+                }
+            };
+
+            // One item per VM so no two workers ever share one
+            ibd::GetSharedThreadPool().ParallelFor(vms.size(), [&](size_t w) {
+                worker(vms[w]);
+            });
+
+            run_begin = run_end;
+        }
+    }
+
+    // Merge in header order: the first failure rejects the whole batch
+    for (size_t i = 0; i < count; i++) {
+        if (status[i] == 2) {
+            return Result<void>::Error("Header " + std::to_string(i) +
+                                       " does not meet difficulty target");
+        }
+    }
+    if (abort.load()) {
+        return Result<void>::Error("Header batch validation aborted");
+    }
+
+    for (size_t i : todo) {
+        cache.Insert(header_hashes[i], pow_hashes[i]);
+    }
+
+    return Result<void>::Ok();
+}
+
 uint256 RandomXValidator::GetRandomXKey(uint64_t height) {
     // Calculate epoch number
     uint64_t epoch = height / RANDOMX_EPOCH_BLOCKS;
@@ -447,16 +540,123 @@ Result<void> RandomXValidator::UpdateDataset(uint64_t height) {
     // Get new key
     uint256 new_key = GetRandomXKey(height);
 
-    // Reinitialize cache with new key
-    randomx_init_cache(g_randomx_cache, new_key.data(), new_key.size());
-
-    // Note: VM automatically uses the updated cache
-    g_current_key = new_key;
+    // Reinitialize cache with new key and rebind the VMs to it
+    RekeyRandomX(new_key);
     g_current_epoch = new_epoch;
 
     return Result<void>::Ok();
 }
 
+// ============================================================================
+// PoW Result Cache
+// ============================================================================
+
+class PowCache::Impl {
+public:
+    using LruList = std::list<std::pair<uint256, uint256>>;
+
+    explicit Impl(size_t max_entries) : max_entries_(std::max<size_t>(1, max_entries)) {}
+
+    void EvictToCapacity() {
+        while (index_.size() > max_entries_) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+            stats_.evictions++;
+        }
+    }
+
+    size_t max_entries_;
+    LruList lru_;  // Most recently used at front
+    std::unordered_map<uint256, LruList::iterator, uint256_hash> index_;
+    Stats stats_;
+    mutable std::mutex mutex_;
+};
+
+PowCache& PowCache::Instance() {
+    static PowCache instance;
+    return instance;
+}
+
+PowCache::PowCache(size_t max_entries)
+    : impl_(std::make_unique<Impl>(max_entries)) {}
+
+PowCache::~PowCache() = default;
+
+std::optional<uint256> PowCache::Lookup(const uint256& header_hash) {
+    std::optional<uint256> result;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        auto it = impl_->index_.find(header_hash);
+        if (it != impl_->index_.end()) {
+            impl_->lru_.splice(impl_->lru_.begin(), impl_->lru_, it->second);
+            impl_->stats_.hits++;
+            result = it->second->second;
+        } else {
+            impl_->stats_.misses++;
+        }
+    }
+
+    if (result) {
+        metrics::pow_cache_hits.Inc();
+    } else {
+        metrics::pow_cache_misses.Inc();
+    }
+    return result;
+}
+
+void PowCache::Insert(const uint256& header_hash, const uint256& randomx_hash) {
+    size_t entries = 0;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        auto it = impl_->index_.find(header_hash);
+        if (it != impl_->index_.end()) {
+            it->second->second = randomx_hash;
+            impl_->lru_.splice(impl_->lru_.begin(), impl_->lru_, it->second);
+            return;
+        }
+
+        impl_->lru_.emplace_front(header_hash, randomx_hash);
+        impl_->index_.emplace(header_hash, impl_->lru_.begin());
+        impl_->stats_.insertions++;
+        impl_->EvictToCapacity();
+        entries = impl_->index_.size();
+    }
+    metrics::pow_cache_entries.Set(static_cast<double>(entries));
+}
+
+bool PowCache::Contains(const uint256& header_hash) const {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    return impl_->index_.count(header_hash) > 0;
+}
+
+void PowCache::SetMaxEntries(size_t max_entries) {
+    size_t entries = 0;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        impl_->max_entries_ = std::max<size_t>(1, max_entries);
+        impl_->EvictToCapacity();
+        entries = impl_->index_.size();
+    }
+    metrics::pow_cache_entries.Set(static_cast<double>(entries));
+}
+
+void PowCache::Clear() {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        impl_->lru_.clear();
+        impl_->index_.clear();
+    }
+    metrics::pow_cache_entries.Set(0);
+}
+
+PowCache::Stats PowCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    Stats stats = impl_->stats_;
+    stats.entries = impl_->index_.size();
+    stats.max_entries = impl_->max_entries_;
+    return stats;
+}
+
 // ============================================================================
 // Consensus Validation
 // ============================================================================
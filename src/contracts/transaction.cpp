@@ -236,7 +236,7 @@ bool ContractDeploymentTx::Sign(const SecretKey& secret_key) {
 
 bool ContractDeploymentTx::Verify() const {
     uint256 signing_hash = GetSigningHash();
-    auto result = DilithiumCrypto::VerifyHash(signing_hash, signature, from);
+    auto result = DilithiumCrypto::VerifyHashCached(signing_hash, signature, from);
     return result.IsOk();
 }
 
@@ -449,7 +449,7 @@ bool ContractCallTx::Sign(const SecretKey& secret_key) {
 
 bool ContractCallTx::Verify() const {
     uint256 signing_hash = GetSigningHash();
-    auto result = DilithiumCrypto::VerifyHash(signing_hash, signature, from);
+    auto result = DilithiumCrypto::VerifyHashCached(signing_hash, signature, from);
     return result.IsOk();
 }
 
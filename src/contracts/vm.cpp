@@ -3,10 +3,13 @@
 
 #include "intcoin/contracts/vm.h"
 #include "intcoin/crypto.h"
+#include "intcoin/codec.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <cstring>
+#include <span>
+#include <stdexcept>
 
 namespace intcoin {
 namespace contracts {
@@ -826,11 +829,8 @@ std::string IntSCVM::Disassemble(const std::vector<uint8_t>& bytecode) {
         // Show push data
         if (opcode >= Opcode::PUSH1 && opcode <= Opcode::PUSH32) {
             uint8_t num_bytes = static_cast<uint8_t>(opcode) - 0x5f;
-            ss << " 0x";
-            for (uint8_t i = 0; i < num_bytes && (pc + 1 + i) < bytecode.size(); ++i) {
-                ss << std::setw(2) << std::setfill('0') << std::hex
-                   << static_cast<int>(bytecode[pc + 1 + i]);
-            }
+            const size_t available = std::min<size_t>(num_bytes, bytecode.size() - pc - 1);
+            ss << " 0x" << codec::EncodeHex(std::span(bytecode).subspan(pc + 1, available));
             pc += num_bytes;
         }
 
@@ -870,24 +870,31 @@ Word256 StringToWord256(const std::string& str) {
 }
 
 std::string Word256ToHex(const Word256& word) {
-    std::stringstream ss;
-    ss << "0x";
-    for (uint8_t byte : word) {
-        ss << std::setw(2) << std::setfill('0') << std::hex << static_cast<int>(byte);
-    }
-    return ss.str();
+    std::string hex(2 + codec::HexEncodedSize(word.size()), '\0');
+    hex[0] = '0';
+    hex[1] = 'x';
+    codec::HexToChars(hex.data() + 2, hex.data() + hex.size(), word);
+    return hex;
 }
 
 Word256 HexToWord256(const std::string& hex) {
     Word256 word{};
-    std::string hex_str = hex;
-    if (hex_str.substr(0, 2) == "0x") {
-        hex_str = hex_str.substr(2);
+    std::string_view digits(hex);
+    if (digits.starts_with("0x")) {
+        digits.remove_prefix(2);
     }
-
-    for (size_t i = 0; i < hex_str.size() && i < 64; i += 2) {
-        std::string byte_str = hex_str.substr(i, 2);
-        word[i / 2] = std::stoi(byte_str, nullptr, 16);
+    digits = digits.substr(0, 64);
+
+    // Fills from the most significant byte; a trailing odd digit is one byte
+    const size_t full_bytes = digits.size() / 2;
+    bool ok = codec::DecodeHex(digits.substr(0, full_bytes * 2),
+                               std::span(word).first(full_bytes));
+    if (ok && digits.size() % 2 != 0) {
+        const char last[2] = {'0', digits.back()};
+        ok = codec::DecodeHex(std::string_view(last, 2), std::span(word).subspan(full_bytes, 1));
+    }
+    if (!ok) {
+        throw std::invalid_argument("Invalid hex string");
     }
 
     return word;
@@ -5,6 +5,10 @@
 
 #include "intcoin/crypto.h"
 #include "intcoin/util.h"
+#include "intcoin/codec.h"
+#include "intcoin/ibd/parallel_validation.h"
+#include "keccak.h"
+#include <cstdlib>
 #include <cstring>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
@@ -12,6 +16,13 @@
 #include <openssl/ripemd.h>
 #include <stdexcept>
 #include <oqs/oqs.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
 
 namespace intcoin {
 
@@ -31,8 +42,14 @@ namespace {
     // Uses SHA3-256 hash chain: output = SHA3(seed || counter)
     void deterministic_randombytes(uint8_t *random_array, size_t bytes_to_read) {
         if (!det_rng_state.active || det_rng_state.seed.empty()) {
-            // Fallback to system RNG if not properly initialized
-            // This shouldn't happen, but provides safety
+            // liboqs' RNG hook is process-wide and stays installed: every
+            // thread that isn't deriving an HD key right now lands here and
+            // must get real randomness, not an untouched buffer. The hook
+            // can't report failure, so stop rather than hand liboqs key
+            // material it never wrote (liboqs' own system RNG exits too).
+            if (RAND_bytes(random_array, static_cast<int>(bytes_to_read)) != 1) {
+                std::abort();
+            }
             return;
         }
 
@@ -56,6 +73,39 @@ namespace {
             det_rng_state.counter++;
         }
     }
+
+    // Route liboqs' randomness through deterministic_randombytes. Installed
+    // once and never switched back, so no thread can swap the hook out from
+    // under another one mid-keygen.
+    void InstallDeterministicRandombytes() {
+        static std::once_flag installed;
+        std::call_once(installed, [] {
+            OQS_randombytes_custom_algorithm(deterministic_randombytes);
+        });
+    }
+
+    struct OQSSigDeleter {
+        void operator()(OQS_SIG* sig) const { OQS_SIG_free(sig); }
+    };
+
+    // Per-thread ML-DSA-65 context, created on first use and reused by every
+    // keygen/sign/verify on that thread instead of OQS_SIG_new per call
+    OQS_SIG* GetThreadSigContext() {
+        thread_local std::unique_ptr<OQS_SIG, OQSSigDeleter> sig(
+            OQS_SIG_new(OQS_SIG_alg_ml_dsa_65));
+        return sig.get();
+    }
+
+    struct OQSKemDeleter {
+        void operator()(OQS_KEM* kem) const { OQS_KEM_free(kem); }
+    };
+
+    // Per-thread ML-KEM-768 context (same reuse as the signature context)
+    OQS_KEM* GetThreadKemContext() {
+        thread_local std::unique_ptr<OQS_KEM, OQSKemDeleter> kem(
+            OQS_KEM_new(OQS_KEM_alg_ml_kem_768));
+        return kem.get();
+    }
 }
 
 // ============================================================================
@@ -63,8 +113,8 @@ namespace {
 // ============================================================================
 
 Result<DilithiumCrypto::KeyPair> DilithiumCrypto::GenerateKeyPair() {
-    // Create ML-DSA-65 (Dilithium3) signature object
-    OQS_SIG *sig = OQS_SIG_new(OQS_SIG_alg_ml_dsa_65);
+    // Per-thread ML-DSA-65 (Dilithium3) signature object
+    OQS_SIG *sig = GetThreadSigContext();
     if (sig == nullptr) {
         return Result<KeyPair>::Error("Failed to create ML-DSA-65 signature object");
     }
@@ -76,12 +126,9 @@ Result<DilithiumCrypto::KeyPair> DilithiumCrypto::GenerateKeyPair() {
     // Generate keypair
     int rc = OQS_SIG_keypair(sig, public_key.data(), secret_key.data());
     if (rc != OQS_SUCCESS) {
-        OQS_SIG_free(sig);
         return Result<KeyPair>::Error("Failed to generate ML-DSA-65 keypair");
     }
 
-    OQS_SIG_free(sig);
-
     keypair.public_key = public_key;
     keypair.secret_key = secret_key;
 
@@ -99,16 +146,15 @@ Result<DilithiumCrypto::KeyPair> DilithiumCrypto::GenerateDeterministicKeyPair(
     det_rng_state.counter = 0;
     det_rng_state.active = true;
 
-    // Set custom RNG for liboqs
-    OQS_randombytes_custom_algorithm(deterministic_randombytes);
+    // Custom RNG for liboqs (reads this thread's state)
+    InstallDeterministicRandombytes();
 
-    // Create ML-DSA-65 (Dilithium3) signature object
-    OQS_SIG *sig = OQS_SIG_new(OQS_SIG_alg_ml_dsa_65);
+    // Per-thread ML-DSA-65 (Dilithium3) signature object
+    OQS_SIG *sig = GetThreadSigContext();
     if (sig == nullptr) {
-        // Cleanup and restore system RNG
+        // Cleanup
         det_rng_state.active = false;
         det_rng_state.seed.clear();
-        OQS_randombytes_switch_algorithm("system");
         return Result<KeyPair>::Error("Failed to create ML-DSA-65 signature object");
     }
 
@@ -119,14 +165,10 @@ Result<DilithiumCrypto::KeyPair> DilithiumCrypto::GenerateDeterministicKeyPair(
     // Generate keypair using deterministic RNG
     int rc = OQS_SIG_keypair(sig, public_key.data(), secret_key.data());
 
-    // Cleanup
-    OQS_SIG_free(sig);
-
-    // Restore system RNG and clear sensitive data
+    // Back to real randomness on this thread; clear sensitive data
     det_rng_state.active = false;
     det_rng_state.seed.clear();
     det_rng_state.counter = 0;
-    OQS_randombytes_switch_algorithm("system");
 
     if (rc != OQS_SUCCESS) {
         return Result<KeyPair>::Error("Failed to generate deterministic ML-DSA-65 keypair");
@@ -140,8 +182,8 @@ Result<DilithiumCrypto::KeyPair> DilithiumCrypto::GenerateDeterministicKeyPair(
 
 Result<Signature> DilithiumCrypto::Sign(const std::vector<uint8_t>& message,
                                        const SecretKey& secret_key) {
-    // Create ML-DSA-65 signature object
-    OQS_SIG *sig = OQS_SIG_new(OQS_SIG_alg_ml_dsa_65);
+    // Per-thread ML-DSA-65 signature object
+    OQS_SIG *sig = GetThreadSigContext();
     if (sig == nullptr) {
         return Result<Signature>::Error("Failed to create ML-DSA-65 signature object");
     }
@@ -155,12 +197,9 @@ Result<Signature> DilithiumCrypto::Sign(const std::vector<uint8_t>& message,
                           secret_key.data());
 
     if (rc != OQS_SUCCESS) {
-        OQS_SIG_free(sig);
         return Result<Signature>::Error("Failed to sign message with ML-DSA-65");
     }
 
-    OQS_SIG_free(sig);
-
     // Note: ML-DSA-65 signatures are variable length but should fit in our buffer
     // The actual signature_len may be less than signature.size()
 
@@ -176,8 +215,8 @@ Result<Signature> DilithiumCrypto::SignHash(const uint256& hash,
 Result<void> DilithiumCrypto::Verify(const std::vector<uint8_t>& message,
                                     const Signature& signature,
                                     const PublicKey& public_key) {
-    // Create ML-DSA-65 signature object
-    OQS_SIG *sig = OQS_SIG_new(OQS_SIG_alg_ml_dsa_65);
+    // Per-thread ML-DSA-65 signature object
+    OQS_SIG *sig = GetThreadSigContext();
     if (sig == nullptr) {
         return Result<void>::Error("Failed to create ML-DSA-65 signature object");
     }
@@ -187,8 +226,6 @@ Result<void> DilithiumCrypto::Verify(const std::vector<uint8_t>& message,
                             signature.data(), signature.size(),
                             public_key.data());
 
-    OQS_SIG_free(sig);
-
     if (rc != OQS_SUCCESS) {
         return Result<void>::Error("Signature verification failed");
     }
@@ -203,13 +240,167 @@ Result<void> DilithiumCrypto::VerifyHash(const uint256& hash,
     return Verify(hash_bytes, signature, public_key);
 }
 
+Result<void> DilithiumCrypto::VerifyHashCached(const uint256& hash,
+                                              const Signature& signature,
+                                              const PublicKey& public_key) {
+    SignatureCache& cache = SignatureCache::Instance();
+    uint256 entry = cache.ComputeEntry(hash, signature, public_key);
+    if (cache.Contains(entry)) {
+        return Result<void>::Ok();
+    }
+
+    auto result = VerifyHash(hash, signature, public_key);
+    if (result.IsOk()) {
+        cache.Insert(entry);
+    }
+    return result;
+}
+
+// ============================================================================
+// Signature Cache
+// ============================================================================
+
+class SignatureCache::Impl {
+public:
+    struct Stripe {
+        std::unordered_set<uint256, uint256_hash> entries;
+        std::deque<uint256> fifo;  // Insertion order for eviction
+        std::mutex mutex;
+    };
+
+    explicit Impl(size_t max_bytes) {
+        SetBudget(max_bytes);
+        std::array<uint8_t, 32> salt;
+        if (RAND_bytes(salt.data(), static_cast<int>(salt.size())) != 1) {
+            throw std::runtime_error("Failed to generate signature cache salt");
+        }
+        salted_hasher_.Write(salt.data(), salt.size());
+    }
+
+    void SetBudget(size_t max_bytes) {
+        max_bytes_ = max_bytes;
+        max_per_stripe_ = std::max<size_t>(1, max_bytes / ENTRY_BYTES / NUM_STRIPES);
+    }
+
+    Stripe& StripeFor(const uint256& entry) {
+        // Entry is a salted hash, so any byte is uniformly distributed
+        return stripes_[entry[31] % NUM_STRIPES];
+    }
+
+    void EvictToCapacity(Stripe& stripe) {
+        while (stripe.fifo.size() > max_per_stripe_) {
+            stripe.entries.erase(stripe.fifo.front());
+            stripe.fifo.pop_front();
+            evictions_++;
+        }
+    }
+
+    SHA3Hasher salted_hasher_;  // Midstate after absorbing the salt
+    std::array<Stripe, NUM_STRIPES> stripes_;
+    std::atomic<size_t> max_bytes_{0};
+    std::atomic<size_t> max_per_stripe_{1};
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> insertions_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+SignatureCache& SignatureCache::Instance() {
+    static SignatureCache instance;
+    return instance;
+}
+
+SignatureCache::SignatureCache(size_t max_bytes)
+    : impl_(std::make_unique<Impl>(max_bytes)) {}
+
+SignatureCache::~SignatureCache() = default;
+
+uint256 SignatureCache::ComputeEntry(const uint256& hash, const Signature& signature,
+                                     const PublicKey& public_key) const {
+    // Hash the fields in place, starting from the salted midstate
+    SHA3Hasher hasher = impl_->salted_hasher_;
+    hasher.Write(hash.data(), hash.size())
+          .Write(public_key.data(), public_key.size())
+          .Write(signature.data(), signature.size());
+    return hasher.Finalize();
+}
+
+bool SignatureCache::Contains(const uint256& hash, const Signature& signature,
+                              const PublicKey& public_key) {
+    return Contains(ComputeEntry(hash, signature, public_key));
+}
+
+bool SignatureCache::Contains(const uint256& entry) {
+    auto& stripe = impl_->StripeFor(entry);
+
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        found = stripe.entries.count(entry) > 0;
+    }
+
+    if (found) {
+        impl_->hits_++;
+    } else {
+        impl_->misses_++;
+    }
+    return found;
+}
+
+void SignatureCache::Insert(const uint256& hash, const Signature& signature,
+                            const PublicKey& public_key) {
+    Insert(ComputeEntry(hash, signature, public_key));
+}
+
+void SignatureCache::Insert(const uint256& entry) {
+    auto& stripe = impl_->StripeFor(entry);
+
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    if (!stripe.entries.insert(entry).second) {
+        return;
+    }
+    stripe.fifo.push_back(entry);
+    impl_->insertions_++;
+    impl_->EvictToCapacity(stripe);
+}
+
+void SignatureCache::SetMaxBytes(size_t max_bytes) {
+    impl_->SetBudget(max_bytes);
+    for (auto& stripe : impl_->stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        impl_->EvictToCapacity(stripe);
+    }
+}
+
+void SignatureCache::Clear() {
+    for (auto& stripe : impl_->stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stripe.entries.clear();
+        stripe.fifo.clear();
+    }
+}
+
+SignatureCache::Stats SignatureCache::GetStats() const {
+    Stats stats;
+    stats.hits = impl_->hits_.load();
+    stats.misses = impl_->misses_.load();
+    stats.insertions = impl_->insertions_.load();
+    stats.evictions = impl_->evictions_.load();
+    stats.max_bytes = impl_->max_bytes_.load();
+    for (auto& stripe : impl_->stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stats.entries += stripe.entries.size();
+    }
+    return stats;
+}
+
 // ============================================================================
 // Kyber768 Implementation
 // ============================================================================
 
 Result<KyberCrypto::KeyPair> KyberCrypto::GenerateKeyPair() {
-    // Create ML-KEM-768 (Kyber768) KEM object
-    OQS_KEM *kem = OQS_KEM_new(OQS_KEM_alg_ml_kem_768);
+    // Per-thread ML-KEM-768 (Kyber768) KEM object
+    OQS_KEM *kem = GetThreadKemContext();
     if (kem == nullptr) {
         return Result<KeyPair>::Error("Failed to create ML-KEM-768 KEM object");
     }
@@ -221,12 +412,9 @@ Result<KyberCrypto::KeyPair> KyberCrypto::GenerateKeyPair() {
     // Generate keypair
     int rc = OQS_KEM_keypair(kem, public_key.data(), secret_key.data());
     if (rc != OQS_SUCCESS) {
-        OQS_KEM_free(kem);
         return Result<KeyPair>::Error("Failed to generate ML-KEM-768 keypair");
     }
 
-    OQS_KEM_free(kem);
-
     keypair.public_key = public_key;
     keypair.secret_key = secret_key;
 
@@ -235,8 +423,8 @@ Result<KyberCrypto::KeyPair> KyberCrypto::GenerateKeyPair() {
 
 Result<std::pair<KyberCrypto::SharedSecret, KyberCrypto::Ciphertext>>
 KyberCrypto::Encapsulate(const std::array<uint8_t, KYBER768_PUBLICKEYBYTES>& public_key) {
-    // Create ML-KEM-768 KEM object
-    OQS_KEM *kem = OQS_KEM_new(OQS_KEM_alg_ml_kem_768);
+    // Per-thread ML-KEM-768 KEM object
+    OQS_KEM *kem = GetThreadKemContext();
     if (kem == nullptr) {
         return Result<std::pair<SharedSecret, Ciphertext>>::Error("Failed to create ML-KEM-768 KEM object");
     }
@@ -247,20 +435,17 @@ KyberCrypto::Encapsulate(const std::array<uint8_t, KYBER768_PUBLICKEYBYTES>& pub
     // Encapsulate to generate shared secret and ciphertext
     int rc = OQS_KEM_encaps(kem, ciphertext.data(), shared_secret.data(), public_key.data());
     if (rc != OQS_SUCCESS) {
-        OQS_KEM_free(kem);
         return Result<std::pair<SharedSecret, Ciphertext>>::Error("Failed to encapsulate with ML-KEM-768");
     }
 
-    OQS_KEM_free(kem);
-
     return Result<std::pair<SharedSecret, Ciphertext>>::Ok(std::make_pair(shared_secret, ciphertext));
 }
 
 Result<KyberCrypto::SharedSecret> KyberCrypto::Decapsulate(
     const Ciphertext& ciphertext,
     const std::array<uint8_t, KYBER768_SECRETKEYBYTES>& secret_key) {
-    // Create ML-KEM-768 KEM object
-    OQS_KEM *kem = OQS_KEM_new(OQS_KEM_alg_ml_kem_768);
+    // Per-thread ML-KEM-768 KEM object
+    OQS_KEM *kem = GetThreadKemContext();
     if (kem == nullptr) {
         return Result<SharedSecret>::Error("Failed to create ML-KEM-768 KEM object");
     }
@@ -270,12 +455,9 @@ Result<KyberCrypto::SharedSecret> KyberCrypto::Decapsulate(
     // Decapsulate to recover shared secret
     int rc = OQS_KEM_decaps(kem, shared_secret.data(), ciphertext.data(), secret_key.data());
     if (rc != OQS_SUCCESS) {
-        OQS_KEM_free(kem);
         return Result<SharedSecret>::Error("Failed to decapsulate with ML-KEM-768");
     }
 
-    OQS_KEM_free(kem);
-
     return Result<SharedSecret>::Ok(std::move(shared_secret));
 }
 
@@ -284,298 +466,128 @@ Result<KyberCrypto::SharedSecret> KyberCrypto::Decapsulate(
 // ============================================================================
 
 uint256 SHA3::Hash(const std::vector<uint8_t>& data) {
-    uint256 result{};
-
-    // Create EVP context for SHA3-256
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    if (!ctx) {
-        throw std::runtime_error("Failed to create EVP_MD_CTX");
-    }
-
-    // Initialize SHA3-256
-    if (EVP_DigestInit_ex(ctx, EVP_sha3_256(), nullptr) != 1) {
-        EVP_MD_CTX_free(ctx);
-        throw std::runtime_error("Failed to initialize SHA3-256");
-    }
-
-    // Update with data
-    if (!data.empty()) {
-        if (EVP_DigestUpdate(ctx, data.data(), data.size()) != 1) {
-            EVP_MD_CTX_free(ctx);
-            throw std::runtime_error("Failed to update SHA3-256");
-        }
-    }
-
-    // Finalize and get hash
-    unsigned int hash_len = 0;
-    if (EVP_DigestFinal_ex(ctx, result.data(), &hash_len) != 1) {
-        EVP_MD_CTX_free(ctx);
-        throw std::runtime_error("Failed to finalize SHA3-256");
-    }
-
-    EVP_MD_CTX_free(ctx);
-
-    // Verify we got exactly 32 bytes
-    if (hash_len != 32) {
-        throw std::runtime_error("SHA3-256 returned unexpected hash length");
-    }
-
-    return result;
+    return Hash(data.data(), data.size());
 }
 
 uint256 SHA3::DoubleHash(const std::vector<uint8_t>& data) {
     auto first = Hash(data);
-    std::vector<uint8_t> first_bytes(first.begin(), first.end());
-    return Hash(first_bytes);
+    return Hash(first.data(), first.size());
 }
 
 uint256 SHA3::Hash(const uint8_t* data, size_t len) {
-    std::vector<uint8_t> vec(data, data + len);
-    return Hash(vec);
+    // In-tree Keccak: no EVP context allocation per call
+    uint256 result;
+    keccak::SHA3_256(data, len, result.data());
+    return result;
 }
 
-// ============================================================================
-// Address Encoding (Bech32)
-// ============================================================================
-
-namespace {
-    // Bech32 character set (base32)
-    const char* BECH32_CHARSET = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
-
-    // Generator values for Bech32 checksum
-    const uint32_t BECH32_GENERATOR[5] = {
-        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
-    };
-
-    // Find character in charset (returns -1 if not found)
-    int CharsetIndex(char c) {
-        for (int i = 0; i < 32; ++i) {
-            if (BECH32_CHARSET[i] == c) {
-                return i;
-            }
-        }
-        return -1;
-    }
-
-    // Bech32 checksum polymod
-    uint32_t Bech32Polymod(const std::vector<uint8_t>& values) {
-        uint32_t chk = 1;
-        for (uint8_t value : values) {
-            uint32_t top = chk >> 25;
-            chk = (chk & 0x1ffffff) << 5 ^ value;
-            for (int i = 0; i < 5; ++i) {
-                if ((top >> i) & 1) {
-                    chk ^= BECH32_GENERATOR[i];
-                }
-            }
-        }
-        return chk;
-    }
-
-    // Expand human-readable part for checksum
-    std::vector<uint8_t> ExpandHRP(const std::string& hrp) {
-        std::vector<uint8_t> result;
-        result.reserve(hrp.size() * 2 + 1);
-
-        // High bits of each character
-        for (char c : hrp) {
-            result.push_back(c >> 5);
-        }
+void SHA3::HashBatch(const uint8_t* data, size_t len, size_t count, uint256* out) {
+    static_assert(sizeof(uint256) == 32, "uint256 must be tightly packed");
+    keccak::SHA3_256Batch(data, len, count, out->data());
+}
 
-        // Separator
-        result.push_back(0);
+const char* SHA3::GetBatchImplementation() {
+    return keccak::BatchImplementation();
+}
 
-        // Low bits of each character
-        for (char c : hrp) {
-            result.push_back(c & 31);
+// SHA3Hasher implementation
+SHA3Hasher& SHA3Hasher::Write(const uint8_t* data, size_t len) {
+    if (len == 0) {
+        return *this;
+    }
+
+    // Top up a partially filled block first
+    if (buffered_ > 0) {
+        size_t take = std::min(len, RATE - buffered_);
+        std::memcpy(buffer_ + buffered_, data, take);
+        buffered_ += take;
+        data += take;
+        len -= take;
+        if (buffered_ < RATE) {
+            return *this;
         }
-
-        return result;
+        keccak::AbsorbBlock(state_, buffer_);
+        buffered_ = 0;
     }
 
-    // Create Bech32 checksum
-    std::vector<uint8_t> CreateChecksum(const std::string& hrp,
-                                        const std::vector<uint8_t>& data) {
-        std::vector<uint8_t> values = ExpandHRP(hrp);
-        values.insert(values.end(), data.begin(), data.end());
-        values.insert(values.end(), 6, 0); // 6 zero bytes for checksum placeholder
-
-        uint32_t polymod = Bech32Polymod(values) ^ 1;
-
-        std::vector<uint8_t> checksum(6);
-        for (int i = 0; i < 6; ++i) {
-            checksum[i] = (polymod >> (5 * (5 - i))) & 31;
-        }
-
-        return checksum;
+    // Full blocks straight from the input
+    for (; len >= RATE; data += RATE, len -= RATE) {
+        keccak::AbsorbBlock(state_, data);
     }
 
-    // Verify Bech32 checksum
-    bool VerifyChecksum(const std::string& hrp, const std::vector<uint8_t>& data) {
-        std::vector<uint8_t> values = ExpandHRP(hrp);
-        values.insert(values.end(), data.begin(), data.end());
-        return Bech32Polymod(values) == 1;
+    if (len > 0) {
+        std::memcpy(buffer_, data, len);
+        buffered_ = len;
     }
+    return *this;
+}
 
-    // Convert 8-bit data to 5-bit data
-    std::vector<uint8_t> ConvertBits(const std::vector<uint8_t>& data,
-                                     int frombits, int tobits, bool pad) {
-        std::vector<uint8_t> result;
-        int acc = 0;
-        int bits = 0;
-        int maxv = (1 << tobits) - 1;
-        int max_acc = (1 << (frombits + tobits - 1)) - 1;
+uint256 SHA3Hasher::Finalize() {
+    uint256 result;
+    keccak::AbsorbFinal(state_, buffer_, buffered_, result.data());
+    return result;
+}
 
-        for (uint8_t value : data) {
-            if ((value >> frombits) != 0) {
-                return {}; // Invalid input
-            }
-            acc = ((acc << frombits) | value) & max_acc;
-            bits += frombits;
-            while (bits >= tobits) {
-                bits -= tobits;
-                result.push_back((acc >> bits) & maxv);
-            }
-        }
+// ============================================================================
+// Address Encoding (Bech32)
+// ============================================================================
 
-        if (pad) {
-            if (bits > 0) {
-                result.push_back((acc << (tobits - bits)) & maxv);
-            }
-        } else if (bits >= frombits || ((acc << (tobits - bits)) & maxv)) {
-            return {}; // Invalid padding
-        }
+namespace {
+    constexpr std::string_view MAINNET_ADDRESS_HRP = "int1";
+    constexpr std::string_view TESTNET_ADDRESS_HRP = "intc1";
 
-        return result;
-    }
+    // Version byte + 32-byte pubkey hash
+    constexpr size_t ADDRESS_PAYLOAD_SIZE = 33;
 }
 
 Result<std::string> AddressEncoder::EncodeAddress(const uint256& pubkey_hash, bool testnet) {
-    const std::string hrp = testnet ? "intc1" : "int1";
+    const std::string_view hrp = testnet ? TESTNET_ADDRESS_HRP : MAINNET_ADDRESS_HRP;
 
-    // Convert pubkey_hash to vector
-    std::vector<uint8_t> hash_bytes(pubkey_hash.begin(), pubkey_hash.end());
+    // Version byte (0 for mainnet P2PKH) followed by the hash
+    std::array<uint8_t, ADDRESS_PAYLOAD_SIZE> payload{};
+    std::copy(pubkey_hash.begin(), pubkey_hash.end(), payload.begin() + 1);
 
-    // Add version byte (0 for mainnet P2PKH)
-    std::vector<uint8_t> data_with_version;
-    data_with_version.push_back(0); // Version 0
-    data_with_version.insert(data_with_version.end(), hash_bytes.begin(), hash_bytes.end());
-
-    // Convert from 8-bit to 5-bit
-    std::vector<uint8_t> data_5bit = ConvertBits(data_with_version, 8, 5, true);
-    if (data_5bit.empty()) {
+    // Encode straight into the result (the checksum is computed on the fly)
+    std::string result(codec::Bech32EncodedSize(hrp.size(), payload.size()), '\0');
+    auto [end, ec] = codec::Bech32ToChars(result.data(), result.data() + result.size(), hrp, payload);
+    if (ec != std::errc{}) {
         return Result<std::string>::Error("Failed to convert bits for Bech32 encoding");
     }
 
-    // Create checksum
-    std::vector<uint8_t> checksum = CreateChecksum(hrp, data_5bit);
-
-    // Combine data and checksum
-    data_5bit.insert(data_5bit.end(), checksum.begin(), checksum.end());
-
-    // Encode to Bech32 string
-    std::string result = hrp + "1";
-    for (uint8_t value : data_5bit) {
-        if (value >= 32) {
-            return Result<std::string>::Error("Invalid 5-bit value in Bech32 encoding");
-        }
-        result += BECH32_CHARSET[value];
-    }
-
     return Result<std::string>::Ok(std::move(result));
 }
 
 Result<uint256> AddressEncoder::DecodeAddress(const std::string& address) {
-    // Convert to lowercase
-    std::string lower_addr;
-    lower_addr.reserve(address.size());
-    bool has_lower = false, has_upper = false;
-
-    for (char c : address) {
-        if (c >= 'A' && c <= 'Z') {
-            has_upper = true;
-            lower_addr += (c - 'A' + 'a');
-        } else if (c >= 'a' && c <= 'z') {
-            has_lower = true;
-            lower_addr += c;
-        } else {
-            lower_addr += c;
-        }
+    std::string addr_hrp;
+    std::vector<uint8_t> payload;
+    auto decode_result = codec::DecodeBech32(address, addr_hrp, payload);
+    if (decode_result.IsError()) {
+        return Result<uint256>::Error(decode_result.error);
     }
 
-    // Bech32 addresses should not mix upper and lowercase
-    if (has_lower && has_upper) {
-        return Result<uint256>::Error("Mixed case in Bech32 address");
-    }
-
-    // Find separator '1'
-    size_t sep_pos = lower_addr.rfind('1');
-    if (sep_pos == std::string::npos) {
-        return Result<uint256>::Error("No separator found in address");
-    }
-
-    // Extract HRP and data
-    std::string addr_hrp = lower_addr.substr(0, sep_pos);
-    std::string data_part = lower_addr.substr(sep_pos + 1);
-
     // Verify HRP matches (support both mainnet and testnet)
-    if (addr_hrp != "int1" && addr_hrp != "intc1") {
+    if (addr_hrp != MAINNET_ADDRESS_HRP && addr_hrp != TESTNET_ADDRESS_HRP) {
         return Result<uint256>::Error("Invalid HRP (expected 'int1' for mainnet or 'intc1' for testnet)");
     }
 
-    const std::string hrp = addr_hrp;
-
-    // Checksum must be at least 6 characters
-    if (data_part.size() < 6) {
-        return Result<uint256>::Error("Address too short");
-    }
-
-    // Decode data part
-    std::vector<uint8_t> data_5bit;
-    data_5bit.reserve(data_part.size());
-
-    for (char c : data_part) {
-        int idx = CharsetIndex(c);
-        if (idx == -1) {
-            return Result<uint256>::Error("Invalid character in Bech32 address");
-        }
-        data_5bit.push_back(static_cast<uint8_t>(idx));
-    }
-
-    // Verify checksum
-    if (!VerifyChecksum(hrp, data_5bit)) {
-        return Result<uint256>::Error("Invalid checksum");
-    }
-
-    // Remove checksum (last 6 characters)
-    data_5bit.resize(data_5bit.size() - 6);
-
-    // Convert from 5-bit to 8-bit
-    std::vector<uint8_t> data_8bit = ConvertBits(data_5bit, 5, 8, false);
-    if (data_8bit.empty()) {
-        return Result<uint256>::Error("Failed to convert bits in Bech32 decoding");
-    }
-
     // First byte is version
-    if (data_8bit.empty()) {
+    if (payload.empty()) {
         return Result<uint256>::Error("Address data too short");
     }
 
-    uint8_t version = data_8bit[0];
+    uint8_t version = payload[0];
     if (version != 0) {
         return Result<uint256>::Error("Unsupported address version");
     }
 
     // Remaining bytes are the pubkey hash
-    data_8bit.erase(data_8bit.begin());
-
-    if (data_8bit.size() != 32) {
+    if (payload.size() != ADDRESS_PAYLOAD_SIZE) {
         return Result<uint256>::Error("Invalid pubkey hash length");
     }
 
     // Convert to uint256
     uint256 pubkey_hash{};
-    std::copy(data_8bit.begin(), data_8bit.end(), pubkey_hash.begin());
+    std::copy(payload.begin() + 1, payload.end(), pubkey_hash.begin());
 
     return Result<uint256>::Ok(std::move(pubkey_hash));
 }
@@ -630,32 +642,38 @@ std::string PublicKeyToAddress(const PublicKey& pubkey) {
 // Enhanced Dilithium Functions
 // ============================================================================
 
-Result<void> DilithiumCrypto::BatchVerify(
+std::vector<Result<void>> DilithiumCrypto::BatchVerify(
         const std::vector<std::vector<uint8_t>>& messages,
         const std::vector<Signature>& signatures,
         const std::vector<PublicKey>& public_keys) {
 
     // Check all vectors have the same size
     if (messages.size() != signatures.size() || messages.size() != public_keys.size()) {
-        return Result<void>::Error("Batch verify: vector sizes must match");
+        return std::vector<Result<void>>(
+            messages.size(), Result<void>::Error("Batch verify: vector sizes must match"));
     }
 
-    if (messages.empty()) {
-        return Result<void>::Error("Batch verify: empty input");
-    }
+    // Dilithium has no native batch verification, so the speedup comes from
+    // verifying independent signatures on several threads at once
+    std::vector<Result<void>> results(messages.size(), Result<void>::Ok());
+    ibd::GetSharedThreadPool().ParallelFor(messages.size(), [&](size_t i) {
+        results[i] = Verify(messages[i], signatures[i], public_keys[i]);
+    });
+    return results;
+}
 
-    // Verify each signature individually
-    // Note: True batch verification would use optimized algorithms,
-    // but Dilithium doesn't support batch verification natively
-    for (size_t i = 0; i < messages.size(); ++i) {
-        auto result = Verify(messages[i], signatures[i], public_keys[i]);
-        if (result.IsError()) {
-            return Result<void>::Error("Batch verify failed at index " + std::to_string(i) +
-                                      ": " + result.error);
+std::vector<Result<Signature>> DilithiumCrypto::BatchSign(
+        const std::vector<SignRequest>& requests) {
+    std::vector<Result<Signature>> results(requests.size(), Result<Signature>::Error(""));
+    ibd::GetSharedThreadPool().ParallelFor(requests.size(), [&](size_t i) {
+        const SignRequest& request = requests[i];
+        if (request.secret_key == nullptr) {
+            results[i] = Result<Signature>::Error("Batch sign: missing secret key");
+            return;
         }
-    }
-
-    return Result<void>::Ok();
+        results[i] = SignHash(request.hash, *request.secret_key);
+    });
+    return results;
 }
 
 uint64_t DilithiumCrypto::GetPublicKeyFingerprint(const PublicKey& key) {
@@ -0,0 +1,152 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include "keccak.h"
+#include <bit>
+#include <cstring>
+
+namespace intcoin {
+namespace keccak {
+
+namespace {
+
+inline uint64_t LoadLE64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    if constexpr (std::endian::native == std::endian::big) {
+        v = std::byteswap(v);
+    }
+    return v;
+}
+
+inline void StoreLE64(uint8_t* p, uint64_t v) {
+    if constexpr (std::endian::native == std::endian::big) {
+        v = std::byteswap(v);
+    }
+    std::memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * SHA3-256 sponge over N equal-length messages at once
+ *
+ * Messages are stored back to back at data (N * len bytes); digests are
+ * written back to back at out (N * 32 bytes).
+ */
+template <size_t N, void (*PermuteFn)(uint64_t*)>
+void SpongeN(const uint8_t* data, size_t len, uint8_t* out) {
+    alignas(64) uint64_t state[25 * N] = {};
+
+    // Absorb full blocks
+    size_t offset = 0;
+    for (; len - offset >= SHA3_256_RATE; offset += SHA3_256_RATE) {
+        for (size_t k = 0; k < N; ++k) {
+            const uint8_t* block = data + k * len + offset;
+            for (size_t j = 0; j < SHA3_256_RATE_LANES; ++j) {
+                state[j * N + k] ^= LoadLE64(block + 8 * j);
+            }
+        }
+        PermuteFn(state);
+    }
+
+    // Absorb the tail with SHA3 padding (0x06 ... 0x80)
+    const size_t tail = len - offset;
+    for (size_t k = 0; k < N; ++k) {
+        uint8_t block[SHA3_256_RATE] = {};
+        if (tail > 0) {
+            std::memcpy(block, data + k * len + offset, tail);
+        }
+        block[tail] ^= 0x06;
+        block[SHA3_256_RATE - 1] ^= 0x80;
+        for (size_t j = 0; j < SHA3_256_RATE_LANES; ++j) {
+            state[j * N + k] ^= LoadLE64(block + 8 * j);
+        }
+    }
+    PermuteFn(state);
+
+    // Squeeze 256 bits
+    for (size_t k = 0; k < N; ++k) {
+        for (size_t j = 0; j < 4; ++j) {
+            StoreLE64(out + 32 * k + 8 * j, state[j * N + k]);
+        }
+    }
+}
+
+struct BatchKernels {
+    bool x8 = false;
+    bool x4 = false;
+};
+
+const BatchKernels& GetBatchKernels() {
+    static const BatchKernels kernels = [] {
+        BatchKernels k;
+#if defined(ENABLE_KECCAK_AVX512)
+        k.x8 = __builtin_cpu_supports("avx512f");
+#endif
+#if defined(ENABLE_KECCAK_AVX2)
+        k.x4 = __builtin_cpu_supports("avx2");
+#endif
+        return k;
+    }();
+    return kernels;
+}
+
+} // namespace
+
+void AbsorbBlock(uint64_t* state, const uint8_t* block) {
+    for (size_t j = 0; j < SHA3_256_RATE_LANES; ++j) {
+        state[j] ^= LoadLE64(block + 8 * j);
+    }
+    PermuteScalar(state);
+}
+
+void AbsorbFinal(uint64_t* state, const uint8_t* tail, size_t len, uint8_t* out) {
+    uint8_t block[SHA3_256_RATE] = {};
+    if (len > 0) {
+        std::memcpy(block, tail, len);
+    }
+    block[len] ^= 0x06;
+    block[SHA3_256_RATE - 1] ^= 0x80;
+    AbsorbBlock(state, block);
+    for (size_t j = 0; j < 4; ++j) {
+        StoreLE64(out + 8 * j, state[j]);
+    }
+}
+
+void SHA3_256(const uint8_t* data, size_t len, uint8_t* out) {
+    SpongeN<1, PermuteScalar>(data, len, out);
+}
+
+void SHA3_256Batch(const uint8_t* data, size_t len, size_t count, uint8_t* out) {
+    const BatchKernels& kernels = GetBatchKernels();
+    size_t i = 0;
+
+#if defined(ENABLE_KECCAK_AVX512)
+    if (kernels.x8) {
+        for (; i + 8 <= count; i += 8) {
+            SpongeN<8, PermuteX8>(data + i * len, len, out + 32 * i);
+        }
+    }
+#endif
+#if defined(ENABLE_KECCAK_AVX2)
+    if (kernels.x4) {
+        for (; i + 4 <= count; i += 4) {
+            SpongeN<4, PermuteX4>(data + i * len, len, out + 32 * i);
+        }
+    }
+#endif
+    (void)kernels;
+
+    for (; i < count; ++i) {
+        SHA3_256(data + i * len, len, out + 32 * i);
+    }
+}
+
+const char* BatchImplementation() {
+    const BatchKernels& kernels = GetBatchKernels();
+    if (kernels.x8) return "avx512";
+    if (kernels.x4) return "avx2";
+    return "scalar";
+}
+
+} // namespace keccak
+} // namespace intcoin
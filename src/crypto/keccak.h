@@ -0,0 +1,147 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+/**
+ * Keccak-f[1600] permutation (internal)
+ *
+ * The round function is written once against a small lane-ops interface
+ * and instantiated for plain 64-bit lanes and for 4-way (AVX2) and 8-way
+ * (AVX-512) vectors. Multi-way states are lane-interleaved: lane j of
+ * message k lives at state[j * N + k].
+ */
+
+#ifndef INTCOIN_CRYPTO_KECCAK_H
+#define INTCOIN_CRYPTO_KECCAK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace intcoin {
+namespace keccak {
+
+/// SHA3-256 rate in bytes (1600 - 2 * 256 bits)
+constexpr size_t SHA3_256_RATE = 136;
+
+/// Number of 64-bit lanes absorbed per SHA3-256 block
+constexpr size_t SHA3_256_RATE_LANES = SHA3_256_RATE / 8;
+
+constexpr uint64_t ROUND_CONSTANTS[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+    0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+    0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/// Rho rotation offsets, indexed by x + 5y
+constexpr int RHO_OFFSETS[25] = {
+     0,  1, 62, 28, 27,
+    36, 44,  6, 55, 20,
+     3, 10, 43, 25, 39,
+    41, 45, 15, 21,  8,
+    18,  2, 61, 56, 14
+};
+
+/// Scalar lane operations
+struct ScalarOps {
+    using Lane = uint64_t;
+
+    static Lane Xor(Lane a, Lane b) { return a ^ b; }
+    static Lane Constant(uint64_t c) { return c; }
+    static Lane Chi(Lane a, Lane b, Lane c) { return a ^ (~b & c); }
+
+    template <int N>
+    static Lane Rol(Lane v) {
+        if constexpr (N == 0) {
+            return v;
+        } else {
+            return (v << N) | (v >> (64 - N));
+        }
+    }
+};
+
+/// Call f(std::integral_constant<size_t, I>) for I in [0, N), fully unrolled
+template <typename F, size_t... I>
+inline void UnrollImpl(F&& f, std::index_sequence<I...>) {
+    (f(std::integral_constant<size_t, I>{}), ...);
+}
+
+template <size_t N, typename F>
+inline void Unroll(F&& f) {
+    UnrollImpl(f, std::make_index_sequence<N>{});
+}
+
+/// 24 rounds of Keccak-f[1600] over 25 lanes of Ops::Lane
+///
+/// Every lane index and rotation is a compile-time constant so the state
+/// stays in registers.
+template <typename Ops>
+inline void Permute(typename Ops::Lane* a) {
+    using Lane = typename Ops::Lane;
+    Lane b[25];
+    Lane c[5];
+
+    for (int round = 0; round < 24; ++round) {
+        // Theta
+        Unroll<5>([&](auto x) {
+            c[x] = Ops::Xor(Ops::Xor(Ops::Xor(a[x], a[x + 5]), Ops::Xor(a[x + 10], a[x + 15])), a[x + 20]);
+        });
+        Unroll<5>([&](auto x) {
+            Lane d = Ops::Xor(c[(x + 4) % 5], Ops::template Rol<1>(c[(x + 1) % 5]));
+            Unroll<5>([&](auto y) { a[x + 5 * y] = Ops::Xor(a[x + 5 * y], d); });
+        });
+
+        // Rho and pi: B[y, 2x + 3y] = rot(A[x, y], r[x, y])
+        Unroll<25>([&](auto i) {
+            constexpr size_t x = decltype(i)::value % 5;
+            constexpr size_t y = decltype(i)::value / 5;
+            b[y + 5 * ((2 * x + 3 * y) % 5)] = Ops::template Rol<RHO_OFFSETS[decltype(i)::value]>(a[i]);
+        });
+
+        // Chi
+        Unroll<25>([&](auto i) {
+            constexpr size_t x = decltype(i)::value % 5;
+            constexpr size_t row = decltype(i)::value - x;
+            a[i] = Ops::Chi(b[i], b[row + (x + 1) % 5], b[row + (x + 2) % 5]);
+        });
+
+        // Iota
+        a[0] = Ops::Xor(a[0], Ops::Constant(ROUND_CONSTANTS[round]));
+    }
+}
+
+/// Permute one state (25 lanes)
+inline void PermuteScalar(uint64_t* state) {
+    Permute<ScalarOps>(state);
+}
+
+/// Permute four interleaved states (25 x 4 lanes); requires AVX2
+void PermuteX4(uint64_t* state);
+
+/// Permute eight interleaved states (25 x 8 lanes); requires AVX-512F
+void PermuteX8(uint64_t* state);
+
+/// Absorb one full SHA3-256 block (SHA3_256_RATE bytes) into state
+void AbsorbBlock(uint64_t* state, const uint8_t* block);
+
+/// Absorb the final partial block (len < SHA3_256_RATE) with SHA3 padding
+/// and write the 32-byte digest to out
+void AbsorbFinal(uint64_t* state, const uint8_t* tail, size_t len, uint8_t* out);
+
+/// SHA3-256 of one message (32 bytes written to out)
+void SHA3_256(const uint8_t* data, size_t len, uint8_t* out);
+
+/// SHA3-256 of count equal-length messages stored back to back
+/// (32 * count bytes written to out); uses the widest available kernel
+void SHA3_256Batch(const uint8_t* data, size_t len, size_t count, uint8_t* out);
+
+/// Name of the multi-buffer kernel selected for this CPU
+const char* BatchImplementation();
+
+} // namespace keccak
+} // namespace intcoin
+
+#endif // INTCOIN_CRYPTO_KECCAK_H
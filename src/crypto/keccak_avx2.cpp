@@ -0,0 +1,51 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// 4-way Keccak-f[1600]. Built with -mavx2 and only called after a runtime
+// CPU check (see ENABLE_KECCAK_AVX2 in keccak.cpp).
+
+#include "keccak.h"
+
+#if defined(ENABLE_KECCAK_AVX2)
+
+#include <immintrin.h>
+
+namespace intcoin {
+namespace keccak {
+
+namespace {
+
+struct AVX2Ops {
+    using Lane = __m256i;
+
+    static Lane Xor(Lane a, Lane b) { return _mm256_xor_si256(a, b); }
+    static Lane Constant(uint64_t c) { return _mm256_set1_epi64x(static_cast<long long>(c)); }
+    static Lane Chi(Lane a, Lane b, Lane c) { return _mm256_xor_si256(a, _mm256_andnot_si256(b, c)); }
+
+    template <int N>
+    static Lane Rol(Lane v) {
+        if constexpr (N == 0) {
+            return v;
+        } else {
+            return _mm256_or_si256(_mm256_slli_epi64(v, N), _mm256_srli_epi64(v, 64 - N));
+        }
+    }
+};
+
+} // namespace
+
+void PermuteX4(uint64_t* state) {
+    __m256i lanes[25];
+    for (int i = 0; i < 25; ++i) {
+        lanes[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + 4 * i));
+    }
+    Permute<AVX2Ops>(lanes);
+    for (int i = 0; i < 25; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + 4 * i), lanes[i]);
+    }
+}
+
+} // namespace keccak
+} // namespace intcoin
+
+#endif // ENABLE_KECCAK_AVX2
@@ -0,0 +1,53 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+// 8-way Keccak-f[1600]. Built with -mavx512f and only called after a
+// runtime CPU check (see ENABLE_KECCAK_AVX512 in keccak.cpp).
+
+#include "keccak.h"
+
+#if defined(ENABLE_KECCAK_AVX512)
+
+#include <immintrin.h>
+
+namespace intcoin {
+namespace keccak {
+
+namespace {
+
+struct AVX512Ops {
+    using Lane = __m512i;
+
+    static Lane Xor(Lane a, Lane b) { return _mm512_xor_si512(a, b); }
+    static Lane Constant(uint64_t c) { return _mm512_set1_epi64(static_cast<long long>(c)); }
+
+    // a ^ (~b & c) in one ternary-logic instruction
+    static Lane Chi(Lane a, Lane b, Lane c) { return _mm512_ternarylogic_epi64(a, b, c, 0xD2); }
+
+    template <int N>
+    static Lane Rol(Lane v) {
+        if constexpr (N == 0) {
+            return v;
+        } else {
+            return _mm512_rol_epi64(v, N);
+        }
+    }
+};
+
+} // namespace
+
+void PermuteX8(uint64_t* state) {
+    __m512i lanes[25];
+    for (int i = 0; i < 25; ++i) {
+        lanes[i] = _mm512_loadu_si512(state + 8 * i);
+    }
+    Permute<AVX512Ops>(lanes);
+    for (int i = 0; i < 25; ++i) {
+        _mm512_storeu_si512(state + 8 * i, lanes[i]);
+    }
+}
+
+} // namespace keccak
+} // namespace intcoin
+
+#endif // ENABLE_KECCAK_AVX512
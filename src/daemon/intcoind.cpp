@@ -3,6 +3,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "intcoin/intcoin.h"
+#include "intcoin/ibd/check_queue.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
@@ -34,6 +35,7 @@ int main(int argc, char* argv[]) {
     uint16_t rpc_port = 2211;
     std::string rpc_user = "";
     std::string rpc_password = "";
+    size_t script_threads = 0;
 
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
@@ -48,6 +50,7 @@ int main(int argc, char* argv[]) {
             std::cout << "  -rpcport=<port>         RPC port (default: 2211)\n";
             std::cout << "  -rpcuser=<user>         RPC username\n";
             std::cout << "  -rpcpassword=<pass>     RPC password\n";
+            std::cout << "  -par=<n>                Script verification threads (default: 0 = all cores)\n";
             return 0;
         }
         else if (arg == "-v" || arg == "--version") {
@@ -75,6 +78,9 @@ int main(int argc, char* argv[]) {
         else if (arg.find("-rpcpassword=") == 0) {
             rpc_password = arg.substr(13);
         }
+        else if (arg.find("-par=") == 0) {
+            script_threads = std::stoul(arg.substr(5));
+        }
     }
 
     // Setup signal handlers
@@ -90,6 +96,9 @@ int main(int argc, char* argv[]) {
     std::cout << "RPC Port: " << rpc_port << "\n";
     std::cout << "Data Directory: " << data_dir << "\n\n";
 
+    // Configure parallel script verification before any block is validated
+    ibd::ScriptCheckQueue::SetGlobalThreadCount(script_threads);
+
     // Initialize blockchain database
     std::cout << "Initializing blockchain...\n";
     auto db = std::make_shared<BlockchainDB>(blockchain_dir);
@@ -127,8 +136,10 @@ int main(int argc, char* argv[]) {
     // Register blockchain callbacks for P2P relay
     std::cout << "Registering P2P relay callbacks...\n";
 
-    // Block relay: broadcast new blocks to peers
+    // Block relay: broadcast new blocks to peers, and track the new tip's
+    // transactions so re-announcements of them are ignored
     blockchain.RegisterBlockCallback([&p2p_node](const Block& block) {
+        RecentTxFilter::Instance().BlockConnected(block);
         p2p_node.BroadcastBlock(block.GetHash());
     });
 
@@ -383,8 +383,7 @@ void HTLCManager::AddHTLC(const HTLCInfo& info) {
     htlcs_[info.outpoint] = info;
 
     LogF(LogLevel::INFO, "HTLC: Added HTLC %s:%u (%llu INTS)",
-         BytesToHex(std::vector<uint8_t>(info.outpoint.tx_hash.begin(),
-                                        info.outpoint.tx_hash.end())).substr(0, 16).c_str(),
+         BytesToHex(info.outpoint.tx_hash).substr(0, 16).c_str(),
          info.outpoint.index,
          info.amount);
 }
@@ -395,8 +394,7 @@ void HTLCManager::UpdateHTLCState(const OutPoint& outpoint, HTLCState state) {
         it->second.state = state;
 
         LogF(LogLevel::INFO, "HTLC: Updated state for %s:%u to %d",
-             BytesToHex(std::vector<uint8_t>(outpoint.tx_hash.begin(),
-                                            outpoint.tx_hash.end())).substr(0, 16).c_str(),
+             BytesToHex(outpoint.tx_hash).substr(0, 16).c_str(),
              outpoint.index,
              static_cast<int>(state));
     }
@@ -462,8 +460,7 @@ void HTLCManager::RemoveHTLC(const OutPoint& outpoint) {
     htlcs_.erase(outpoint);
 
     LogF(LogLevel::INFO, "HTLC: Removed HTLC %s:%u",
-         BytesToHex(std::vector<uint8_t>(outpoint.tx_hash.begin(),
-                                        outpoint.tx_hash.end())).substr(0, 16).c_str(),
+         BytesToHex(outpoint.tx_hash).substr(0, 16).c_str(),
          outpoint.index);
 }
 
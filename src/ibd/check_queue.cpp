@@ -0,0 +1,172 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/ibd/check_queue.h>
+#include <intcoin/ibd/parallel_validation.h>
+#include <intcoin/transaction.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace intcoin {
+namespace ibd {
+
+ScriptExecutionResult ScriptCheck::operator()() const {
+    if (!tx || input_index >= tx->inputs.size()) {
+        return ScriptExecutionResult::Error("Invalid script check");
+    }
+    return ExecuteScript(tx->inputs[input_index].script_sig, script_pubkey, *tx, input_index,
+                         txdata.get());
+}
+
+// ScriptCheckQueue implementation
+class ScriptCheckQueue::Impl {
+public:
+    size_t num_threads_;
+    std::unique_ptr<ThreadPool> pool_;  // num_threads_ - 1 workers; master is the caller
+    std::mutex run_mutex_;               // One batch at a time
+    mutable std::mutex stats_mutex_;
+    CheckQueueStats stats_;
+
+    explicit Impl(size_t num_threads) {
+        if (num_threads == 0) {
+            num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0) num_threads = 1;
+        }
+        num_threads_ = num_threads;
+        if (num_threads_ > 1) {
+            pool_ = std::make_unique<ThreadPool>(num_threads_ - 1);
+        }
+    }
+};
+
+namespace {
+    std::mutex g_global_queue_mutex;
+    std::unique_ptr<ScriptCheckQueue> g_global_queue;
+    size_t g_global_thread_count = 0;
+}
+
+ScriptCheckQueue::ScriptCheckQueue(size_t num_threads)
+    : pimpl_(std::make_unique<Impl>(num_threads)) {}
+
+ScriptCheckQueue::~ScriptCheckQueue() = default;
+
+Result<void> ScriptCheckQueue::RunChecks(const std::vector<ScriptCheck>& checks) {
+    if (checks.empty()) {
+        return Result<void>::Ok();
+    }
+
+    std::lock_guard<std::mutex> run_lock(pimpl_->run_mutex_);
+
+    const size_t count = checks.size();
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> checks_run{0};
+    std::atomic<bool> abort{false};
+
+    std::mutex fail_mutex;
+    size_t fail_index = std::numeric_limits<size_t>::max();
+    std::string fail_error;
+
+    auto work = [&]() {
+        while (!abort.load(std::memory_order_relaxed)) {
+            size_t begin = next.fetch_add(BATCH_SIZE);
+            if (begin >= count) {
+                return;
+            }
+            size_t end = std::min(begin + BATCH_SIZE, count);
+            for (size_t i = begin; i < end; ++i) {
+                if (abort.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                ScriptExecutionResult result = checks[i]();
+                checks_run.fetch_add(1, std::memory_order_relaxed);
+                if (!result.success) {
+                    std::lock_guard<std::mutex> lock(fail_mutex);
+                    if (i < fail_index) {
+                        fail_index = i;
+                        fail_error = result.error;
+                    }
+                    abort.store(true);
+                    return;
+                }
+            }
+        }
+    };
+
+    // Fan out to workers; the master thread works too, then joins
+    size_t helpers = 0;
+    if (pimpl_->pool_ && count >= MIN_PARALLEL_CHECKS) {
+        size_t batches = (count + BATCH_SIZE - 1) / BATCH_SIZE;
+        helpers = std::min(pimpl_->pool_->GetThreadCount(), batches > 0 ? batches - 1 : 0);
+    }
+
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    size_t pending = helpers;
+
+    for (size_t h = 0; h < helpers; ++h) {
+        pimpl_->pool_->SubmitTask([&]() {
+            work();
+            std::lock_guard<std::mutex> lock(done_mutex);
+            --pending;
+            done_cv.notify_one();
+        });
+    }
+
+    work();
+
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&] { return pending == 0; });
+    }
+
+    bool failed = abort.load();
+    {
+        std::lock_guard<std::mutex> lock(pimpl_->stats_mutex_);
+        pimpl_->stats_.batches_run++;
+        pimpl_->stats_.checks_run += checks_run.load();
+        pimpl_->stats_.checks_skipped += count - checks_run.load();
+        if (failed) {
+            pimpl_->stats_.batches_failed++;
+        }
+    }
+
+    if (failed) {
+        const ScriptCheck& check = checks[fail_index];
+        return Result<void>::Error("Transaction " + std::to_string(check.tx_index) +
+                                   " invalid: Input " + std::to_string(check.input_index) +
+                                   " script validation failed: " + fail_error);
+    }
+
+    return Result<void>::Ok();
+}
+
+size_t ScriptCheckQueue::GetThreadCount() const {
+    return pimpl_->num_threads_;
+}
+
+CheckQueueStats ScriptCheckQueue::GetStats() const {
+    std::lock_guard<std::mutex> lock(pimpl_->stats_mutex_);
+    return pimpl_->stats_;
+}
+
+ScriptCheckQueue& ScriptCheckQueue::Global() {
+    std::lock_guard<std::mutex> lock(g_global_queue_mutex);
+    if (!g_global_queue) {
+        g_global_queue = std::make_unique<ScriptCheckQueue>(g_global_thread_count);
+    }
+    return *g_global_queue;
+}
+
+void ScriptCheckQueue::SetGlobalThreadCount(size_t num_threads) {
+    std::lock_guard<std::mutex> lock(g_global_queue_mutex);
+    g_global_thread_count = num_threads;
+    g_global_queue.reset();
+}
+
+} // namespace ibd
+} // namespace intcoin
@@ -4,6 +4,7 @@
 #include <intcoin/ibd/parallel_validation.h>
 #include <intcoin/block.h>
 #include <intcoin/transaction.h>
+#include <algorithm>
 #include <thread>
 #include <queue>
 #include <mutex>
@@ -79,6 +80,48 @@ void ThreadPool::SubmitTask(std::function<void()> task) {
     pimpl_->condition_.notify_one();
 }
 
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    // Shared with the helpers, which may only get to run after we return
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        size_t count{0};
+        const std::function<void(size_t)>* fn{nullptr};
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+    state->count = count;
+    state->fn = &fn;
+
+    auto work = [](State& st) {
+        size_t finished = 0;
+        for (size_t i = st.next.fetch_add(1); i < st.count; i = st.next.fetch_add(1)) {
+            (*st.fn)(i);
+            ++finished;
+        }
+        if (finished > 0 && st.done.fetch_add(finished) + finished == st.count) {
+            std::lock_guard<std::mutex> lock(st.mutex);
+            st.cv.notify_all();
+        }
+    };
+
+    const size_t helpers = count > 1 ? std::min(GetThreadCount(), count - 1) : 0;
+    for (size_t h = 0; h < helpers; ++h) {
+        SubmitTask([state, work] { work(*state); });
+    }
+
+    work(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->done.load() == count; });
+}
+
+ThreadPool& GetSharedThreadPool() {
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+    return pool;
+}
+
 // ParallelBlockProcessor implementation
 class ParallelBlockProcessor::Impl {
 public:
@@ -4,6 +4,7 @@
 
 #include "bolt_invoice.h"
 #include "intcoin/util.h"
+#include "intcoin/codec.h"
 #include <cstring>
 #include <sstream>
 #include <iomanip>
@@ -18,85 +19,12 @@ namespace bolt {
 // ============================================================================
 
 namespace {
-    const char* CHARSET = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
-
-    const uint32_t GENERATOR[] = {0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3};
-
-    // Polymod for Bech32 checksum
-    uint32_t PolyMod(const std::vector<uint8_t>& values) {
-        uint32_t chk = 1;
-        for (uint8_t v : values) {
-            uint8_t top = chk >> 25;
-            chk = (chk & 0x1ffffff) << 5 ^ v;
-            for (int i = 0; i < 5; i++) {
-                if ((top >> i) & 1) {
-                    chk ^= GENERATOR[i];
-                }
-            }
-        }
-        return chk;
-    }
-
-    // Expand HRP for checksum calculation
-    std::vector<uint8_t> ExpandHRP(const std::string& hrp) {
-        std::vector<uint8_t> result;
-        for (char c : hrp) {
-            result.push_back(c >> 5);
-        }
-        result.push_back(0);
-        for (char c : hrp) {
-            result.push_back(c & 31);
-        }
-        return result;
-    }
-
-    // Create checksum
-    std::vector<uint8_t> CreateChecksum(const std::string& hrp, const std::vector<uint8_t>& data) {
-        auto values = ExpandHRP(hrp);
-        values.insert(values.end(), data.begin(), data.end());
-        values.insert(values.end(), 6, 0);
-
-        uint32_t mod = PolyMod(values) ^ 1;
-
-        std::vector<uint8_t> checksum(6);
-        for (int i = 0; i < 6; i++) {
-            checksum[i] = (mod >> (5 * (5 - i))) & 31;
-        }
-        return checksum;
-    }
-
-    // Verify checksum
-    bool VerifyChecksum(const std::string& hrp, const std::vector<uint8_t>& data) {
-        auto values = ExpandHRP(hrp);
-        values.insert(values.end(), data.begin(), data.end());
-        return PolyMod(values) == 1;
-    }
-
-    // Convert between bit groups
-    [[maybe_unused]] std::vector<uint8_t> ConvertBits(const std::vector<uint8_t>& data, int frombits, int tobits, bool pad) {
+    // Convert between bit groups (empty on invalid input or padding)
+    std::vector<uint8_t> ConvertBits(const std::vector<uint8_t>& data, int frombits, int tobits, bool pad) {
         std::vector<uint8_t> result;
-        int acc = 0;
-        int bits = 0;
-        int maxv = (1 << tobits) - 1;
-        int max_acc = (1 << (frombits + tobits - 1)) - 1;
-
-        for (uint8_t value : data) {
-            acc = ((acc << frombits) | value) & max_acc;
-            bits += frombits;
-            while (bits >= tobits) {
-                bits -= tobits;
-                result.push_back((acc >> bits) & maxv);
-            }
-        }
-
-        if (pad) {
-            if (bits > 0) {
-                result.push_back((acc << (tobits - bits)) & maxv);
-            }
-        } else if (bits >= frombits || ((acc << (tobits - bits)) & maxv)) {
-            return {};  // Invalid padding
+        if (!codec::ConvertBits(data, frombits, tobits, pad, result)) {
+            return {};
         }
-
         return result;
     }
 
@@ -406,51 +334,19 @@ std::string LightningInvoice::Encode() const {
         write_tagged(static_cast<uint8_t>(InvoiceTag::FEATURES), features.value());
     }
 
-    // Signature (520 bits = 104 5-bit groups) - append after checksum calculation
-    auto signing_data = data;
-
-    // Add checksum
-    auto checksum = CreateChecksum(hrp, data);
-    data.insert(data.end(), checksum.begin(), checksum.end());
-
-    // Encode to Bech32
-    std::ostringstream result;
-    result << hrp << "1";
-    for (uint8_t d : data) {
-        result << CHARSET[d];
-    }
-
-    return result.str();
+    // Encode to Bech32 (checksum appended)
+    return codec::EncodeBech32Words(hrp, data);
 }
 
 Result<LightningInvoice> LightningInvoice::Decode(const std::string& bolt11_string) {
-    // Find separator
-    size_t sep_pos = bolt11_string.rfind('1');
-    if (sep_pos == std::string::npos || sep_pos == 0) {
-        return Result<LightningInvoice>::Error("Invalid invoice format");
-    }
-
-    std::string hrp = bolt11_string.substr(0, sep_pos);
-    std::string data_str = bolt11_string.substr(sep_pos + 1);
-
-    // Decode data part
+    // Split at the separator, decode the data part and verify the checksum
+    std::string hrp;
     std::vector<uint8_t> data;
-    for (char c : data_str) {
-        const char* pos = std::strchr(CHARSET, c);
-        if (!pos) {
-            return Result<LightningInvoice>::Error("Invalid character in invoice");
-        }
-        data.push_back(static_cast<uint8_t>(pos - CHARSET));
-    }
-
-    // Verify checksum
-    if (!VerifyChecksum(hrp, data)) {
-        return Result<LightningInvoice>::Error("Invalid checksum");
+    auto decode_result = codec::DecodeBech32Words(bolt11_string, hrp, data);
+    if (decode_result.IsError()) {
+        return Result<LightningInvoice>::Error("Invalid invoice: " + decode_result.error);
     }
 
-    // Remove checksum
-    data.resize(data.size() - 6);
-
     LightningInvoice invoice;
 
     // Parse HRP
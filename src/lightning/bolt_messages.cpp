@@ -4,6 +4,9 @@
 
 #include "bolt_messages.h"
 #include "intcoin/util.h"
+#include "intcoin/serialize.h"
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 namespace intcoin {
@@ -11,31 +14,67 @@ namespace bolt {
 
 // Helper functions for serialization
 namespace {
-    void WriteU16(std::vector<uint8_t>& data, uint16_t value) {
-        data.push_back((value >> 8) & 0xFF);
-        data.push_back(value & 0xFF);
+    // Writers take any stream with Write(const uint8_t*, size_t) (see
+    // serialize.h), so each message is sized with a SizeComputer and then
+    // encoded into an exactly-sized buffer. BOLT integers are big-endian.
+    template <typename Stream>
+    void WriteU8(Stream& s, uint8_t value) {
+        s.Write(&value, 1);
     }
 
-    void WriteU32(std::vector<uint8_t>& data, uint32_t value) {
-        data.push_back((value >> 24) & 0xFF);
-        data.push_back((value >> 16) & 0xFF);
-        data.push_back((value >> 8) & 0xFF);
-        data.push_back(value & 0xFF);
+    template <typename Stream>
+    void WriteU16(Stream& s, uint16_t value) {
+        const uint8_t buf[2] = {static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value)};
+        s.Write(buf, sizeof(buf));
     }
 
-    void WriteU64(std::vector<uint8_t>& data, uint64_t value) {
-        for (int i = 7; i >= 0; i--) {
-            data.push_back((value >> (i * 8)) & 0xFF);
+    template <typename Stream>
+    void WriteU32(Stream& s, uint32_t value) {
+        uint8_t buf[4];
+        for (int i = 0; i < 4; i++) {
+            buf[i] = static_cast<uint8_t>(value >> ((3 - i) * 8));
         }
+        s.Write(buf, sizeof(buf));
     }
 
-    void WriteBytes(std::vector<uint8_t>& data, const std::vector<uint8_t>& bytes) {
-        data.insert(data.end(), bytes.begin(), bytes.end());
+    template <typename Stream>
+    void WriteU64(Stream& s, uint64_t value) {
+        uint8_t buf[8];
+        for (int i = 0; i < 8; i++) {
+            buf[i] = static_cast<uint8_t>(value >> ((7 - i) * 8));
+        }
+        s.Write(buf, sizeof(buf));
+    }
+
+    template <typename Stream>
+    void WriteBytes(Stream& s, const std::vector<uint8_t>& bytes) {
+        s.Write(bytes.data(), bytes.size());
+    }
+
+    template <typename Stream>
+    void WriteUint256(Stream& s, const uint256& value) {
+        s.Write(value.data(), value.size());
+    }
+
+    // BigSize (as used by the existing TLV encoding)
+    template <typename Stream>
+    void WriteBigSize(Stream& s, uint64_t value) {
+        if (value < 253) {
+            WriteU8(s, static_cast<uint8_t>(value));
+        } else if (value < 65536) {
+            WriteU8(s, 253);
+            WriteU16(s, static_cast<uint16_t>(value));
+        } else {
+            WriteU8(s, 254);
+            WriteU32(s, static_cast<uint32_t>(value));
+        }
     }
 
-    void WriteUint256(std::vector<uint8_t>& data, const uint256& value) {
-        const uint8_t* bytes = value.data();
-        data.insert(data.end(), bytes, bytes + 32);
+    template <typename Stream>
+    void WriteTLV(Stream& s, uint64_t type, const std::vector<uint8_t>& value) {
+        WriteBigSize(s, type);
+        WriteBigSize(s, value.size());
+        WriteBytes(s, value);
     }
 
     uint16_t ReadU16(const std::vector<uint8_t>& data, size_t& offset) {
@@ -72,40 +111,41 @@ namespace {
         return result;
     }
 
+    // Fixed-size fields are copied straight out of the buffer (no temporaries)
+    template <size_t N>
+    void ReadArray(const std::vector<uint8_t>& data, size_t& offset, std::array<uint8_t, N>& out) {
+        if (offset + N > data.size()) return;
+        std::memcpy(out.data(), data.data() + offset, N);
+        offset += N;
+    }
+
     uint256 ReadUint256(const std::vector<uint8_t>& data, size_t& offset) {
-        if (offset + 32 > data.size()) return uint256();
-        std::vector<uint8_t> bytes(data.begin() + offset, data.begin() + offset + 32);
-        offset += 32;
-        uint256 result;
-        std::memcpy(result.data(), bytes.data(), 32);
+        uint256 result{};
+        ReadArray(data, offset, result);
         return result;
     }
 
     // Dilithium3 Signature helpers (3309 bytes)
-    void WriteSignature(std::vector<uint8_t>& data, const Signature& sig) {
-        data.insert(data.end(), sig.begin(), sig.end());
+    template <typename Stream>
+    void WriteSignature(Stream& s, const Signature& sig) {
+        s.Write(sig.data(), sig.size());
     }
 
     Signature ReadSignature(const std::vector<uint8_t>& data, size_t& offset) {
-        Signature sig;
-        auto sig_bytes = ReadBytes(data, offset, 3309);
-        if (sig_bytes.size() == 3309) {
-            std::copy(sig_bytes.begin(), sig_bytes.end(), sig.begin());
-        }
+        Signature sig{};
+        ReadArray(data, offset, sig);
         return sig;
     }
 
     // Dilithium3 PublicKey helpers (1952 bytes)
-    void WritePublicKey(std::vector<uint8_t>& data, const PublicKey& key) {
-        data.insert(data.end(), key.begin(), key.end());
+    template <typename Stream>
+    void WritePublicKey(Stream& s, const PublicKey& key) {
+        s.Write(key.data(), key.size());
     }
 
     PublicKey ReadPublicKey(const std::vector<uint8_t>& data, size_t& offset) {
-        PublicKey key;
-        auto key_bytes = ReadBytes(data, offset, 1952);
-        if (key_bytes.size() == 1952) {
-            std::copy(key_bytes.begin(), key_bytes.end(), key.begin());
-        }
+        PublicKey key{};
+        ReadArray(data, offset, key);
         return key;
     }
 }
@@ -115,31 +155,9 @@ namespace {
 // ============================================================================
 
 std::vector<uint8_t> TLVRecord::Serialize() const {
-    std::vector<uint8_t> data;
-    // Encode type (BigSize)
-    if (type < 253) {
-        data.push_back(static_cast<uint8_t>(type));
-    } else if (type < 65536) {
-        data.push_back(253);
-        WriteU16(data, static_cast<uint16_t>(type));
-    } else {
-        data.push_back(254);
-        WriteU32(data, static_cast<uint32_t>(type));
-    }
-    // Encode length (BigSize)
-    uint64_t length = value.size();
-    if (length < 253) {
-        data.push_back(static_cast<uint8_t>(length));
-    } else if (length < 65536) {
-        data.push_back(253);
-        WriteU16(data, static_cast<uint16_t>(length));
-    } else {
-        data.push_back(254);
-        WriteU32(data, static_cast<uint32_t>(length));
-    }
-    // Encode value
-    WriteBytes(data, value);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteTLV(s, type, value);
+    });
 }
 
 Result<TLVRecord> TLVRecord::Deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -187,10 +205,10 @@ Result<TLVRecord> TLVRecord::Deserialize(const std::vector<uint8_t>& data, size_
 }
 
 std::vector<uint8_t> MessageHeader::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteU16(data, type);
-    WriteU16(data, length);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteU16(s, type);
+        WriteU16(s, length);
+    });
 }
 
 Result<MessageHeader> MessageHeader::Deserialize(const std::vector<uint8_t>& data) {
@@ -211,17 +229,15 @@ Result<MessageHeader> MessageHeader::Deserialize(const std::vector<uint8_t>& dat
 // ============================================================================
 
 std::vector<uint8_t> InitMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteU16(data, global_features);
-    WriteU16(data, local_features);
-
-    // Encode TLV records
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
+    return SerializeExact([this](auto& s) {
+        WriteU16(s, global_features);
+        WriteU16(s, local_features);
 
-    return data;
+        // Encode TLV records
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<InitMessage> InitMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -246,13 +262,11 @@ Result<InitMessage> InitMessage::Deserialize(const std::vector<uint8_t>& data) {
 }
 
 std::vector<uint8_t> ErrorMessage::Serialize() const {
-    std::vector<uint8_t> result;
-    WriteUint256(result, channel_id);
-    WriteU16(result, static_cast<uint16_t>(data.length()));
-    for (char c : data) {
-        result.push_back(static_cast<uint8_t>(c));
-    }
-    return result;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU16(s, static_cast<uint16_t>(data.length()));
+        s.Write(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+    });
 }
 
 Result<ErrorMessage> ErrorMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -272,11 +286,11 @@ Result<ErrorMessage> ErrorMessage::Deserialize(const std::vector<uint8_t>& data)
 }
 
 std::vector<uint8_t> PingMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteU16(data, num_pong_bytes);
-    WriteU16(data, static_cast<uint16_t>(ignored.size()));
-    WriteBytes(data, ignored);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteU16(s, num_pong_bytes);
+        WriteU16(s, static_cast<uint16_t>(ignored.size()));
+        WriteBytes(s, ignored);
+    });
 }
 
 Result<PingMessage> PingMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -294,10 +308,10 @@ Result<PingMessage> PingMessage::Deserialize(const std::vector<uint8_t>& data) {
 }
 
 std::vector<uint8_t> PongMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteU16(data, static_cast<uint16_t>(ignored.size()));
-    WriteBytes(data, ignored);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteU16(s, static_cast<uint16_t>(ignored.size()));
+        WriteBytes(s, ignored);
+    });
 }
 
 Result<PongMessage> PongMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -318,35 +332,32 @@ Result<PongMessage> PongMessage::Deserialize(const std::vector<uint8_t>& data) {
 // ============================================================================
 
 std::vector<uint8_t> OpenChannelMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, chain_hash);
-    WriteUint256(data, temporary_channel_id);
-    WriteU64(data, funding_satoshis);
-    WriteU64(data, push_msat);
-    WriteU64(data, dust_limit_satoshis);
-    WriteU64(data, max_htlc_value_in_flight_msat);
-    WriteU64(data, channel_reserve_satoshis);
-    WriteU64(data, htlc_minimum_msat);
-    WriteU32(data, feerate_per_kw);
-    WriteU16(data, to_self_delay);
-    WriteU16(data, max_accepted_htlcs);
-
-    // Public keys (1952 bytes each for Dilithium3)
-    auto keys = {funding_pubkey, revocation_basepoint, payment_basepoint,
-                 delayed_payment_basepoint, htlc_basepoint, first_per_commitment_point};
-    for (const auto& key : keys) {
-        WriteBytes(data, std::vector<uint8_t>(key.begin(), key.end()));
-    }
-
-    data.push_back(channel_flags);
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, chain_hash);
+        WriteUint256(s, temporary_channel_id);
+        WriteU64(s, funding_satoshis);
+        WriteU64(s, push_msat);
+        WriteU64(s, dust_limit_satoshis);
+        WriteU64(s, max_htlc_value_in_flight_msat);
+        WriteU64(s, channel_reserve_satoshis);
+        WriteU64(s, htlc_minimum_msat);
+        WriteU32(s, feerate_per_kw);
+        WriteU16(s, to_self_delay);
+        WriteU16(s, max_accepted_htlcs);
+
+        // Public keys (1952 bytes each for Dilithium3)
+        for (const PublicKey* key : {&funding_pubkey, &revocation_basepoint, &payment_basepoint,
+                                     &delayed_payment_basepoint, &htlc_basepoint, &first_per_commitment_point}) {
+            WritePublicKey(s, *key);
+        }
 
-    // TLV records
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
+        WriteU8(s, channel_flags);
 
-    return data;
+        // TLV records
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<OpenChannelMessage> OpenChannelMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -399,15 +410,15 @@ Result<OpenChannelMessage> OpenChannelMessage::Deserialize(const std::vector<uin
 }
 
 std::vector<uint8_t> UpdateAddHTLCMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, id);
-    WriteU64(data, amount_msat);
-    WriteUint256(data, payment_hash);
-    WriteU32(data, cltv_expiry);
-    WriteU16(data, static_cast<uint16_t>(onion_routing_packet.size()));
-    WriteBytes(data, onion_routing_packet);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, id);
+        WriteU64(s, amount_msat);
+        WriteUint256(s, payment_hash);
+        WriteU32(s, cltv_expiry);
+        WriteU16(s, static_cast<uint16_t>(onion_routing_packet.size()));
+        WriteBytes(s, onion_routing_packet);
+    });
 }
 
 Result<UpdateAddHTLCMessage> UpdateAddHTLCMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -430,11 +441,11 @@ Result<UpdateAddHTLCMessage> UpdateAddHTLCMessage::Deserialize(const std::vector
 }
 
 std::vector<uint8_t> UpdateFulfillHTLCMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, id);
-    WriteUint256(data, payment_preimage);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, id);
+        WriteUint256(s, payment_preimage);
+    });
 }
 
 Result<UpdateFulfillHTLCMessage> UpdateFulfillHTLCMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -453,14 +464,14 @@ Result<UpdateFulfillHTLCMessage> UpdateFulfillHTLCMessage::Deserialize(const std
 }
 
 std::vector<uint8_t> CommitmentSignedMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteSignature(data, signature);
-    WriteU16(data, static_cast<uint16_t>(htlc_signatures.size()));
-    for (const auto& sig : htlc_signatures) {
-        WriteSignature(data, sig);
-    }
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteSignature(s, signature);
+        WriteU16(s, static_cast<uint16_t>(htlc_signatures.size()));
+        for (const auto& sig : htlc_signatures) {
+            WriteSignature(s, sig);
+        }
+    });
 }
 
 Result<CommitmentSignedMessage> CommitmentSignedMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -483,11 +494,11 @@ Result<CommitmentSignedMessage> CommitmentSignedMessage::Deserialize(const std::
 }
 
 std::vector<uint8_t> RevokeAndAckMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteUint256(data, per_commitment_secret);
-    WritePublicKey(data, next_per_commitment_point);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteUint256(s, per_commitment_secret);
+        WritePublicKey(s, next_per_commitment_point);
+    });
 }
 
 Result<RevokeAndAckMessage> RevokeAndAckMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -510,20 +521,20 @@ Result<RevokeAndAckMessage> RevokeAndAckMessage::Deserialize(const std::vector<u
 // ============================================================================
 
 std::vector<uint8_t> ChannelAnnouncementMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteSignature(data, node_signature_1);
-    WriteSignature(data, node_signature_2);
-    WriteSignature(data, bitcoin_signature_1);
-    WriteSignature(data, bitcoin_signature_2);
-    WriteU16(data, static_cast<uint16_t>(features.size()));
-    WriteBytes(data, features);
-    WriteUint256(data, chain_hash);
-    WriteU64(data, short_channel_id);
-    WritePublicKey(data, node_id_1);
-    WritePublicKey(data, node_id_2);
-    WritePublicKey(data, bitcoin_key_1);
-    WritePublicKey(data, bitcoin_key_2);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteSignature(s, node_signature_1);
+        WriteSignature(s, node_signature_2);
+        WriteSignature(s, bitcoin_signature_1);
+        WriteSignature(s, bitcoin_signature_2);
+        WriteU16(s, static_cast<uint16_t>(features.size()));
+        WriteBytes(s, features);
+        WriteUint256(s, chain_hash);
+        WriteU64(s, short_channel_id);
+        WritePublicKey(s, node_id_1);
+        WritePublicKey(s, node_id_2);
+        WritePublicKey(s, bitcoin_key_1);
+        WritePublicKey(s, bitcoin_key_2);
+    });
 }
 
 Result<ChannelAnnouncementMessage> ChannelAnnouncementMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -554,27 +565,26 @@ Result<ChannelAnnouncementMessage> ChannelAnnouncementMessage::Deserialize(const
 }
 
 std::vector<uint8_t> NodeAnnouncementMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteSignature(data, signature);
-    WriteU16(data, static_cast<uint16_t>(features.size()));
-    WriteBytes(data, features);
-    WriteU32(data, timestamp);
-    WritePublicKey(data, node_id);
-    data.insert(data.end(), rgb_color, rgb_color + 3);
-
-    // Alias (32 bytes, padded with zeros)
-    std::vector<uint8_t> alias_bytes(32, 0);
-    size_t copy_len = std::min(alias.length(), size_t(32));
-    std::memcpy(alias_bytes.data(), alias.data(), copy_len);
-    WriteBytes(data, alias_bytes);
-
-    WriteU16(data, static_cast<uint16_t>(addresses.size()));
-    for (const auto& addr : addresses) {
-        WriteU16(data, static_cast<uint16_t>(addr.size()));
-        WriteBytes(data, addr);
-    }
-
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteSignature(s, signature);
+        WriteU16(s, static_cast<uint16_t>(features.size()));
+        WriteBytes(s, features);
+        WriteU32(s, timestamp);
+        WritePublicKey(s, node_id);
+        s.Write(rgb_color, sizeof(rgb_color));
+
+        // Alias (32 bytes, padded with zeros)
+        uint8_t alias_bytes[32] = {};
+        size_t copy_len = std::min(alias.length(), sizeof(alias_bytes));
+        std::memcpy(alias_bytes, alias.data(), copy_len);
+        s.Write(alias_bytes, sizeof(alias_bytes));
+
+        WriteU16(s, static_cast<uint16_t>(addresses.size()));
+        for (const auto& addr : addresses) {
+            WriteU16(s, static_cast<uint16_t>(addr.size()));
+            WriteBytes(s, addr);
+        }
+    });
 }
 
 Result<NodeAnnouncementMessage> NodeAnnouncementMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -692,28 +702,25 @@ Result<FeatureFlags> FeatureFlags::Deserialize(const std::vector<uint8_t>& data)
 // ============================================================================
 
 std::vector<uint8_t> AcceptChannelMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, temporary_channel_id);
-    WriteU64(data, dust_limit_satoshis);
-    WriteU64(data, max_htlc_value_in_flight_msat);
-    WriteU64(data, channel_reserve_satoshis);
-    WriteU64(data, htlc_minimum_msat);
-    WriteU32(data, minimum_depth);
-    WriteU16(data, to_self_delay);
-    WriteU16(data, max_accepted_htlcs);
-
-    auto keys = {funding_pubkey, revocation_basepoint, payment_basepoint,
-                 delayed_payment_basepoint, htlc_basepoint, first_per_commitment_point};
-    for (const auto& key : keys) {
-        WritePublicKey(data, key);
-    }
-
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, temporary_channel_id);
+        WriteU64(s, dust_limit_satoshis);
+        WriteU64(s, max_htlc_value_in_flight_msat);
+        WriteU64(s, channel_reserve_satoshis);
+        WriteU64(s, htlc_minimum_msat);
+        WriteU32(s, minimum_depth);
+        WriteU16(s, to_self_delay);
+        WriteU16(s, max_accepted_htlcs);
+
+        for (const PublicKey* key : {&funding_pubkey, &revocation_basepoint, &payment_basepoint,
+                                     &delayed_payment_basepoint, &htlc_basepoint, &first_per_commitment_point}) {
+            WritePublicKey(s, *key);
+        }
 
-    return data;
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<AcceptChannelMessage> AcceptChannelMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -751,12 +758,12 @@ Result<AcceptChannelMessage> AcceptChannelMessage::Deserialize(const std::vector
 }
 
 std::vector<uint8_t> FundingCreatedMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, temporary_channel_id);
-    WriteUint256(data, funding_txid);
-    WriteU16(data, funding_output_index);
-    WriteSignature(data, signature);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, temporary_channel_id);
+        WriteUint256(s, funding_txid);
+        WriteU16(s, funding_output_index);
+        WriteSignature(s, signature);
+    });
 }
 
 Result<FundingCreatedMessage> FundingCreatedMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -776,10 +783,10 @@ Result<FundingCreatedMessage> FundingCreatedMessage::Deserialize(const std::vect
 }
 
 std::vector<uint8_t> FundingSignedMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteSignature(data, signature);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteSignature(s, signature);
+    });
 }
 
 Result<FundingSignedMessage> FundingSignedMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -797,16 +804,14 @@ Result<FundingSignedMessage> FundingSignedMessage::Deserialize(const std::vector
 }
 
 std::vector<uint8_t> FundingLockedMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WritePublicKey(data, next_per_commitment_point);
-
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WritePublicKey(s, next_per_commitment_point);
 
-    return data;
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<FundingLockedMessage> FundingLockedMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -831,11 +836,11 @@ Result<FundingLockedMessage> FundingLockedMessage::Deserialize(const std::vector
 }
 
 std::vector<uint8_t> ShutdownMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU16(data, static_cast<uint16_t>(scriptpubkey.size()));
-    WriteBytes(data, scriptpubkey);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU16(s, static_cast<uint16_t>(scriptpubkey.size()));
+        WriteBytes(s, scriptpubkey);
+    });
 }
 
 Result<ShutdownMessage> ShutdownMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -854,17 +859,15 @@ Result<ShutdownMessage> ShutdownMessage::Deserialize(const std::vector<uint8_t>&
 }
 
 std::vector<uint8_t> ClosingSignedMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, fee_satoshis);
-    WriteSignature(data, signature);
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, fee_satoshis);
+        WriteSignature(s, signature);
 
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
-
-    return data;
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<ClosingSignedMessage> ClosingSignedMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -890,12 +893,12 @@ Result<ClosingSignedMessage> ClosingSignedMessage::Deserialize(const std::vector
 }
 
 std::vector<uint8_t> UpdateFailHTLCMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, id);
-    WriteU16(data, static_cast<uint16_t>(reason.size()));
-    WriteBytes(data, reason);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, id);
+        WriteU16(s, static_cast<uint16_t>(reason.size()));
+        WriteBytes(s, reason);
+    });
 }
 
 Result<UpdateFailHTLCMessage> UpdateFailHTLCMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -915,10 +918,10 @@ Result<UpdateFailHTLCMessage> UpdateFailHTLCMessage::Deserialize(const std::vect
 }
 
 std::vector<uint8_t> UpdateFeeMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU32(data, feerate_per_kw);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU32(s, feerate_per_kw);
+    });
 }
 
 Result<UpdateFeeMessage> UpdateFeeMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -936,12 +939,12 @@ Result<UpdateFeeMessage> UpdateFeeMessage::Deserialize(const std::vector<uint8_t
 }
 
 std::vector<uint8_t> UpdateFailMalformedHTLCMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, id);
-    WriteUint256(data, sha256_of_onion);
-    WriteU16(data, failure_code);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, id);
+        WriteUint256(s, sha256_of_onion);
+        WriteU16(s, failure_code);
+    });
 }
 
 Result<UpdateFailMalformedHTLCMessage> UpdateFailMalformedHTLCMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -961,13 +964,13 @@ Result<UpdateFailMalformedHTLCMessage> UpdateFailMalformedHTLCMessage::Deseriali
 }
 
 std::vector<uint8_t> ChannelReestablishMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, next_commitment_number);
-    WriteU64(data, next_revocation_number);
-    WriteUint256(data, your_last_per_commitment_secret);
-    WritePublicKey(data, my_current_per_commitment_point);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, next_commitment_number);
+        WriteU64(s, next_revocation_number);
+        WriteUint256(s, your_last_per_commitment_secret);
+        WritePublicKey(s, my_current_per_commitment_point);
+    });
 }
 
 Result<ChannelReestablishMessage> ChannelReestablishMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -993,12 +996,12 @@ Result<ChannelReestablishMessage> ChannelReestablishMessage::Deserialize(const s
 // ============================================================================
 
 std::vector<uint8_t> AnnouncementSignaturesMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, channel_id);
-    WriteU64(data, short_channel_id);
-    WriteSignature(data, node_signature);
-    WriteSignature(data, bitcoin_signature);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, channel_id);
+        WriteU64(s, short_channel_id);
+        WriteSignature(s, node_signature);
+        WriteSignature(s, bitcoin_signature);
+    });
 }
 
 Result<AnnouncementSignaturesMessage> AnnouncementSignaturesMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -1018,23 +1021,22 @@ Result<AnnouncementSignaturesMessage> AnnouncementSignaturesMessage::Deserialize
 }
 
 std::vector<uint8_t> ChannelUpdateMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteSignature(data, signature);
-    WriteUint256(data, chain_hash);
-    WriteU64(data, short_channel_id);
-    WriteU32(data, timestamp);
-    data.push_back(message_flags);
-    data.push_back(channel_flags);
-    WriteU16(data, cltv_expiry_delta);
-    WriteU64(data, htlc_minimum_msat);
-    WriteU32(data, fee_base_msat);
-    WriteU32(data, fee_proportional_millionths);
-
-    if (htlc_maximum_msat.has_value()) {
-        WriteU64(data, htlc_maximum_msat.value());
-    }
-
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteSignature(s, signature);
+        WriteUint256(s, chain_hash);
+        WriteU64(s, short_channel_id);
+        WriteU32(s, timestamp);
+        WriteU8(s, message_flags);
+        WriteU8(s, channel_flags);
+        WriteU16(s, cltv_expiry_delta);
+        WriteU64(s, htlc_minimum_msat);
+        WriteU32(s, fee_base_msat);
+        WriteU32(s, fee_proportional_millionths);
+
+        if (htlc_maximum_msat.has_value()) {
+            WriteU64(s, htlc_maximum_msat.value());
+        }
+    });
 }
 
 Result<ChannelUpdateMessage> ChannelUpdateMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -1064,19 +1066,17 @@ Result<ChannelUpdateMessage> ChannelUpdateMessage::Deserialize(const std::vector
 }
 
 std::vector<uint8_t> QueryShortChannelIdsMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, chain_hash);
-    WriteU16(data, static_cast<uint16_t>(short_channel_ids.size()));
-    for (uint64_t scid : short_channel_ids) {
-        WriteU64(data, scid);
-    }
-
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, chain_hash);
+        WriteU16(s, static_cast<uint16_t>(short_channel_ids.size()));
+        for (uint64_t scid : short_channel_ids) {
+            WriteU64(s, scid);
+        }
 
-    return data;
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<QueryShortChannelIdsMessage> QueryShortChannelIdsMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -1105,10 +1105,10 @@ Result<QueryShortChannelIdsMessage> QueryShortChannelIdsMessage::Deserialize(con
 }
 
 std::vector<uint8_t> ReplyShortChannelIdsEndMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, chain_hash);
-    data.push_back(complete);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, chain_hash);
+        WriteU8(s, complete);
+    });
 }
 
 Result<ReplyShortChannelIdsEndMessage> ReplyShortChannelIdsEndMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -1126,17 +1126,15 @@ Result<ReplyShortChannelIdsEndMessage> ReplyShortChannelIdsEndMessage::Deseriali
 }
 
 std::vector<uint8_t> QueryChannelRangeMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, chain_hash);
-    WriteU32(data, first_blocknum);
-    WriteU32(data, number_of_blocks);
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, chain_hash);
+        WriteU32(s, first_blocknum);
+        WriteU32(s, number_of_blocks);
 
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
-
-    return data;
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<QueryChannelRangeMessage> QueryChannelRangeMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -1162,22 +1160,20 @@ Result<QueryChannelRangeMessage> QueryChannelRangeMessage::Deserialize(const std
 }
 
 std::vector<uint8_t> ReplyChannelRangeMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, chain_hash);
-    WriteU32(data, first_blocknum);
-    WriteU32(data, number_of_blocks);
-    data.push_back(complete);
-    WriteU16(data, static_cast<uint16_t>(short_channel_ids.size()));
-    for (uint64_t scid : short_channel_ids) {
-        WriteU64(data, scid);
-    }
-
-    for (const auto& [type, value] : tlv_records) {
-        TLVRecord record{type, value};
-        WriteBytes(data, record.Serialize());
-    }
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, chain_hash);
+        WriteU32(s, first_blocknum);
+        WriteU32(s, number_of_blocks);
+        WriteU8(s, complete);
+        WriteU16(s, static_cast<uint16_t>(short_channel_ids.size()));
+        for (uint64_t scid : short_channel_ids) {
+            WriteU64(s, scid);
+        }
 
-    return data;
+        for (const auto& [type, value] : tlv_records) {
+            WriteTLV(s, type, value);
+        }
+    });
 }
 
 Result<ReplyChannelRangeMessage> ReplyChannelRangeMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -1209,11 +1205,11 @@ Result<ReplyChannelRangeMessage> ReplyChannelRangeMessage::Deserialize(const std
 }
 
 std::vector<uint8_t> GossipTimestampFilterMessage::Serialize() const {
-    std::vector<uint8_t> data;
-    WriteUint256(data, chain_hash);
-    WriteU32(data, first_timestamp);
-    WriteU32(data, timestamp_range);
-    return data;
+    return SerializeExact([this](auto& s) {
+        WriteUint256(s, chain_hash);
+        WriteU32(s, first_timestamp);
+        WriteU32(s, timestamp_range);
+    });
 }
 
 Result<GossipTimestampFilterMessage> GossipTimestampFilterMessage::Deserialize(const std::vector<uint8_t>& data) {
@@ -5,6 +5,7 @@
 #include "intcoin/blockchain.h"
 #include "intcoin/wallet.h"
 #include "intcoin/util.h"
+#include "intcoin/codec.h"
 #include "intcoin/crypto.h"
 #include <queue>
 #include <algorithm>
@@ -1127,10 +1128,8 @@ std::string Invoice::Encode() const {
     oss << std::hex << std::setw(8) << expiry;
 
     // Add description length and description (simple encoding)
-    std::string desc_hex;
-    for (char c : description) {
-        oss << std::hex << std::setw(2) << static_cast<int>(c);
-    }
+    oss << codec::EncodeHex(std::span(reinterpret_cast<const uint8_t*>(description.data()),
+                                      description.size()));
 
     // Note: Full BOLT #11 would include bech32 encoding, routing hints, etc.
     // This is a simplified version for INTcoin
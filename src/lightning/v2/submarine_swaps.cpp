@@ -2,12 +2,12 @@
 // Distributed under the MIT software license
 
 #include <intcoin/lightning/v2/submarine_swaps.h>
-#include <sstream>
+#include <intcoin/codec.h>
 #include <algorithm>
 #include <map>
 #include <random>
-#include <iomanip>
 #include <cstring>
+#include <stdexcept>
 #include <ctime>
 #include <openssl/sha.h>
 #include <openssl/rand.h>
@@ -548,12 +548,7 @@ std::string SubmarineSwapManager::Impl::GenerateLockupAddress(
 std::string SubmarineSwapManager::Impl::BytesToHex(
     const std::vector<uint8_t>& bytes
 ) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (uint8_t byte : bytes) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    return oss.str();
+    return codec::EncodeHex(bytes);
 }
 
 /**
@@ -563,10 +558,8 @@ std::vector<uint8_t> SubmarineSwapManager::Impl::HexToBytes(
     const std::string& hex
 ) {
     std::vector<uint8_t> bytes;
-    for (size_t i = 0; i < hex.length(); i += 2) {
-        std::string byte_str = hex.substr(i, 2);
-        uint8_t byte = static_cast<uint8_t>(std::stoi(byte_str, nullptr, 16));
-        bytes.push_back(byte);
+    if (!codec::DecodeHex(hex, bytes)) {
+        throw std::invalid_argument("Invalid hex string");
     }
     return bytes;
 }
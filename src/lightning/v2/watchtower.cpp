@@ -2,6 +2,7 @@
 // Distributed under the MIT software license
 
 #include <intcoin/lightning/v2/watchtower.h>
+#include <intcoin/codec.h>
 #include <sstream>
 #include <algorithm>
 #include <map>
@@ -297,14 +298,8 @@ public:
     std::string BroadcastPenaltyTransaction(const std::vector<uint8_t>& penalty_tx) {
         // In production, this would broadcast to the network via RPC
         // For now, generate a simulated txid
-        std::string txid = "penalty_";
-        for (size_t i = 0; i < 32 && i < penalty_tx.size(); i++) {
-            char hex[3];
-            snprintf(hex, sizeof(hex), "%02x", penalty_tx[i]);
-            txid += hex;
-        }
-
-        return txid;
+        const size_t prefix_len = std::min<size_t>(penalty_tx.size(), 32);
+        return "penalty_" + codec::EncodeHex(std::span(penalty_tx).first(prefix_len));
     }
 
     // Helper: Generate simulated transaction data for testing
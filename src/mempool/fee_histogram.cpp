@@ -0,0 +1,63 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include <intcoin/fee_histogram.h>
+
+#include <algorithm>
+
+namespace intcoin {
+
+size_t FeeHistogram::BucketIndex(uint64_t fee_rate) {
+    auto it = std::upper_bound(BUCKET_MIN_FEE_RATES.begin(), BUCKET_MIN_FEE_RATES.end(), fee_rate);
+    return static_cast<size_t>(it - BUCKET_MIN_FEE_RATES.begin()) - 1;
+}
+
+void FeeHistogram::Add(uint64_t fee, uint64_t size_bytes) {
+    Bucket& bucket = buckets_[BucketIndex(fee / std::max<uint64_t>(size_bytes, 1))];
+    bucket.count++;
+    bucket.size_bytes += size_bytes;
+    bucket.fees += fee;
+    count_++;
+    size_bytes_ += size_bytes;
+    fees_ += fee;
+}
+
+void FeeHistogram::Remove(uint64_t fee, uint64_t size_bytes) {
+    Bucket& bucket = buckets_[BucketIndex(fee / std::max<uint64_t>(size_bytes, 1))];
+    if (bucket.count == 0) {
+        return;
+    }
+    bucket.count--;
+    bucket.size_bytes -= std::min(bucket.size_bytes, size_bytes);
+    bucket.fees -= std::min(bucket.fees, fee);
+    count_--;
+    size_bytes_ -= std::min(size_bytes_, size_bytes);
+    fees_ -= std::min(fees_, fee);
+}
+
+void FeeHistogram::Clear() {
+    buckets_.fill(Bucket{});
+    count_ = 0;
+    size_bytes_ = 0;
+    fees_ = 0;
+}
+
+double FeeHistogram::GetFeeRatePercentile(double fraction) const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count_));
+    rank = std::min(rank, count_ - 1);
+
+    uint64_t seen = 0;
+    for (const Bucket& bucket : buckets_) {
+        seen += bucket.count;
+        if (seen > rank) {
+            return static_cast<double>(bucket.fees) / static_cast<double>(std::max<uint64_t>(bucket.size_bytes, 1));
+        }
+    }
+    return 0.0;
+}
+
+} // namespace intcoin
@@ -4,17 +4,28 @@
 #include <intcoin/mempool.h>
 #include <intcoin/blockchain.h>
 #include <intcoin/util.h>
+#include <intcoin/codec.h>
 #include <intcoin/contracts/transaction.h>
 #include <intcoin/contracts/validator.h>
 #include <intcoin/crypto.h>
+#include <intcoin/serialize.h>
+#include <intcoin/ibd/parallel_validation.h>
 
 #include <unordered_map>
+#include <unordered_set>
+#include <array>
+#include <span>
 #include <set>
 #include <queue>
+#include <deque>
+#include <random>
 #include <mutex>
+#include <atomic>
 #include <algorithm>
 #include <fstream>
+#include <cstdio>
 #include <ctime>
+#include <cmath>
 
 namespace intcoin {
 
@@ -41,45 +52,411 @@ TxPriority StringToTxPriority(const std::string& str) {
     return TxPriority::NORMAL;
 }
 
+namespace {
+
+__extension__ typedef unsigned __int128 uint128;
+
+/// Feerate as an exact fee / size fraction
+struct Feerate {
+    uint64_t fee;
+    uint64_t size;
+};
+
+/// a < b, compared by cross-multiplication so no precision is lost
+bool FeerateLess(const Feerate& a, const Feerate& b) {
+    return uint128(a.fee) * std::max<uint64_t>(b.size, 1) <
+           uint128(b.fee) * std::max<uint64_t>(a.size, 1);
+}
+
+bool FeerateEqual(const Feerate& a, const Feerate& b) {
+    return !FeerateLess(a, b) && !FeerateLess(b, a);
+}
+
+/// Fee including any PrioritiseTransaction delta (never negative)
+uint64_t ModifiedFee(const MempoolEntry& entry) {
+    int64_t modified = static_cast<int64_t>(entry.fee) + entry.fee_delta;
+    return modified > 0 ? static_cast<uint64_t>(modified) : 0;
+}
+
+/// Mining score: the lower of the entry's own feerate and its ancestor
+/// package feerate, so a child can pull a cheap parent in (CPFP) but a
+/// cheap child never rides on an expensive parent.
+Feerate AncestorScore(const MempoolEntry& entry) {
+    Feerate own{ModifiedFee(entry), entry.size_bytes};
+    Feerate package{entry.ancestor_fees, entry.ancestor_size};
+    return FeerateLess(package, own) ? package : own;
+}
+
+/// Eviction score: the higher of the entry's own feerate and its descendant
+/// package feerate, so a parent paid for by its children is kept.
+Feerate DescendantScore(const MempoolEntry& entry) {
+    Feerate own{ModifiedFee(entry), entry.size_bytes};
+    Feerate package{entry.descendant_fees, entry.descendant_size};
+    return FeerateLess(own, package) ? package : own;
+}
+
+/// Best block candidate first: priority class, then ancestor score
+struct CompareByAncestorScore {
+    bool operator()(const MempoolEntry* a, const MempoolEntry* b) const {
+        if (a->priority != b->priority) return a->priority > b->priority;
+        Feerate sa = AncestorScore(*a);
+        Feerate sb = AncestorScore(*b);
+        if (!FeerateEqual(sa, sb)) return FeerateLess(sb, sa);
+        if (a->ancestor_count != b->ancestor_count) return a->ancestor_count < b->ancestor_count;
+        return a->tx_hash < b->tx_hash;
+    }
+
+    // Same order over the immutable copies readers share
+    bool operator()(const std::shared_ptr<const MempoolEntry>& a,
+                    const std::shared_ptr<const MempoolEntry>& b) const {
+        return (*this)(a.get(), b.get());
+    }
+};
+
+/// Best eviction candidate first: priority class, then descendant score,
+/// then the most recently added
+struct CompareByDescendantScore {
+    bool operator()(const MempoolEntry* a, const MempoolEntry* b) const {
+        if (a->priority != b->priority) return a->priority < b->priority;
+        Feerate sa = DescendantScore(*a);
+        Feerate sb = DescendantScore(*b);
+        if (!FeerateEqual(sa, sb)) return FeerateLess(sa, sb);
+        if (a->added_time != b->added_time) return a->added_time > b->added_time;
+        return a->tx_hash < b->tx_hash;
+    }
+};
+
+/// Oldest first
+struct CompareByEntryTime {
+    bool operator()(const MempoolEntry* a, const MempoolEntry* b) const {
+        if (a->added_time != b->added_time) return a->added_time < b->added_time;
+        return a->tx_hash < b->tx_hash;
+    }
+};
+
+/// Highest gas price first (ties: lowest nonce, then hash)
+struct CompareByGasPrice {
+    bool operator()(const MempoolEntry* a, const MempoolEntry* b) const {
+        if (a->gas_price != b->gas_price) return a->gas_price > b->gas_price;
+        if (a->contract_nonce != b->contract_nonce) return a->contract_nonce < b->contract_nonce;
+        return a->tx_hash < b->tx_hash;
+    }
+};
+
+/// Approximate heap footprint of an entry: its hash map node, the
+/// transaction's buffers and one node in each index
+uint64_t EntryMemoryUsage(const MempoolEntry& entry) {
+    constexpr uint64_t INDEX_NODE_SIZE = 4 * sizeof(void*) + sizeof(MempoolEntry*);
+    uint64_t usage = sizeof(MempoolEntry) + sizeof(uint256) + 2 * sizeof(void*);
+    usage += entry.tx.inputs.capacity() * sizeof(TxIn);
+    usage += entry.tx.outputs.capacity() * sizeof(TxOut);
+    for (const auto& input : entry.tx.inputs) usage += input.script_sig.bytes.capacity();
+    for (const auto& output : entry.tx.outputs) usage += output.script_pubkey.bytes.capacity();
+    usage += entry.tx.contract_data.capacity();
+    usage += entry.contract_sender.capacity();
+    usage += 4 * INDEX_NODE_SIZE;  // three score/time indexes and a priority queue
+    return usage;
+}
+
+/// Gas a block may use
+constexpr uint64_t BLOCK_GAS_LIMIT = 30'000'000;
+
+/// Rolling minimum fee half-life once a block has been seen since the bump
+constexpr double ROLLING_FEE_HALFLIFE = 60 * 60 * 12;
+
+/// Orphans larger than this are not held (bytes)
+constexpr uint64_t MAX_ORPHAN_TX_SIZE = 100000;
+
+/// Seconds between sweeps of the orphan pool for expired entries
+constexpr std::time_t ORPHAN_SWEEP_INTERVAL = 60;
+
+/// First 16 hex digits of a txid, for log lines
+std::array<char, 17> ShortHash(const uint256& hash) {
+    std::array<char, 17> out{};
+    codec::HexToChars(out.data(), out.data() + 16, std::span<const uint8_t>(hash).first(8));
+    return out;
+}
+
+/// Parsed header fields of a contract deployment or call
+struct ContractMeta {
+    std::string from_address;
+    uint64_t nonce = 0;
+    uint64_t gas_limit = 0;
+    uint64_t gas_price = 0;
+};
+
+bool ParseContractMeta(const Transaction& tx, ContractMeta& meta) {
+    if (tx.IsContractDeployment()) {
+        auto deploy_result = contracts::ContractDeploymentTx::Deserialize(tx.contract_data);
+        if (!deploy_result.has_value()) return false;
+        const auto& deploy_tx = deploy_result.value();
+        meta.from_address = PublicKeyToAddress(deploy_tx.from);
+        meta.nonce = deploy_tx.nonce;
+        meta.gas_limit = deploy_tx.gas_limit;
+        meta.gas_price = deploy_tx.gas_price;
+        return true;
+    }
+    if (tx.IsContractCall()) {
+        auto call_result = contracts::ContractCallTx::Deserialize(tx.contract_data);
+        if (!call_result.has_value()) return false;
+        const auto& call_tx = call_result.value();
+        meta.from_address = PublicKeyToAddress(call_tx.from);
+        meta.nonce = call_tx.nonce;
+        meta.gas_limit = call_tx.gas_limit;
+        meta.gas_price = call_tx.gas_price;
+        return true;
+    }
+    return false;
+}
+
+/// Version of the mempool.dat layout (1 was a header-only placeholder)
+constexpr uint32_t MEMPOOL_DUMP_VERSION = 2;
+
+/// Writes serialized bytes straight into a file stream
+class FileWriter {
+public:
+    explicit FileWriter(std::ostream& out) : out_(out) {}
+
+    FileWriter& Write(const uint8_t* data, size_t len) {
+        out_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(len));
+        return *this;
+    }
+
+private:
+    std::ostream& out_;
+};
+
+/// Reads serialized bytes from a file stream of known length, so records
+/// are decoded as they are read rather than from a whole-file buffer
+class FileReader {
+public:
+    FileReader(std::istream& in, uint64_t size) : in_(in), remaining_(size) {}
+
+    bool Read(uint8_t* out, size_t len) {
+        if (len > remaining_) {
+            return false;
+        }
+        in_.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(len));
+        if (static_cast<size_t>(in_.gcount()) != len) {
+            remaining_ = 0;
+            return false;
+        }
+        remaining_ -= len;
+        return true;
+    }
+
+    size_t Remaining() const { return remaining_; }
+
+private:
+    std::istream& in_;
+    uint64_t remaining_;
+};
+
+/// One mempool.dat record
+struct DumpedTx {
+    Transaction tx;
+    TxPriority priority = TxPriority::NORMAL;
+    int64_t fee_delta = 0;
+    std::time_t added_time = 0;
+};
+
+template <typename Stream>
+void SerializeDumpedEntry(Stream& s, const MempoolEntry& entry) {
+    entry.tx.Serialize(s);
+    // Transaction::Serialize covers the UTXO fields only
+    SerializeUint8(s, static_cast<uint8_t>(entry.tx.type));
+    SerializeVarInt(s, entry.tx.contract_data.size());
+    SerializeBytes(s, entry.tx.contract_data.data(), entry.tx.contract_data.size());
+    SerializeUint8(s, static_cast<uint8_t>(entry.priority));
+    SerializeUint64(s, static_cast<uint64_t>(entry.fee_delta));
+    SerializeUint64(s, static_cast<uint64_t>(entry.added_time));
+}
+
+template <typename Stream>
+Result<void> UnserializeDumpedTx(Stream& s, DumpedTx& out) {
+    auto tx_result = out.tx.Unserialize(s);
+    if (tx_result.IsError()) {
+        return tx_result;
+    }
+
+    uint8_t type = 0;
+    uint64_t contract_size = 0;
+    uint8_t priority = 0;
+    uint64_t fee_delta = 0;
+    uint64_t added_time = 0;
+    if (!UnserializeUint8(s, type) ||
+        !UnserializeVarInt(s, contract_size) ||
+        !UnserializeByteVector(s, out.tx.contract_data, contract_size) ||
+        !UnserializeUint8(s, priority) ||
+        !UnserializeUint64(s, fee_delta) ||
+        !UnserializeUint64(s, added_time)) {
+        return Result<void>::Error("Truncated mempool entry");
+    }
+    if (priority > static_cast<uint8_t>(TxPriority::CRITICAL)) {
+        return Result<void>::Error("Invalid mempool entry priority");
+    }
+
+    out.tx.type = static_cast<TxType>(type);
+    out.priority = static_cast<TxPriority>(priority);
+    out.fee_delta = static_cast<int64_t>(fee_delta);
+    out.added_time = static_cast<std::time_t>(added_time);
+    return Result<void>::Ok();
+}
+
+} // namespace
+
+/// Output of the lock-free admission stage
+struct INTcoinMempool::PreparedTx {
+    const Transaction* tx = nullptr;
+    uint256 tx_hash{};
+    uint64_t size_bytes = 0;
+    std::string error;                        // first failed check, empty if all passed
+    std::vector<std::optional<TxOut>> coins;  // per input, when a coin lookup is set
+    ContractMeta contract;                    // parsed header of contract transactions
+    std::optional<uint64_t> chain_nonce;      // sender's next nonce, when a nonce lookup is set
+};
+
+struct INTcoinMempool::DumpBatch {
+    std::vector<DumpedTx> dumped;     // records in file order
+    std::vector<PreparedTx> prepared;  // admission stage, one per record
+};
+
 // Implementation details
 struct INTcoinMempool::Impl {
     MempoolConfig config;
     bool is_initialized;
     mutable std::mutex mutex;
 
-    // Transaction storage
-    std::unordered_map<std::string, MempoolEntry> entries;
+    // Transaction storage. Entries are node-allocated, so the indexes below
+    // hold stable pointers into it. An entry must be taken out of the score
+    // indexes before its aggregates change and put back afterwards.
+    std::unordered_map<uint256, MempoolEntry, uint256_hash> entries;
+
+    // Ordered indexes over entries
+    std::set<MempoolEntry*, CompareByAncestorScore> by_ancestor_score;      // template order
+    std::set<MempoolEntry*, CompareByDescendantScore> by_descendant_score;  // eviction order
+    std::set<MempoolEntry*, CompareByEntryTime> by_entry_time;              // expiry order
 
     // Priority queues (sorted by fee_per_byte within each priority)
-    std::map<TxPriority, std::multimap<uint64_t, std::string>> priority_queues;
+    std::map<TxPriority, std::set<std::pair<uint64_t, uint256>>> priority_queues;
+
+    // Orphan transactions (waiting for parents). Each keeps its prepared
+    // state, so admitting it later only repeats the locked stage.
+    struct OrphanEntry {
+        Transaction tx;
+        PreparedTx prepared;     // prepared.tx points at tx above
+        TxPriority priority;
+        uint64_t peer_id;
+        std::time_t expiry;
+        size_t list_pos;         // position in orphan_list
+    };
+    std::unordered_map<uint256, OrphanEntry, uint256_hash> orphan_txs;
+    std::map<OutPoint, std::set<uint256>> orphans_by_outpoint;  // spent outpoint -> orphans
+    std::vector<uint256> orphan_list;                            // for uniform random eviction
+    std::unordered_map<uint64_t, uint32_t> orphans_per_peer;
+    uint64_t orphan_bytes = 0;
+    std::time_t next_orphan_sweep = 0;
+    std::mt19937_64 orphan_rng{std::random_device{}()};
+    std::deque<uint256> orphan_work;  // accepted txids whose orphans should be retried
+
+    // Contract transactions, queued per sender in nonce order. A sender's
+    // lowest queued nonce is executable unless the chain is known to expect
+    // an earlier one; executable heads are also indexed by gas price for
+    // template building. Queues only exist while they hold entries.
+    struct SenderQueue {
+        std::map<uint64_t, MempoolEntry*> by_nonce;
+        std::optional<uint64_t> chain_nonce;  // next nonce on chain, from the last lookup or block
+        MempoolEntry* head = nullptr;         // entry in contract_heads, if any
+    };
+    std::unordered_map<std::string, SenderQueue> senders;
+    std::set<MempoolEntry*, CompareByGasPrice> contract_heads;
+    uint64_t total_gas_in_mempool;  // Total gas for all contract txs in mempool
 
-    // Orphan transactions (waiting for parent)
-    std::unordered_map<std::string, MempoolEntry> orphan_txs;
+    // Running totals, updated on every insert and remove
+    uint64_t total_size_bytes = 0;
+    uint64_t total_fees = 0;
+    uint64_t total_fee_per_byte = 0;
+    uint64_t total_memory_bytes = 0;
+    std::map<TxPriority, uint64_t> size_by_priority;
+    std::multiset<uint64_t> fees;  // for min / max
+    FeeHistogram fee_histogram;
+    std::map<TxPriority, FeeHistogram> fee_histogram_by_priority;
+
+    // Rolling minimum fee (ints/KB). TrimToSize raises it above what was
+    // evicted; once a block has been seen since then it decays by half
+    // every ROLLING_FEE_HALFLIFE (faster while the mempool is small).
+    mutable double rolling_min_fee_per_kb = 0;
+    mutable std::time_t last_rolling_fee_update = 0;
+    bool block_since_rolling_fee_bump = false;
+
+    // Outputs spent by mempool entries (conflict detection)
+    std::map<OutPoint, uint256> spent_outpoints;
+
+    // Published read snapshot. Writers only note which entries changed
+    // (snapshot_dirty, under mutex); the first reader after a change
+    // publishes, see PublishSnapshot.
+    mutable std::atomic<std::shared_ptr<const MempoolSnapshot>> snapshot;
+    mutable std::unordered_set<uint256, uint256_hash> snapshot_dirty;
+    std::atomic<uint64_t> snapshot_changes{0};            // bumped by every change
+    mutable std::atomic<uint64_t> snapshot_published{0};  // changes the snapshot reflects
+
+    // Publisher state, guarded by publish_mutex (taken before mutex, never
+    // while holding it): immutable copies of the entries in template order
+    mutable std::mutex publish_mutex;
+    mutable std::unordered_map<uint256, std::shared_ptr<const MempoolEntry>, uint256_hash> snapshot_entries;
+    mutable std::set<std::shared_ptr<const MempoolEntry>, CompareByAncestorScore> snapshot_order;
+    mutable uint64_t snapshot_sequence = 0;
+
+    // Admission hooks, called outside the lock (optional)
+    CoinLookup coin_lookup;
+    TxCheck tx_check;
+    NonceLookup nonce_lookup;
+
+    Impl() : is_initialized(false), total_gas_in_mempool(0),
+             snapshot(std::make_shared<const MempoolSnapshot>()) {}
 
-    // Contract transaction tracking
-    std::unordered_map<std::string, uint64_t> address_nonces;  // address -> next expected nonce
-    std::unordered_map<std::string, std::string> nonce_to_tx;  // "address:nonce" -> tx_hash
-    uint64_t total_gas_in_mempool;  // Total gas for all contract txs in mempool
+    // Helper: Calculate total mempool size
+    uint64_t GetTotalSize() const {
+        return total_size_bytes;
+    }
 
-    Impl() : is_initialized(false), total_gas_in_mempool(0) {}
+    uint64_t MaxSizeBytes() const {
+        return config.max_size_mb * 1024 * 1024;
+    }
 
-    // Helper: Convert uint256 to hex string
-    std::string Uint256ToHex(const uint256& hash) const {
-        std::ostringstream oss;
-        oss << std::hex << std::setfill('0');
-        for (uint8_t byte : hash) {
-            oss << std::setw(2) << static_cast<int>(byte);
+    // Helper: Current rolling minimum fee, applying any decay due
+    uint64_t GetRollingMinFee() const {
+        if (!block_since_rolling_fee_bump || rolling_min_fee_per_kb == 0) {
+            return static_cast<uint64_t>(rolling_min_fee_per_kb);
         }
-        return oss.str();
-    }
 
-    // Helper: Calculate total mempool size
-    uint64_t GetTotalSize() const {
-        uint64_t total = 0;
-        for (const auto& pair : entries) {
-            total += pair.second.size_bytes;
+        std::time_t now = std::time(nullptr);
+        if (now > last_rolling_fee_update + 10) {
+            double halflife = ROLLING_FEE_HALFLIFE;
+            if (total_size_bytes < MaxSizeBytes() / 4) {
+                halflife /= 4;
+            } else if (total_size_bytes < MaxSizeBytes() / 2) {
+                halflife /= 2;
+            }
+            rolling_min_fee_per_kb /= std::pow(2.0, static_cast<double>(now - last_rolling_fee_update) / halflife);
+            last_rolling_fee_update = now;
+
+            if (rolling_min_fee_per_kb < config.incremental_relay_fee_per_kb / 2.0) {
+                rolling_min_fee_per_kb = 0;
+                return 0;
+            }
         }
-        return total;
+        return std::max(static_cast<uint64_t>(rolling_min_fee_per_kb), config.incremental_relay_fee_per_kb);
+    }
+
+    // Helper: Admission floor (ints/KB)
+    uint64_t GetMinFeePerKb() const {
+        return std::max(config.min_relay_fee_per_kb, GetRollingMinFee());
+    }
+
+    // Helper: fee (ints) over size (bytes) meets a per-KB rate
+    static bool MeetsFeeRate(uint64_t fee, uint64_t size, uint64_t fee_per_kb) {
+        return uint128(fee) * 1000 >= uint128(fee_per_kb) * size;
     }
 
     // Helper: Get count for priority level
@@ -88,6 +465,613 @@ struct INTcoinMempool::Impl {
         if (it == priority_queues.end()) return 0;
         return it->second.size();
     }
+
+    MempoolEntry* Find(const uint256& tx_hash) {
+        auto it = entries.find(tx_hash);
+        return it == entries.end() ? nullptr : &it->second;
+    }
+
+    // Helper: Re-pick a sender's executable head after its queue changed
+    void RefreshSenderHead(SenderQueue& queue) {
+        if (queue.head != nullptr) {
+            contract_heads.erase(queue.head);
+            queue.head = nullptr;
+        }
+        if (queue.by_nonce.empty()) return;
+
+        MempoolEntry* first = queue.by_nonce.begin()->second;
+        if (!queue.chain_nonce || first->contract_nonce == *queue.chain_nonce) {
+            queue.head = first;
+            contract_heads.insert(first);
+        }
+    }
+
+    // Helper: Record the chain's next nonce for a sender with queued
+    // entries. Entries below it can never be mined and are dropped.
+    void SetChainNonce(const std::string& sender, uint64_t chain_nonce) {
+        auto it = senders.find(sender);
+        while (it != senders.end() && it->second.by_nonce.begin()->first < chain_nonce) {
+            // Removing the last entry erases the queue
+            RemoveWithDescendants(it->second.by_nonce.begin()->second);
+            it = senders.find(sender);
+        }
+        if (it != senders.end()) {
+            it->second.chain_nonce = chain_nonce;
+            RefreshSenderHead(it->second);
+        }
+    }
+
+    // Helper: Take an entry out of / back into the score indexes
+    void UnindexScores(MempoolEntry* entry) {
+        by_ancestor_score.erase(entry);
+        by_descendant_score.erase(entry);
+    }
+
+    void IndexScores(MempoolEntry* entry) {
+        by_ancestor_score.insert(entry);
+        by_descendant_score.insert(entry);
+        // Every change to an entry passes through here
+        MarkSnapshotDirty(entry->tx_hash);
+    }
+
+    void MarkSnapshotDirty(const uint256& tx_hash) {
+        snapshot_dirty.insert(tx_hash);
+        snapshot_changes.fetch_add(1, std::memory_order_release);
+    }
+
+    // Helper: Publish a snapshot covering every change so far. Only the
+    // changed entries are copied with the mempool lock held; merging them
+    // into the ordered copies and building the snapshot happens outside
+    // it, so admission never waits on a rebuild. Caller must not hold mutex.
+    std::shared_ptr<const MempoolSnapshot> PublishSnapshot() const {
+        std::lock_guard<std::mutex> publish_lock(publish_mutex);
+
+        uint64_t changes = 0;
+        std::vector<std::pair<uint256, std::shared_ptr<const MempoolEntry>>> changed;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            changes = snapshot_changes.load(std::memory_order_relaxed);
+            if (changes == snapshot_published.load(std::memory_order_relaxed)) {
+                return snapshot.load(std::memory_order_acquire);  // published meanwhile
+            }
+            changed.reserve(snapshot_dirty.size());
+            for (const uint256& tx_hash : snapshot_dirty) {
+                auto it = entries.find(tx_hash);
+                changed.emplace_back(tx_hash, it == entries.end()
+                    ? nullptr : std::make_shared<const MempoolEntry>(it->second));
+            }
+            snapshot_dirty.clear();
+        }
+
+        // Unchanged entries keep sharing the copies older snapshots hold
+        for (auto& [tx_hash, copy] : changed) {
+            auto it = snapshot_entries.find(tx_hash);
+            if (it != snapshot_entries.end()) {
+                snapshot_order.erase(it->second);
+                snapshot_entries.erase(it);
+            }
+            if (copy) {
+                snapshot_order.insert(copy);
+                snapshot_entries.emplace(tx_hash, std::move(copy));
+            }
+        }
+
+        auto next = std::make_shared<MempoolSnapshot>();
+        next->entries.assign(snapshot_order.begin(), snapshot_order.end());
+        next->sequence = ++snapshot_sequence;
+
+        std::shared_ptr<const MempoolSnapshot> result = std::move(next);
+        snapshot.store(result, std::memory_order_release);
+        snapshot_published.store(changes, std::memory_order_release);
+        return result;
+    }
+
+    // Helper: Does tx spend an output another mempool entry already spends?
+    // Spends by the entries a replacement would remove don't count.
+    bool SpendsMempoolOutpoint(const Transaction& tx,
+                               const std::vector<MempoolEntry*>& replaced = {}) const {
+        for (const auto& input : tx.inputs) {
+            auto it = spent_outpoints.find(OutPoint(input.prev_tx_hash, input.prev_tx_index));
+            if (it != spent_outpoints.end() && !Contains(replaced, it->second)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool Contains(const std::vector<MempoolEntry*>& package, const uint256& tx_hash) {
+        return std::any_of(package.begin(), package.end(), [&](const MempoolEntry* entry) {
+            return entry->tx_hash == tx_hash;
+        });
+    }
+
+    // Helper: The queued entry a contract transaction would replace (same
+    // sender and nonce) followed by everything spending it; empty if the
+    // nonce is free
+    std::vector<MempoolEntry*> CollectReplaced(const std::string& sender, uint64_t nonce) {
+        auto sender_it = senders.find(sender);
+        if (sender_it == senders.end()) return {};
+        auto nonce_it = sender_it->second.by_nonce.find(nonce);
+        if (nonce_it == sender_it->second.by_nonce.end()) return {};
+        return CollectDescendants({nonce_it->second->tx_hash});
+    }
+
+    // Helper: Total value of tx's inputs, from mempool parents or the coins
+    // looked up before the lock was taken
+    Result<uint64_t> GetInputValue(const Transaction& tx,
+                                   const std::vector<std::optional<TxOut>>& coins) const {
+        uint64_t value_in = 0;
+        for (size_t i = 0; i < tx.inputs.size(); ++i) {
+            const TxIn& input = tx.inputs[i];
+            uint64_t value = 0;
+
+            auto parent_it = entries.find(input.prev_tx_hash);
+            if (parent_it != entries.end()) {
+                const auto& parent_outputs = parent_it->second.tx.outputs;
+                if (input.prev_tx_index >= parent_outputs.size()) {
+                    return Result<uint64_t>::Error("Input spends a nonexistent mempool output");
+                }
+                value = parent_outputs[input.prev_tx_index].value;
+            } else if (coins[i]) {
+                value = coins[i]->value;
+            } else {
+                return Result<uint64_t>::Error("Missing inputs");
+            }
+
+            if (value_in + value < value_in) {
+                return Result<uint64_t>::Error("Input value overflow");
+            }
+            value_in += value;
+        }
+        return Result<uint64_t>::Ok(value_in);
+    }
+
+    // Helper: Does tx spend an output that is neither in the mempool nor
+    // among the coins looked up before the lock was taken?
+    bool HasMissingInputs(const Transaction& tx,
+                          const std::vector<std::optional<TxOut>>& coins) const {
+        for (size_t i = 0; i < tx.inputs.size(); ++i) {
+            if (!coins[i] && entries.count(tx.inputs[i].prev_tx_hash) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Helper: Hold a prepared transaction until its parents arrive.
+    // Returns false if it was not kept (too large, or the peer is at its cap).
+    bool AddOrphan(const PreparedTx& prepared, TxPriority priority, uint64_t peer_id) {
+        const uint256& tx_hash = prepared.tx_hash;
+        if (orphan_txs.count(tx_hash) > 0) {
+            return true;
+        }
+        // Large orphans are cheap to send and expensive to hold
+        if (prepared.size_bytes > MAX_ORPHAN_TX_SIZE) {
+            return false;
+        }
+        auto peer_it = orphans_per_peer.find(peer_id);
+        if (peer_it != orphans_per_peer.end() && peer_it->second >= config.max_orphans_per_peer) {
+            return false;
+        }
+
+        auto [it, inserted] = orphan_txs.emplace(tx_hash, OrphanEntry{
+            *prepared.tx, prepared, priority, peer_id,
+            std::time(nullptr) + static_cast<std::time_t>(config.orphan_expiry_minutes) * 60,
+            orphan_list.size()});
+        (void)inserted;
+        OrphanEntry& orphan = it->second;
+        orphan.prepared.tx = &orphan.tx;
+
+        for (const auto& input : orphan.tx.inputs) {
+            orphans_by_outpoint[OutPoint(input.prev_tx_hash, input.prev_tx_index)].insert(tx_hash);
+        }
+        orphan_list.push_back(tx_hash);
+        orphans_per_peer[peer_id]++;
+        orphan_bytes += prepared.size_bytes;
+
+        LimitOrphans(tx_hash);
+        return orphan_txs.count(tx_hash) > 0;
+    }
+
+    // Helper: Unlink an orphan from every index; the entry itself is left
+    // in orphan_txs for the caller to erase or extract
+    void UnlinkOrphan(const OrphanEntry& orphan) {
+        const uint256& tx_hash = orphan.prepared.tx_hash;
+        for (const auto& input : orphan.tx.inputs) {
+            auto it = orphans_by_outpoint.find(OutPoint(input.prev_tx_hash, input.prev_tx_index));
+            if (it == orphans_by_outpoint.end()) continue;
+            it->second.erase(tx_hash);
+            if (it->second.empty()) {
+                orphans_by_outpoint.erase(it);
+            }
+        }
+
+        // Swap-remove from the eviction list
+        size_t pos = orphan.list_pos;
+        if (pos + 1 != orphan_list.size()) {
+            orphan_list[pos] = orphan_list.back();
+            orphan_txs.at(orphan_list[pos]).list_pos = pos;
+        }
+        orphan_list.pop_back();
+
+        if (--orphans_per_peer[orphan.peer_id] == 0) {
+            orphans_per_peer.erase(orphan.peer_id);
+        }
+        orphan_bytes -= orphan.prepared.size_bytes;
+    }
+
+    void EraseOrphan(const uint256& tx_hash) {
+        auto it = orphan_txs.find(tx_hash);
+        if (it == orphan_txs.end()) return;
+        UnlinkOrphan(it->second);
+        orphan_txs.erase(it);
+    }
+
+    // Helper: Drop expired orphans (at most once a minute), then evict at
+    // random until the pool is back under its count and size caps. Random
+    // eviction keeps a peer from choosing which orphans survive.
+    uint32_t LimitOrphans(const uint256& keep = uint256{}) {
+        uint32_t removed = 0;
+        std::time_t now = std::time(nullptr);
+        if (now >= next_orphan_sweep) {
+            std::vector<uint256> expired;
+            for (const auto& [tx_hash, orphan] : orphan_txs) {
+                if (orphan.expiry <= now) {
+                    expired.push_back(tx_hash);
+                }
+            }
+            for (const auto& tx_hash : expired) {
+                EraseOrphan(tx_hash);
+            }
+            removed += expired.size();
+            next_orphan_sweep = now + ORPHAN_SWEEP_INTERVAL;
+        }
+
+        while (!orphan_list.empty() &&
+               (orphan_list.size() > config.max_orphan_tx || orphan_bytes > config.max_orphan_bytes)) {
+            std::uniform_int_distribution<size_t> pick(0, orphan_list.size() - 1);
+            uint256 victim = orphan_list[pick(orphan_rng)];
+            // The orphan just added survives unless it alone breaks a cap
+            if (victim == keep && orphan_list.size() > 1) continue;
+            EraseOrphan(victim);
+            removed++;
+        }
+        return removed;
+    }
+
+    uint32_t EraseOrphansForPeer(uint64_t peer_id) {
+        std::vector<uint256> to_remove;
+        for (const auto& [tx_hash, orphan] : orphan_txs) {
+            if (orphan.peer_id == peer_id) {
+                to_remove.push_back(tx_hash);
+            }
+        }
+        for (const auto& tx_hash : to_remove) {
+            EraseOrphan(tx_hash);
+        }
+        return to_remove.size();
+    }
+
+    // Helper: In-mempool parents of tx (inputs spending mempool outputs)
+    std::set<uint256> FindParents(const Transaction& tx) const {
+        std::set<uint256> parents;
+        for (const auto& input : tx.inputs) {
+            if (entries.count(input.prev_tx_hash) > 0) {
+                parents.insert(input.prev_tx_hash);
+            }
+        }
+        return parents;
+    }
+
+    // Helper: Walk a dependency direction transitively from a starting set.
+    // Each reachable entry is returned once; the start set itself is
+    // included.
+    template <typename Links>
+    std::vector<MempoolEntry*> Collect(const std::set<uint256>& start, Links links) {
+        std::vector<MempoolEntry*> result;
+        std::unordered_set<uint256, uint256_hash> visited;
+        std::vector<const uint256*> stack;
+        for (const auto& hash : start) stack.push_back(&hash);
+
+        while (!stack.empty()) {
+            const uint256& hash = *stack.back();
+            stack.pop_back();
+            if (!visited.insert(hash).second) continue;
+
+            MempoolEntry* entry = Find(hash);
+            if (entry == nullptr) continue;
+            result.push_back(entry);
+            for (const auto& next : links(*entry)) stack.push_back(&next);
+        }
+        return result;
+    }
+
+    std::vector<MempoolEntry*> CollectAncestors(const std::set<uint256>& parents) {
+        return Collect(parents, [](const MempoolEntry& e) -> const std::set<uint256>& {
+            return e.depends_on;
+        });
+    }
+
+    std::vector<MempoolEntry*> CollectDescendants(const std::set<uint256>& children) {
+        return Collect(children, [](const MempoolEntry& e) -> const std::set<uint256>& {
+            return e.depended_by;
+        });
+    }
+
+    // Helper: Enforce the ancestor / descendant chain limits for a new entry
+    Result<void> CheckPackageLimits(const std::vector<MempoolEntry*>& ancestors) const {
+        if (ancestors.size() + 1 > config.max_ancestor_count) {
+            return Result<void>::Error("Too many unconfirmed ancestors");
+        }
+        for (const MempoolEntry* ancestor : ancestors) {
+            if (ancestor->descendant_count + 1 > config.max_descendant_count) {
+                return Result<void>::Error("Too many unconfirmed descendants for an ancestor");
+            }
+        }
+        return Result<void>::Ok();
+    }
+
+    // Helper: Insert an entry whose depends_on and ancestors were computed
+    // against the current pool. Updates every ancestor's descendant totals.
+    MempoolEntry& Insert(MempoolEntry&& new_entry, const std::vector<MempoolEntry*>& ancestors) {
+        new_entry.ancestor_count = 1;
+        new_entry.ancestor_size = new_entry.size_bytes;
+        new_entry.ancestor_fees = ModifiedFee(new_entry);
+        for (const MempoolEntry* ancestor : ancestors) {
+            new_entry.ancestor_count++;
+            new_entry.ancestor_size += ancestor->size_bytes;
+            new_entry.ancestor_fees += ModifiedFee(*ancestor);
+        }
+        new_entry.descendant_count = 1;
+        new_entry.descendant_size = new_entry.size_bytes;
+        new_entry.descendant_fees = ModifiedFee(new_entry);
+        new_entry.depended_by.clear();
+
+        uint256 tx_hash = new_entry.tx_hash;
+        MempoolEntry& entry = entries.emplace(tx_hash, std::move(new_entry)).first->second;
+
+        for (const auto& parent_hash : entry.depends_on) {
+            entries.at(parent_hash).depended_by.insert(tx_hash);
+        }
+        for (MempoolEntry* ancestor : ancestors) {
+            UnindexScores(ancestor);
+            ancestor->descendant_count++;
+            ancestor->descendant_size += entry.size_bytes;
+            ancestor->descendant_fees += ModifiedFee(entry);
+            IndexScores(ancestor);
+        }
+
+        IndexScores(&entry);
+        by_entry_time.insert(&entry);
+        priority_queues[entry.priority].emplace(entry.fee_per_byte, tx_hash);
+        for (const auto& input : entry.tx.inputs) {
+            spent_outpoints.emplace(OutPoint(input.prev_tx_hash, input.prev_tx_index), tx_hash);
+        }
+        if (entry.tx.IsContractTransaction()) {
+            SenderQueue& queue = senders[entry.contract_sender];
+            queue.by_nonce[entry.contract_nonce] = &entry;
+            RefreshSenderHead(queue);
+            total_gas_in_mempool += entry.gas_limit;
+        }
+
+        total_size_bytes += entry.size_bytes;
+        total_fees += entry.fee;
+        total_fee_per_byte += entry.fee_per_byte;
+        total_memory_bytes += EntryMemoryUsage(entry);
+        size_by_priority[entry.priority] += entry.size_bytes;
+        fees.insert(entry.fee);
+        fee_histogram.Add(entry.fee, entry.size_bytes);
+        fee_histogram_by_priority[entry.priority].Add(entry.fee, entry.size_bytes);
+        return entry;
+    }
+
+    // Helper: Recount an entry's totals from its current links
+    void RecalculateAncestorTotals(MempoolEntry* entry) {
+        UnindexScores(entry);
+        entry->ancestor_count = 1;
+        entry->ancestor_size = entry->size_bytes;
+        entry->ancestor_fees = ModifiedFee(*entry);
+        for (const MempoolEntry* ancestor : CollectAncestors(entry->depends_on)) {
+            entry->ancestor_count++;
+            entry->ancestor_size += ancestor->size_bytes;
+            entry->ancestor_fees += ModifiedFee(*ancestor);
+        }
+        IndexScores(entry);
+    }
+
+    void RecalculateDescendantTotals(MempoolEntry* entry) {
+        UnindexScores(entry);
+        entry->descendant_count = 1;
+        entry->descendant_size = entry->size_bytes;
+        entry->descendant_fees = ModifiedFee(*entry);
+        for (const MempoolEntry* descendant : CollectDescendants(entry->depended_by)) {
+            entry->descendant_count++;
+            entry->descendant_size += descendant->size_bytes;
+            entry->descendant_fees += ModifiedFee(*descendant);
+        }
+        IndexScores(entry);
+    }
+
+    // Helper: Remove a single entry. In-mempool descendants stay (e.g. when
+    // the entry was confirmed) and have their ancestor totals reduced.
+    void Remove(MempoolEntry* entry) {
+        std::vector<MempoolEntry*> ancestors = CollectAncestors(entry->depends_on);
+        std::vector<MempoolEntry*> descendants = CollectDescendants(entry->depended_by);
+
+        for (const auto& parent_hash : entry->depends_on) {
+            if (MempoolEntry* parent = Find(parent_hash)) parent->depended_by.erase(entry->tx_hash);
+        }
+        for (const auto& child_hash : entry->depended_by) {
+            if (MempoolEntry* child = Find(child_hash)) child->depends_on.erase(entry->tx_hash);
+        }
+
+        if (ancestors.empty() || descendants.empty()) {
+            // Confirmed roots and evicted leaves: only the entry itself
+            // drops out of the other side's totals
+            for (MempoolEntry* ancestor : ancestors) {
+                UnindexScores(ancestor);
+                ancestor->descendant_count--;
+                ancestor->descendant_size -= entry->size_bytes;
+                ancestor->descendant_fees -= ModifiedFee(*entry);
+                IndexScores(ancestor);
+            }
+            for (MempoolEntry* descendant : descendants) {
+                UnindexScores(descendant);
+                descendant->ancestor_count--;
+                descendant->ancestor_size -= entry->size_bytes;
+                descendant->ancestor_fees -= ModifiedFee(*entry);
+                IndexScores(descendant);
+            }
+        } else {
+            // Cutting a chain in the middle can also separate descendants
+            // from ancestors, so recount both sides (bounded by the chain
+            // limits)
+            for (MempoolEntry* ancestor : ancestors) RecalculateDescendantTotals(ancestor);
+            for (MempoolEntry* descendant : descendants) RecalculateAncestorTotals(descendant);
+        }
+
+        if (entry->tx.IsContractTransaction()) {
+            auto sender_it = senders.find(entry->contract_sender);
+            if (sender_it != senders.end()) {
+                SenderQueue& queue = sender_it->second;
+                auto nonce_it = queue.by_nonce.find(entry->contract_nonce);
+                if (nonce_it != queue.by_nonce.end() && nonce_it->second == entry) {
+                    queue.by_nonce.erase(nonce_it);
+                }
+                RefreshSenderHead(queue);
+                if (queue.by_nonce.empty()) {
+                    senders.erase(sender_it);
+                }
+            }
+            total_gas_in_mempool -= std::min(total_gas_in_mempool, entry->gas_limit);
+        }
+
+        total_size_bytes -= entry->size_bytes;
+        total_fees -= entry->fee;
+        total_fee_per_byte -= entry->fee_per_byte;
+        total_memory_bytes -= EntryMemoryUsage(*entry);
+        size_by_priority[entry->priority] -= entry->size_bytes;
+        fees.erase(fees.find(entry->fee));
+        fee_histogram.Remove(entry->fee, entry->size_bytes);
+        fee_histogram_by_priority[entry->priority].Remove(entry->fee, entry->size_bytes);
+
+        uint256 tx_hash = entry->tx_hash;
+        for (const auto& input : entry->tx.inputs) {
+            auto spent_it = spent_outpoints.find(OutPoint(input.prev_tx_hash, input.prev_tx_index));
+            if (spent_it != spent_outpoints.end() && spent_it->second == tx_hash) {
+                spent_outpoints.erase(spent_it);
+            }
+        }
+        UnindexScores(entry);
+        by_entry_time.erase(entry);
+        priority_queues[entry->priority].erase({entry->fee_per_byte, tx_hash});
+        MarkSnapshotDirty(tx_hash);
+        entries.erase(tx_hash);
+    }
+
+    // Helper: Remove an entry together with everything that spends it.
+    // Children are removed before parents (a child always has more
+    // ancestors than any of its parents), so each removal only adjusts
+    // totals of entries that stay. Returns the number removed.
+    size_t RemoveWithDescendants(MempoolEntry* entry) {
+        std::vector<MempoolEntry*> package = CollectDescendants(entry->depended_by);
+        package.push_back(entry);
+        std::sort(package.begin(), package.end(), [](const MempoolEntry* a, const MempoolEntry* b) {
+            return a->ancestor_count > b->ancestor_count;
+        });
+        for (MempoolEntry* member : package) {
+            Remove(member);
+        }
+        return package.size();
+    }
+
+    // Helper: Evict packages, lowest descendant score first, until the
+    // pool fits in max_bytes; returns the number of entries removed
+    size_t TrimToSize(uint64_t max_bytes) {
+        size_t removed = 0;
+        Feerate max_evicted{0, 1};
+
+        while (total_size_bytes > max_bytes && !by_descendant_score.empty()) {
+            MempoolEntry* worst = *by_descendant_score.begin();
+            Feerate package{worst->descendant_fees, worst->descendant_size};
+            if (FeerateLess(max_evicted, package)) max_evicted = package;
+            removed += RemoveWithDescendants(worst);
+        }
+
+        if (removed > 0) {
+            // Anything paying less than what was just evicted (plus the
+            // incremental relay fee) would only be evicted again
+            double evicted_per_kb = static_cast<double>(max_evicted.fee) * 1000 /
+                                    static_cast<double>(std::max<uint64_t>(max_evicted.size, 1));
+            double new_rolling = evicted_per_kb + static_cast<double>(config.incremental_relay_fee_per_kb);
+            if (new_rolling > rolling_min_fee_per_kb) {
+                rolling_min_fee_per_kb = new_rolling;
+                block_since_rolling_fee_bump = false;
+                last_rolling_fee_update = std::time(nullptr);
+            }
+        }
+        return removed;
+    }
+
+    // Helper: Change an entry's fee delta and every package total it is in
+    void ApplyFeeDelta(MempoolEntry* entry, int64_t fee_delta) {
+        UnindexScores(entry);
+        uint64_t old_fee = ModifiedFee(*entry);
+        entry->fee_delta += fee_delta;
+        uint64_t new_fee = ModifiedFee(*entry);
+        entry->ancestor_fees = entry->ancestor_fees - old_fee + new_fee;
+        entry->descendant_fees = entry->descendant_fees - old_fee + new_fee;
+        IndexScores(entry);
+
+        for (MempoolEntry* ancestor : CollectAncestors(entry->depends_on)) {
+            UnindexScores(ancestor);
+            ancestor->descendant_fees = ancestor->descendant_fees - old_fee + new_fee;
+            IndexScores(ancestor);
+        }
+        for (MempoolEntry* descendant : CollectDescendants(entry->depended_by)) {
+            UnindexScores(descendant);
+            descendant->ancestor_fees = descendant->ancestor_fees - old_fee + new_fee;
+            IndexScores(descendant);
+        }
+    }
+
+    // Helper: Backdate an entry (restored entries keep their original time)
+    void SetEntryTime(MempoolEntry* entry, std::time_t added_time) {
+        UnindexScores(entry);
+        by_entry_time.erase(entry);
+        entry->added_time = added_time;
+        by_entry_time.insert(entry);
+        IndexScores(entry);
+    }
+
+    void ClearAll() {
+        for (const auto& [tx_hash, entry] : entries) {
+            MarkSnapshotDirty(tx_hash);
+        }
+        by_ancestor_score.clear();
+        by_descendant_score.clear();
+        by_entry_time.clear();
+        entries.clear();
+        priority_queues.clear();
+        orphan_txs.clear();
+        orphans_by_outpoint.clear();
+        orphan_list.clear();
+        orphans_per_peer.clear();
+        orphan_bytes = 0;
+        orphan_work.clear();
+        senders.clear();
+        contract_heads.clear();
+        spent_outpoints.clear();
+        total_gas_in_mempool = 0;
+        total_size_bytes = 0;
+        total_fees = 0;
+        total_fee_per_byte = 0;
+        total_memory_bytes = 0;
+        size_by_priority.clear();
+        fees.clear();
+        fee_histogram.Clear();
+        fee_histogram_by_priority.clear();
+    }
 };
 
 INTcoinMempool::INTcoinMempool()
@@ -101,88 +1085,236 @@ INTcoinMempool::~INTcoinMempool() {
 }
 
 Result<void> INTcoinMempool::Initialize(const MempoolConfig& config) {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+
+        if (impl_->is_initialized) {
+            return Result<void>::Error("Mempool already initialized");
+        }
+
+        impl_->config = config;
+        impl_->is_initialized = true;
+
+        // Initialize priority queues
+        for (int i = 0; i <= static_cast<int>(TxPriority::CRITICAL); ++i) {
+            impl_->priority_queues[static_cast<TxPriority>(i)] = {};
+        }
+    }
+
+    // Try to restore from disk if configured (Restore locks for itself)
+    if (config.persist_on_shutdown) {
+        auto restore_result = Restore();
+        if (restore_result.IsOk()) {
+            LogF(LogLevel::INFO, "Mempool: Restored from %s", config.persist_file.c_str());
+        }
+    }
+
+    LogF(LogLevel::INFO, "Mempool: Initialized (max size: %lu MB)", config.max_size_mb);
+    return Result<void>::Ok();
+}
+
+Result<void> INTcoinMempool::Shutdown() {
     std::lock_guard<std::mutex> lock(impl_->mutex);
 
-    if (impl_->is_initialized) {
-        return Result<void>::Error("Mempool already initialized");
+    if (!impl_->is_initialized) {
+        return Result<void>::Error("Mempool not initialized");
     }
 
-    impl_->config = config;
-    impl_->is_initialized = true;
+    // Persist if configured
+    if (impl_->config.persist_on_shutdown) {
+        auto persist_result = PersistInternal();
+        if (!persist_result.IsOk()) {
+            LogF(LogLevel::WARNING, "Mempool: Failed to persist on shutdown");
+        }
+    }
 
-    // Initialize priority queues
-    for (int i = 0; i <= static_cast<int>(TxPriority::CRITICAL); ++i) {
-        impl_->priority_queues[static_cast<TxPriority>(i)] = {};
+    impl_->ClearAll();
+    impl_->is_initialized = false;
+
+    LogF(LogLevel::INFO, "Mempool: Shutdown complete");
+    return Result<void>::Ok();
+}
+
+void INTcoinMempool::PrepareTransaction(const Transaction& tx, PreparedTx& prepared) const {
+    // Note: Runs without the mutex; reads only tx and the configured hooks
+    prepared.tx = &tx;
+    prepared.tx_hash = tx.GetHash();
+
+    // Validate transaction
+    if (!ValidateTransaction(tx)) {
+        prepared.error = "Transaction validation failed";
+        return;
+    }
+
+    if (tx.IsContractTransaction()) {
+        if (!ParseContractMeta(tx, prepared.contract)) {
+            prepared.error = tx.IsContractDeployment()
+                ? "Failed to deserialize contract deployment"
+                : "Failed to deserialize contract call";
+            return;
+        }
+    }
+    prepared.size_bytes = CalculateTxSize(tx);
+
+    if (impl_->tx_check) {
+        auto check_result = impl_->tx_check(tx);
+        if (check_result.IsError()) {
+            prepared.error = check_result.error;
+            return;
+        }
     }
 
-    // Try to restore from disk if configured
-    if (config.persist_on_shutdown) {
-        auto restore_result = Restore();
-        if (restore_result.IsOk()) {
-            LogF(LogLevel::INFO, "Mempool: Restored from %s", config.persist_file.c_str());
+    // Look coins up now so the critical section never waits on the UTXO
+    // set. Inputs spending mempool outputs come back empty and are
+    // resolved against the parents at commit time.
+    if (impl_->coin_lookup && !tx.IsContractTransaction()) {
+        prepared.coins.reserve(tx.inputs.size());
+        for (const auto& input : tx.inputs) {
+            prepared.coins.push_back(impl_->coin_lookup(OutPoint(input.prev_tx_hash, input.prev_tx_index)));
+        }
+    }
+
+    // Same for the sender's nonce on chain
+    if (impl_->nonce_lookup && tx.IsContractTransaction()) {
+        prepared.chain_nonce = impl_->nonce_lookup(prepared.contract.from_address);
+    }
+}
+
+Result<void> INTcoinMempool::AddTransaction(const Transaction& tx, TxPriority priority) {
+    PreparedTx prepared;
+    PrepareTransaction(tx, prepared);
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto result = CommitTransaction(prepared, priority);
+    ProcessOrphans();
+    return result;
+}
+
+Result<void> INTcoinMempool::AddTransactionFromPeer(const Transaction& tx, uint64_t peer_id,
+                                                    TxPriority priority) {
+    PreparedTx prepared;
+    PrepareTransaction(tx, prepared);
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+
+    // Inputs we can't resolve yet: hold it until the parents arrive
+    if (impl_->is_initialized && prepared.error.empty() &&
+        prepared.coins.size() == tx.inputs.size() && !prepared.coins.empty() &&
+        impl_->entries.count(prepared.tx_hash) == 0 &&
+        impl_->HasMissingInputs(tx, prepared.coins)) {
+        if (!impl_->AddOrphan(prepared, priority, peer_id)) {
+            return Result<void>::Error("Missing inputs; orphan not kept");
         }
+        LogF(LogLevel::DEBUG, "Mempool: Stored orphan tx %s from peer %lu (orphans: %zu)",
+             ShortHash(prepared.tx_hash).data(), peer_id, impl_->orphan_txs.size());
+        return Result<void>::Error("Missing inputs");
     }
 
-    LogF(LogLevel::INFO, "Mempool: Initialized (max size: %lu MB)", config.max_size_mb);
-    return Result<void>::Ok();
+    auto result = CommitTransaction(prepared, priority);
+    ProcessOrphans();
+    return result;
 }
 
-Result<void> INTcoinMempool::Shutdown() {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
+std::vector<Result<void>> INTcoinMempool::AddTransactions(const std::vector<Transaction>& txs,
+                                                          TxPriority priority) {
+    std::vector<PreparedTx> prepared(txs.size());
+    ibd::GetSharedThreadPool().ParallelFor(txs.size(), [&](size_t i) {
+        PrepareTransaction(txs[i], prepared[i]);
+    });
 
-    if (!impl_->is_initialized) {
-        return Result<void>::Error("Mempool not initialized");
+    std::vector<Result<void>> results;
+    results.reserve(txs.size());
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    for (const auto& item : prepared) {
+        results.push_back(CommitTransaction(item, priority));
     }
+    ProcessOrphans();
+    return results;
+}
 
-    // Persist if configured
-    if (impl_->config.persist_on_shutdown) {
-        auto persist_result = Persist();
-        if (!persist_result.IsOk()) {
-            LogF(LogLevel::WARNING, "Mempool: Failed to persist on shutdown");
+void INTcoinMempool::ProcessOrphans() {
+    // Note: Caller must hold mutex lock
+    while (!impl_->orphan_work.empty()) {
+        uint256 parent_hash = impl_->orphan_work.front();
+        impl_->orphan_work.pop_front();
+
+        // Orphans spending any output of the new parent (outpoints sort by
+        // txid first, so they are one range of the index)
+        std::vector<uint256> dependents;
+        for (auto it = impl_->orphans_by_outpoint.lower_bound(OutPoint(parent_hash, 0));
+             it != impl_->orphans_by_outpoint.end() && it->first.tx_hash == parent_hash; ++it) {
+            dependents.insert(dependents.end(), it->second.begin(), it->second.end());
+        }
+        std::sort(dependents.begin(), dependents.end());
+        dependents.erase(std::unique(dependents.begin(), dependents.end()), dependents.end());
+
+        for (const auto& orphan_hash : dependents) {
+            auto it = impl_->orphan_txs.find(orphan_hash);
+            if (it == impl_->orphan_txs.end()) continue;
+
+            // Still waiting for another parent
+            if (impl_->HasMissingInputs(it->second.tx, it->second.prepared.coins)) continue;
+
+            // Accepted children land back on orphan_work, so whole chains
+            // resolve in one pass
+            impl_->UnlinkOrphan(it->second);
+            auto node = impl_->orphan_txs.extract(it);
+            auto result = CommitTransaction(node.mapped().prepared, node.mapped().priority);
+            if (result.IsError()) {
+                LogF(LogLevel::DEBUG, "Mempool: Dropped orphan tx %s: %s",
+                     ShortHash(orphan_hash).data(), result.error.c_str());
+            }
         }
     }
-
-    impl_->entries.clear();
-    impl_->priority_queues.clear();
-    impl_->orphan_txs.clear();
-    impl_->is_initialized = false;
-
-    LogF(LogLevel::INFO, "Mempool: Shutdown complete");
-    return Result<void>::Ok();
 }
 
-Result<void> INTcoinMempool::AddTransaction(const Transaction& tx, TxPriority priority) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-
+Result<void> INTcoinMempool::CommitTransaction(const PreparedTx& prepared, TxPriority priority) {
+    // Note: Caller must hold mutex lock
     if (!impl_->is_initialized) {
         return Result<void>::Error("Mempool not initialized");
     }
 
-    // Calculate transaction hash
-    uint256 tx_hash = tx.GetHash();
-    std::string tx_key = impl_->Uint256ToHex(tx_hash);
+    const Transaction& tx = *prepared.tx;
+    const uint256& tx_hash = prepared.tx_hash;
 
     // Check if already in mempool
-    if (impl_->entries.find(tx_key) != impl_->entries.end()) {
+    if (impl_->entries.count(tx_hash) > 0) {
         return Result<void>::Error("Transaction already in mempool");
     }
 
-    // Validate transaction
-    if (!ValidateTransaction(tx)) {
-        return Result<void>::Error("Transaction validation failed");
+    if (!prepared.error.empty()) {
+        return Result<void>::Error(prepared.error);
     }
 
     // Handle contract transactions differently
     if (tx.IsContractTransaction()) {
-        return AddContractTransaction(tx, priority);
+        return AddContractTransaction(prepared, priority);
     }
 
     // Standard UTXO transaction handling
+    // Check for double spends of outputs already spent in the mempool
+    if (impl_->SpendsMempoolOutpoint(tx)) {
+        return Result<void>::Error("Transaction conflicts with mempool");
+    }
+
     // Calculate tx size and fee
-    uint64_t tx_size = CalculateTxSize(tx);
-    // Placeholder fee calculation: use minimum relay fee * size
-    // In production, would calculate from (sum of inputs - sum of outputs) using UTXO set
-    uint64_t fee = (impl_->config.min_relay_fee_per_kb * tx_size) / 1000;
+    uint64_t tx_size = prepared.size_bytes;
+    uint64_t fee = 0;
+    if (prepared.coins.size() == tx.inputs.size() && impl_->coin_lookup) {
+        auto value_in = impl_->GetInputValue(tx, prepared.coins);
+        if (value_in.IsError()) {
+            return Result<void>::Error(value_in.error);
+        }
+        uint64_t value_out = tx.GetTotalOutputValue();
+        if (value_in.GetValue() < value_out) {
+            return Result<void>::Error("Inputs are worth less than outputs");
+        }
+        fee = value_in.GetValue() - value_out;
+    } else {
+        // Placeholder fee calculation without a coin source: minimum relay fee * size
+        fee = (impl_->config.min_relay_fee_per_kb * tx_size) / 1000;
+    }
     uint64_t fee_per_byte = fee / std::max<uint64_t>(tx_size, 1);
 
     // Determine final priority (may upgrade based on fee)
@@ -202,14 +1334,17 @@ Result<void> INTcoinMempool::AddTransaction(const Transaction& tx, TxPriority pr
         }
     }
 
-    // Check total mempool size
-    uint64_t max_size_bytes = impl_->config.max_size_mb * 1024 * 1024;
-    if (impl_->GetTotalSize() + tx_size > max_size_bytes) {
-        EvictLowPriority();
+    // Check the admission floor (raised while the mempool is full)
+    if (!Impl::MeetsFeeRate(fee, tx_size, impl_->GetMinFeePerKb())) {
+        return Result<void>::Error("Mempool min fee not met");
+    }
 
-        if (impl_->GetTotalSize() + tx_size > max_size_bytes) {
-            return Result<void>::Error("Mempool full");
-        }
+    // Link to in-mempool parents (after eviction, which may have removed some)
+    std::set<uint256> parents = impl_->FindParents(tx);
+    std::vector<MempoolEntry*> ancestors = impl_->CollectAncestors(parents);
+    auto limits_result = impl_->CheckPackageLimits(ancestors);
+    if (limits_result.IsError()) {
+        return limits_result;
     }
 
     // Create mempool entry
@@ -222,137 +1357,70 @@ Result<void> INTcoinMempool::AddTransaction(const Transaction& tx, TxPriority pr
     entry.size_bytes = tx_size;
     entry.added_time = std::time(nullptr);
     entry.height_added = 0;  // Would get from blockchain
+    entry.depends_on = std::move(parents);
     entry.broadcast_count = 0;
     entry.last_broadcast = 0;
 
-    // Add to storage
-    impl_->entries[tx_key] = entry;
+    // Add to storage and indexes, then trim back to the size limit. The new
+    // transaction competes with everything else: if its package scores
+    // lowest, it is the one evicted.
+    impl_->Insert(std::move(entry), ancestors);
+    impl_->TrimToSize(impl_->MaxSizeBytes());
+    if (impl_->entries.count(tx_hash) == 0) {
+        return Result<void>::Error("Mempool full");
+    }
 
-    // Add to priority queue
-    impl_->priority_queues[priority].emplace(fee_per_byte, tx_key);
+    // Orphans waiting on this transaction can now be retried
+    if (!impl_->orphan_txs.empty()) {
+        impl_->EraseOrphan(tx_hash);
+        impl_->orphan_work.push_back(tx_hash);
+    }
 
     LogF(LogLevel::INFO, "Mempool: Added tx %s (priority: %s, fee: %lu ints)",
-         tx_key.substr(0, 16).c_str(), TxPriorityToString(priority).c_str(), fee);
+         ShortHash(tx_hash).data(), TxPriorityToString(priority).c_str(), fee);
 
     return Result<void>::Ok();
 }
 
-Result<void> INTcoinMempool::AddContractTransaction(const Transaction& tx, TxPriority priority) {
+Result<void> INTcoinMempool::AddContractTransaction(const PreparedTx& prepared, TxPriority priority) {
     // Note: Caller must hold mutex lock
 
-    uint256 tx_hash = tx.GetHash();
-    std::string tx_key = impl_->Uint256ToHex(tx_hash);
-
-    // Parse contract transaction
-    std::string from_address;
-    uint64_t nonce = 0;
-    uint64_t gas_limit = 0;
-    uint64_t gas_price = 0;
-
-    if (tx.IsContractDeployment()) {
-        auto deploy_result = contracts::ContractDeploymentTx::Deserialize(tx.contract_data);
-        if (!deploy_result.has_value()) {
-            return Result<void>::Error("Failed to deserialize contract deployment");
-        }
-
-        const auto& deploy_tx = deploy_result.value();
-        from_address = PublicKeyToAddress(deploy_tx.from);
-        nonce = deploy_tx.nonce;
-        gas_limit = deploy_tx.gas_limit;
-        gas_price = deploy_tx.gas_price;
-
-    } else if (tx.IsContractCall()) {
-        auto call_result = contracts::ContractCallTx::Deserialize(tx.contract_data);
-        if (!call_result.has_value()) {
-            return Result<void>::Error("Failed to deserialize contract call");
-        }
-
-        const auto& call_tx = call_result.value();
-        from_address = PublicKeyToAddress(call_tx.from);
-        nonce = call_tx.nonce;
-        gas_limit = call_tx.gas_limit;
-        gas_price = call_tx.gas_price;
-    }
-
-    // Check nonce
-    std::string nonce_key = from_address + ":" + std::to_string(nonce);
-
-    // Check if we already have a transaction with this nonce
-    auto nonce_it = impl_->nonce_to_tx.find(nonce_key);
-    if (nonce_it != impl_->nonce_to_tx.end()) {
-        // Transaction with same nonce exists - check for RBF (Replace-By-Fee)
-        std::string existing_tx_key = nonce_it->second;
-        auto existing_entry_it = impl_->entries.find(existing_tx_key);
-
-        if (existing_entry_it != impl_->entries.end()) {
-            const MempoolEntry& existing_entry = existing_entry_it->second;
-
-            // Parse existing transaction to get its gas price
-            uint64_t existing_gas_price = 0;
-            if (existing_entry.tx.IsContractDeployment()) {
-                auto existing_deploy = contracts::ContractDeploymentTx::Deserialize(existing_entry.tx.contract_data);
-                if (existing_deploy.has_value()) {
-                    existing_gas_price = existing_deploy.value().gas_price;
-                }
-            } else if (existing_entry.tx.IsContractCall()) {
-                auto existing_call = contracts::ContractCallTx::Deserialize(existing_entry.tx.contract_data);
-                if (existing_call.has_value()) {
-                    existing_gas_price = existing_call.value().gas_price;
-                }
-            }
-
-            // RBF: New transaction must have gas price at least 10% higher
-            uint64_t min_replacement_gas_price = existing_gas_price + (existing_gas_price / 10);
-            if (gas_price < min_replacement_gas_price) {
-                return Result<void>::Error("Gas price too low for transaction replacement (need 10% increase)");
-            }
-
-            // Remove the old transaction
-            LogF(LogLevel::INFO, "Mempool: Replacing tx %s with higher gas price (%lu -> %lu)",
-                 existing_tx_key.substr(0, 16).c_str(), existing_gas_price, gas_price);
+    const Transaction& tx = *prepared.tx;
+    const uint256& tx_hash = prepared.tx_hash;
 
-            // Update gas tracking
-            if (existing_entry.tx.IsContractDeployment()) {
-                auto old_deploy = contracts::ContractDeploymentTx::Deserialize(existing_entry.tx.contract_data);
-                if (old_deploy.has_value()) {
-                    impl_->total_gas_in_mempool -= old_deploy.value().gas_limit;
-                }
-            } else if (existing_entry.tx.IsContractCall()) {
-                auto old_call = contracts::ContractCallTx::Deserialize(existing_entry.tx.contract_data);
-                if (old_call.has_value()) {
-                    impl_->total_gas_in_mempool -= old_call.value().gas_limit;
-                }
-            }
+    // Contract header, parsed outside the lock
+    const ContractMeta& meta = prepared.contract;
+    uint64_t nonce = meta.nonce;
+    uint64_t gas_limit = meta.gas_limit;
+    uint64_t gas_price = meta.gas_price;
 
-            // Remove from priority queue
-            auto& pq = impl_->priority_queues[existing_entry.priority];
-            auto range = pq.equal_range(existing_entry.fee_per_byte);
-            for (auto pq_it = range.first; pq_it != range.second; ) {
-                if (pq_it->second == existing_tx_key) {
-                    pq_it = pq.erase(pq_it);
-                    break;
-                } else {
-                    ++pq_it;
-                }
-            }
+    // Nonces the chain has already used can never be mined
+    if (prepared.chain_nonce && nonce < *prepared.chain_nonce) {
+        return Result<void>::Error("Nonce too low (already used)");
+    }
 
-            // Remove from storage
-            impl_->entries.erase(existing_entry_it);
+    // Look the nonce up in the sender's queue. Future nonces are allowed;
+    // they wait in the queue until the gap before them is filled. A taken
+    // nonce means replace-by-fee: every check below runs against the pool
+    // as it will be once the old entry is gone, and the old entry is only
+    // removed after all of them pass.
+    std::vector<MempoolEntry*> replaced = impl_->CollectReplaced(meta.from_address, nonce);
+    if (!replaced.empty()) {
+        // RBF: New transaction must have gas price at least 10% higher
+        uint64_t existing_gas_price = replaced.front()->gas_price;
+        uint64_t min_replacement_gas_price = existing_gas_price + (existing_gas_price / 10);
+        if (gas_price < min_replacement_gas_price) {
+            return Result<void>::Error("Gas price too low for transaction replacement (need 10% increase)");
         }
     }
 
-    // Check if nonce is valid (should be next expected nonce for this address)
-    auto address_nonce_it = impl_->address_nonces.find(from_address);
-    if (address_nonce_it != impl_->address_nonces.end()) {
-        uint64_t expected_nonce = address_nonce_it->second;
-        if (nonce < expected_nonce) {
-            return Result<void>::Error("Nonce too low (already used)");
-        }
-        // Allow future nonces (they'll be held until prerequisites are met)
+    // Any UTXO inputs must not be spent by another mempool entry
+    if (impl_->SpendsMempoolOutpoint(tx, replaced)) {
+        return Result<void>::Error("Transaction conflicts with mempool");
     }
 
     // Calculate tx size and fee (gas-based for contracts)
-    uint64_t tx_size = tx.GetSerializedSize();
+    uint64_t tx_size = prepared.size_bytes;
     uint64_t fee = gas_limit * gas_price;  // Total fee = gas_limit * gas_price
     uint64_t fee_per_byte = fee / std::max<uint64_t>(tx_size, 1);
 
@@ -361,21 +1429,66 @@ Result<void> INTcoinMempool::AddContractTransaction(const Transaction& tx, TxPri
     else if (gas_price >= 10) priority = TxPriority::NORMAL;
 
     // Check block gas limit (30M gas target per block)
-    constexpr uint64_t BLOCK_GAS_LIMIT = 30'000'000;
-    if (impl_->total_gas_in_mempool + gas_limit > BLOCK_GAS_LIMIT * 2) {
+    uint64_t replaced_gas = 0;
+    for (const MempoolEntry* old_entry : replaced) replaced_gas += old_entry->gas_limit;
+    if (impl_->total_gas_in_mempool - replaced_gas + gas_limit > BLOCK_GAS_LIMIT * 2) {
         // Mempool can hold 2 blocks worth of gas
         return Result<void>::Error("Mempool gas limit exceeded");
     }
 
-    // Check priority limit
-    if (impl_->GetCountForPriority(priority) >= impl_->config.priority_limits[priority]) {
+    // Check the admission floor (raised while the mempool is full)
+    if (!Impl::MeetsFeeRate(fee, tx_size, impl_->GetMinFeePerKb())) {
+        return Result<void>::Error("Mempool min fee not met");
+    }
+
+    // Check priority limit, counting the slots the replacement frees
+    auto priority_count = [&]() {
+        uint32_t count = impl_->GetCountForPriority(priority);
+        for (const MempoolEntry* old_entry : replaced) {
+            if (old_entry->priority == priority) count--;
+        }
+        return count;
+    };
+    if (priority_count() >= impl_->config.priority_limits[priority]) {
         EvictLowPriority();
+        // Eviction may have taken (part of) the old package with it
+        replaced = impl_->CollectReplaced(meta.from_address, nonce);
 
-        if (impl_->GetCountForPriority(priority) >= impl_->config.priority_limits[priority]) {
+        if (priority_count() >= impl_->config.priority_limits[priority]) {
             return Result<void>::Error("Mempool full for this priority level");
         }
     }
 
+    // Link to in-mempool parents, none of which may be replaced
+    std::set<uint256> parents = impl_->FindParents(tx);
+    for (const auto& parent_hash : parents) {
+        if (Impl::Contains(replaced, parent_hash)) {
+            return Result<void>::Error("Replacement spends a transaction it replaces");
+        }
+    }
+    std::vector<MempoolEntry*> ancestors = impl_->CollectAncestors(parents);
+    auto limits_result = impl_->CheckPackageLimits(ancestors);
+    if (limits_result.IsError()) {
+        return limits_result;
+    }
+
+    // A replacement may not push the pool over its size limit: trimming
+    // could then evict the new transaction after the old one is gone
+    uint64_t replaced_size = 0;
+    for (const MempoolEntry* old_entry : replaced) replaced_size += old_entry->size_bytes;
+    if (!replaced.empty() &&
+        impl_->total_size_bytes - replaced_size + tx_size > impl_->MaxSizeBytes()) {
+        return Result<void>::Error("Mempool full");
+    }
+
+    if (!replaced.empty()) {
+        // Remove the old transaction (and anything spending it)
+        LogF(LogLevel::INFO, "Mempool: Replacing tx %s with higher gas price (%lu -> %lu)",
+             ShortHash(replaced.front()->tx_hash).data(), replaced.front()->gas_price, gas_price);
+
+        impl_->RemoveWithDescendants(replaced.front());
+    }
+
     // Create mempool entry
     MempoolEntry entry;
     entry.tx = tx;
@@ -386,22 +1499,29 @@ Result<void> INTcoinMempool::AddContractTransaction(const Transaction& tx, TxPri
     entry.size_bytes = tx_size;
     entry.added_time = std::time(nullptr);
     entry.height_added = 0;
+    entry.depends_on = std::move(parents);
+    entry.contract_sender = meta.from_address;
+    entry.contract_nonce = nonce;
+    entry.gas_limit = gas_limit;
+    entry.gas_price = gas_price;
     entry.broadcast_count = 0;
     entry.last_broadcast = 0;
 
-    // Add to storage
-    impl_->entries[tx_key] = entry;
-
-    // Add to priority queue (sorted by gas price for contracts)
-    impl_->priority_queues[priority].emplace(gas_price, tx_key);
+    // Add to storage, indexes and the sender's nonce queue. The lookup is
+    // the current chain view, so it also replaces what a block reported
+    // before a reorg.
+    impl_->Insert(std::move(entry), ancestors);
+    if (prepared.chain_nonce) {
+        impl_->SetChainNonce(meta.from_address, *prepared.chain_nonce);
+    }
 
-    // Update contract tracking
-    impl_->nonce_to_tx[nonce_key] = tx_key;
-    impl_->address_nonces[from_address] = nonce + 1;  // Update expected nonce
-    impl_->total_gas_in_mempool += gas_limit;
+    impl_->TrimToSize(impl_->MaxSizeBytes());
+    if (impl_->entries.count(tx_hash) == 0) {
+        return Result<void>::Error("Mempool full");
+    }
 
     LogF(LogLevel::INFO, "Mempool: Added contract tx %s (nonce: %lu, gas: %lu, gas_price: %lu)",
-         tx_key.substr(0, 16).c_str(), nonce, gas_limit, gas_price);
+         ShortHash(tx_hash).data(), nonce, gas_limit, gas_price);
 
     return Result<void>::Ok();
 }
@@ -412,60 +1532,14 @@ Result<void> INTcoinMempool::RemoveTransactionInternal(const uint256& tx_hash) {
         return Result<void>::Error("Mempool not initialized");
     }
 
-    std::string tx_key = impl_->Uint256ToHex(tx_hash);
-
-    auto it = impl_->entries.find(tx_key);
-    if (it == impl_->entries.end()) {
+    MempoolEntry* entry = impl_->Find(tx_hash);
+    if (entry == nullptr) {
         return Result<void>::Error("Transaction not found");
     }
 
-    const MempoolEntry& entry = it->second;
-
-    // If contract transaction, clean up tracking data
-    if (entry.tx.IsContractTransaction()) {
-        std::string from_address;
-        uint64_t nonce = 0;
-        uint64_t gas_limit = 0;
-
-        if (entry.tx.IsContractDeployment()) {
-            auto deploy_result = contracts::ContractDeploymentTx::Deserialize(entry.tx.contract_data);
-            if (deploy_result.has_value()) {
-                from_address = PublicKeyToAddress(deploy_result.value().from);
-                nonce = deploy_result.value().nonce;
-                gas_limit = deploy_result.value().gas_limit;
-            }
-        } else if (entry.tx.IsContractCall()) {
-            auto call_result = contracts::ContractCallTx::Deserialize(entry.tx.contract_data);
-            if (call_result.has_value()) {
-                from_address = PublicKeyToAddress(call_result.value().from);
-                nonce = call_result.value().nonce;
-                gas_limit = call_result.value().gas_limit;
-            }
-        }
-
-        if (!from_address.empty()) {
-            std::string nonce_key = from_address + ":" + std::to_string(nonce);
-            impl_->nonce_to_tx.erase(nonce_key);
-            impl_->total_gas_in_mempool -= gas_limit;
-        }
-    }
-
-    // Remove from priority queue
-    auto& pq = impl_->priority_queues[entry.priority];
-    auto range = pq.equal_range(entry.fee_per_byte);
-    for (auto pq_it = range.first; pq_it != range.second; ) {
-        if (pq_it->second == tx_key) {
-            pq_it = pq.erase(pq_it);
-            break;
-        } else {
-            ++pq_it;
-        }
-    }
-
-    // Remove from storage
-    impl_->entries.erase(it);
+    impl_->Remove(entry);
 
-    LogF(LogLevel::INFO, "Mempool: Removed tx %s", tx_key.substr(0, 16).c_str());
+    LogF(LogLevel::INFO, "Mempool: Removed tx %s", ShortHash(tx_hash).data());
     return Result<void>::Ok();
 }
 
@@ -479,8 +1553,7 @@ bool INTcoinMempool::HasTransaction(const uint256& tx_hash) const {
 
     if (!impl_->is_initialized) return false;
 
-    std::string tx_key = impl_->Uint256ToHex(tx_hash);
-    return impl_->entries.find(tx_key) != impl_->entries.end();
+    return impl_->entries.count(tx_hash) > 0;
 }
 
 Result<Transaction> INTcoinMempool::GetTransaction(const uint256& tx_hash) const {
@@ -490,8 +1563,7 @@ Result<Transaction> INTcoinMempool::GetTransaction(const uint256& tx_hash) const
         return Result<Transaction>::Error("Mempool not initialized");
     }
 
-    std::string tx_key = impl_->Uint256ToHex(tx_hash);
-    auto it = impl_->entries.find(tx_key);
+    auto it = impl_->entries.find(tx_hash);
 
     if (it == impl_->entries.end()) {
         return Result<Transaction>::Error("Transaction not found");
@@ -507,8 +1579,7 @@ Result<MempoolEntry> INTcoinMempool::GetEntry(const uint256& tx_hash) const {
         return Result<MempoolEntry>::Error("Mempool not initialized");
     }
 
-    std::string tx_key = impl_->Uint256ToHex(tx_hash);
-    auto it = impl_->entries.find(tx_key);
+    auto it = impl_->entries.find(tx_hash);
 
     if (it == impl_->entries.end()) {
         return Result<MempoolEntry>::Error("Transaction not found");
@@ -517,29 +1588,36 @@ Result<MempoolEntry> INTcoinMempool::GetEntry(const uint256& tx_hash) const {
     return Result<MempoolEntry>::Ok(it->second);
 }
 
-std::vector<MempoolEntry> INTcoinMempool::GetAllTransactionsInternal() const {
-    // Note: Caller must hold mutex lock
-    std::vector<MempoolEntry> result;
-    result.reserve(impl_->entries.size());
+std::vector<MempoolEntry> INTcoinMempool::GetAllTransactions() const {
+    // Copy out of the published snapshot, without the lock
+    auto snapshot = GetSnapshot();
 
-    for (const auto& pair : impl_->entries) {
-        result.push_back(pair.second);
+    std::vector<MempoolEntry> result;
+    result.reserve(snapshot->entries.size());
+    for (const auto& entry : snapshot->entries) {
+        result.push_back(*entry);
     }
+    return result;
+}
 
-    // Sort by priority (descending), then fee_per_byte (descending)
-    std::sort(result.begin(), result.end(), [](const MempoolEntry& a, const MempoolEntry& b) {
-        if (a.priority != b.priority) {
-            return a.priority > b.priority;
-        }
-        return a.fee_per_byte > b.fee_per_byte;
-    });
+std::shared_ptr<const MempoolSnapshot> INTcoinMempool::GetSnapshot() const {
+    // Unchanged since the last publish: no locks at all
+    if (impl_->snapshot_published.load(std::memory_order_acquire) ==
+        impl_->snapshot_changes.load(std::memory_order_acquire)) {
+        return impl_->snapshot.load(std::memory_order_acquire);
+    }
+    return impl_->PublishSnapshot();
+}
 
-    return result;
+FeeHistogram INTcoinMempool::GetFeeHistogram() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->fee_histogram;
 }
 
-std::vector<MempoolEntry> INTcoinMempool::GetAllTransactions() const {
+FeeHistogram INTcoinMempool::GetFeeHistogram(TxPriority priority) const {
     std::lock_guard<std::mutex> lock(impl_->mutex);
-    return GetAllTransactionsInternal();
+    auto it = impl_->fee_histogram_by_priority.find(priority);
+    return it == impl_->fee_histogram_by_priority.end() ? FeeHistogram() : it->second;
 }
 
 std::vector<Transaction> INTcoinMempool::GetBlockTemplate(
@@ -551,41 +1629,89 @@ std::vector<Transaction> INTcoinMempool::GetBlockTemplate(
     std::vector<Transaction> result;
     uint64_t total_size = 0;
     uint64_t total_gas = 0;
-    constexpr uint64_t BLOCK_GAS_LIMIT = 30'000'000;  // 30M gas per block
 
-    // Get transactions ordered by priority and fee
-    auto all_entries = GetAllTransactionsInternal();
-
-    for (const auto& entry : all_entries) {
-        if (max_count > 0 && result.size() >= max_count) break;
-        if (total_size + entry.size_bytes > max_size_bytes) break;
+    // UTXO candidates are walked in ancestor score order. Each brings along
+    // whichever of its ancestors are not in the block yet, so a high-fee
+    // child pulls in a low-fee parent (CPFP) and parents always precede
+    // their children.
+    //
+    // Contract transactions come from the senders' executable heads in gas
+    // price order instead; taking one makes that sender's next nonce a
+    // candidate, so selecting k of them costs O(k log n). The two streams
+    // are merged by ancestor score.
+    std::unordered_set<uint256, uint256_hash> included;
+    std::vector<MempoolEntry*> package;
+
+    auto utxo_it = impl_->by_ancestor_score.begin();
+    auto head_it = impl_->contract_heads.begin();
+    std::set<MempoolEntry*, CompareByGasPrice> promoted;  // next nonces of selected senders
+
+    while (max_count == 0 || result.size() < max_count) {
+        while (utxo_it != impl_->by_ancestor_score.end() &&
+               ((*utxo_it)->tx.IsContractTransaction() || included.count((*utxo_it)->tx_hash) > 0)) {
+            ++utxo_it;
+        }
 
-        // Check gas limit for contract transactions
-        if (entry.tx.IsContractTransaction()) {
-            uint64_t tx_gas_limit = 0;
+        MempoolEntry* contract = nullptr;
+        if (head_it != impl_->contract_heads.end()) contract = *head_it;
+        if (!promoted.empty() && (contract == nullptr || CompareByGasPrice{}(*promoted.begin(), contract))) {
+            contract = *promoted.begin();
+        }
 
-            if (entry.tx.IsContractDeployment()) {
-                auto deploy_result = contracts::ContractDeploymentTx::Deserialize(entry.tx.contract_data);
-                if (deploy_result.has_value()) {
-                    tx_gas_limit = deploy_result.value().gas_limit;
-                }
-            } else if (entry.tx.IsContractCall()) {
-                auto call_result = contracts::ContractCallTx::Deserialize(entry.tx.contract_data);
-                if (call_result.has_value()) {
-                    tx_gas_limit = call_result.value().gas_limit;
-                }
+        MempoolEntry* candidate = nullptr;
+        if (contract != nullptr && (utxo_it == impl_->by_ancestor_score.end() ||
+                                    CompareByAncestorScore{}(contract, *utxo_it))) {
+            candidate = contract;
+            if (head_it != impl_->contract_heads.end() && *head_it == contract) {
+                ++head_it;
+            } else {
+                promoted.erase(promoted.begin());
             }
+        } else if (utxo_it != impl_->by_ancestor_score.end()) {
+            candidate = *utxo_it++;
+        } else {
+            break;
+        }
 
-            // Skip if adding this tx would exceed block gas limit
-            if (total_gas + tx_gas_limit > BLOCK_GAS_LIMIT) {
-                continue;
-            }
+        package = impl_->CollectAncestors(candidate->depends_on);
+        std::erase_if(package, [&](const MempoolEntry* e) { return included.count(e->tx_hash) > 0; });
 
-            total_gas += tx_gas_limit;
+        // Contract ancestors are only taken in their own sender's nonce order
+        if (std::any_of(package.begin(), package.end(),
+                        [](const MempoolEntry* e) { return e->tx.IsContractTransaction(); })) {
+            continue;
         }
+        package.push_back(candidate);
 
-        result.push_back(entry.tx);
-        total_size += entry.size_bytes;
+        uint64_t package_size = 0;
+        for (const MempoolEntry* member : package) {
+            package_size += member->size_bytes;
+        }
+
+        // A contract transaction that does not fit leaves the rest of its
+        // sender's queue for a later block
+        if (total_size + package_size > max_size_bytes) continue;
+        if (total_gas + candidate->gas_limit > BLOCK_GAS_LIMIT) continue;
+        if (max_count > 0 && result.size() + package.size() > max_count) continue;
+
+        // Ancestors have strictly fewer ancestors than their descendants
+        std::sort(package.begin(), package.end(), [](const MempoolEntry* a, const MempoolEntry* b) {
+            return a->ancestor_count < b->ancestor_count;
+        });
+        for (const MempoolEntry* member : package) {
+            included.insert(member->tx_hash);
+            result.push_back(member->tx);
+        }
+        total_size += package_size;
+        total_gas += candidate->gas_limit;
+
+        if (candidate->tx.IsContractTransaction()) {
+            const Impl::SenderQueue& queue = impl_->senders.at(candidate->contract_sender);
+            auto next_it = queue.by_nonce.upper_bound(candidate->contract_nonce);
+            if (next_it != queue.by_nonce.end() && next_it->first == candidate->contract_nonce + 1) {
+                promoted.insert(next_it->second);
+            }
+        }
     }
 
     return result;
@@ -600,15 +1726,30 @@ Result<uint32_t> INTcoinMempool::RemoveConfirmedTransactions(
         return Result<uint32_t>::Error("Mempool not initialized");
     }
 
+    // A block was connected: the rolling minimum fee may start to decay
+    impl_->block_since_rolling_fee_bump = true;
+
     uint32_t removed_count = 0;
 
+    // Confirmed contract transactions use up their senders' nonces
+    std::unordered_map<std::string, uint64_t> chain_nonces;
+
     for (const auto& tx_hash : tx_hashes) {
+        if (const MempoolEntry* entry = impl_->Find(tx_hash); entry && entry->tx.IsContractTransaction()) {
+            uint64_t& chain_nonce = chain_nonces[entry->contract_sender];
+            chain_nonce = std::max(chain_nonce, entry->contract_nonce + 1);
+        }
+
         auto remove_result = RemoveTransactionInternal(tx_hash);
         if (remove_result.IsOk()) {
             removed_count++;
         }
     }
 
+    for (const auto& [sender, chain_nonce] : chain_nonces) {
+        impl_->SetChainNonce(sender, chain_nonce);
+    }
+
     if (removed_count > 0) {
         LogF(LogLevel::INFO, "Mempool: Removed %u confirmed transactions", removed_count);
     }
@@ -626,40 +1767,27 @@ Result<uint32_t> INTcoinMempool::RemoveExpired() {
     std::time_t now = std::time(nullptr);
     std::time_t expiry_threshold = now - (impl_->config.expiry_hours * 3600);
 
-    std::vector<std::string> to_remove;
+    // Oldest entries come first in the entry time index
+    std::vector<uint256> to_remove;
 
-    for (const auto& pair : impl_->entries) {
-        if (pair.second.added_time < expiry_threshold) {
-            to_remove.push_back(pair.first);
-        }
+    for (const MempoolEntry* entry : impl_->by_entry_time) {
+        if (entry->added_time >= expiry_threshold) break;
+        to_remove.push_back(entry->tx_hash);
     }
 
     uint32_t removed_count = 0;
 
-    for (const auto& tx_key : to_remove) {
-        // Find and remove the entry
-        auto it = impl_->entries.find(tx_key);
-        if (it != impl_->entries.end()) {
-            const MempoolEntry& entry = it->second;
-
-            // Remove from priority queue
-            auto& pq = impl_->priority_queues[entry.priority];
-            auto range = pq.equal_range(entry.fee_per_byte);
-            for (auto pq_it = range.first; pq_it != range.second; ) {
-                if (pq_it->second == tx_key) {
-                    pq_it = pq.erase(pq_it);
-                    break;
-                } else {
-                    ++pq_it;
-                }
-            }
-
-            // Remove from storage
-            impl_->entries.erase(it);
-            removed_count++;
+    for (const auto& tx_hash : to_remove) {
+        // Descendants of an expired entry can no longer be mined either;
+        // they may already be gone with an earlier expired ancestor
+        if (MempoolEntry* entry = impl_->Find(tx_hash)) {
+            removed_count += impl_->RemoveWithDescendants(entry);
         }
     }
 
+    impl_->next_orphan_sweep = 0;
+    impl_->LimitOrphans();
+
     if (removed_count > 0) {
         LogF(LogLevel::INFO, "Mempool: Removed %u expired transactions", removed_count);
     }
@@ -670,36 +1798,27 @@ Result<uint32_t> INTcoinMempool::RemoveExpired() {
 MempoolStats INTcoinMempool::GetStats() const {
     std::lock_guard<std::mutex> lock(impl_->mutex);
 
+    // Everything here is a running total; nothing walks the entries
     MempoolStats stats = {};
 
     stats.total_transactions = impl_->entries.size();
-    stats.total_size_bytes = impl_->GetTotalSize();
-    stats.total_fees = 0;
-    stats.memory_usage_bytes = impl_->entries.size() * sizeof(MempoolEntry);
+    stats.total_size_bytes = impl_->total_size_bytes;
+    stats.total_fees = impl_->total_fees;
+    stats.memory_usage_bytes = impl_->total_memory_bytes;
     stats.orphan_count = impl_->orphan_txs.size();
+    stats.total_gas = impl_->total_gas_in_mempool;
+    stats.rolling_min_fee_per_kb = impl_->GetRollingMinFee();
 
-    uint64_t min_fee = UINT64_MAX;
-    uint64_t max_fee = 0;
-    uint64_t total_fee_per_byte = 0;
-
-    // Calculate stats by priority
-    for (const auto& pair : impl_->entries) {
-        const MempoolEntry& entry = pair.second;
-
-        stats.total_fees += entry.fee;
-        stats.count_by_priority[entry.priority]++;
-        stats.size_by_priority[entry.priority] += entry.size_bytes;
-
-        total_fee_per_byte += entry.fee_per_byte;
-
-        if (entry.fee < min_fee) min_fee = entry.fee;
-        if (entry.fee > max_fee) max_fee = entry.fee;
+    for (const auto& [priority, queue] : impl_->priority_queues) {
+        if (queue.empty()) continue;
+        stats.count_by_priority[priority] = queue.size();
+        stats.size_by_priority[priority] = impl_->size_by_priority[priority];
     }
 
-    stats.min_fee = (min_fee == UINT64_MAX) ? 0 : min_fee;
-    stats.max_fee = max_fee;
+    stats.min_fee = impl_->fees.empty() ? 0 : *impl_->fees.begin();
+    stats.max_fee = impl_->fees.empty() ? 0 : *impl_->fees.rbegin();
     stats.avg_fee_per_byte = stats.total_transactions > 0 ?
-        static_cast<double>(total_fee_per_byte) / stats.total_transactions : 0.0;
+        static_cast<double>(impl_->total_fee_per_byte) / stats.total_transactions : 0.0;
 
     return stats;
 }
@@ -715,89 +1834,208 @@ Result<uint64_t> INTcoinMempool::EstimateFee(
     }
 
     // Get transactions at this priority level
-    auto it = impl_->priority_queues.find(priority);
-    if (it == impl_->priority_queues.end() || it->second.empty()) {
+    auto it = impl_->fee_histogram_by_priority.find(priority);
+    if (it == impl_->fee_histogram_by_priority.end() || it->second.GetCount() == 0) {
         // No transactions at this priority, use min relay fee
         uint64_t fee = (size_bytes * impl_->config.min_relay_fee_per_kb) / 1024;
         return Result<uint64_t>::Ok(fee);
     }
 
-    // Use median fee_per_byte from this priority level
-    const auto& pq = it->second;
-    auto mid_it = pq.begin();
-    std::advance(mid_it, pq.size() / 2);
-    uint64_t median_fee_per_byte = mid_it->first;
+    // Use the median feerate of this priority level
+    double median_fee_per_byte = it->second.GetFeeRatePercentile(0.5);
 
-    uint64_t estimated_fee = median_fee_per_byte * size_bytes;
+    uint64_t estimated_fee = static_cast<uint64_t>(median_fee_per_byte * static_cast<double>(size_bytes));
     return Result<uint64_t>::Ok(estimated_fee);
 }
 
 Result<void> INTcoinMempool::Persist() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return PersistInternal();
+}
+
+Result<void> INTcoinMempool::PersistInternal() const {
     // Note: Caller must hold mutex lock
     if (!impl_->is_initialized) {
         return Result<void>::Error("Mempool not initialized");
     }
 
-    std::ofstream file(impl_->config.persist_file, std::ios::binary);
-    if (!file.is_open()) {
-        return Result<void>::Error("Failed to open mempool file for writing");
+    // Parents before children (fewer ancestors), so a reader can insert in
+    // file order
+    std::vector<const MempoolEntry*> ordered;
+    ordered.reserve(impl_->entries.size());
+    for (const auto& pair : impl_->entries) {
+        ordered.push_back(&pair.second);
     }
+    std::sort(ordered.begin(), ordered.end(), [](const MempoolEntry* a, const MempoolEntry* b) {
+        return a->ancestor_count < b->ancestor_count;
+    });
+
+    // Write a temporary file and rename it over the old dump, so a crash
+    // mid-write never leaves a truncated mempool.dat behind
+    const std::string& path = impl_->config.persist_file;
+    const std::string temp_path = path + ".new";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return Result<void>::Error("Failed to open mempool file for writing");
+        }
 
-    // Write header
-    uint32_t version = 1;
-    uint32_t count = impl_->entries.size();
-    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        FileWriter writer(file);
+        SerializeUint32(writer, MEMPOOL_DUMP_VERSION);
+        SerializeUint64(writer, ordered.size());
+        for (const MempoolEntry* entry : ordered) {
+            SerializeDumpedEntry(writer, *entry);
+        }
 
-    // Write entries (simplified - would need proper serialization)
-    // This is a placeholder implementation
-    for (const auto& pair : impl_->entries) {
-        (void)pair;  // Suppress unused warning - placeholder implementation
-        // Would serialize MempoolEntry here
+        file.flush();
+        if (!file.good()) {
+            file.close();
+            std::remove(temp_path.c_str());
+            return Result<void>::Error("Failed to write mempool file");
+        }
     }
 
-    file.close();
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return Result<void>::Error("Failed to replace mempool file");
+    }
 
-    LogF(LogLevel::INFO, "Mempool: Persisted %u transactions to %s",
-         count, impl_->config.persist_file.c_str());
+    LogF(LogLevel::INFO, "Mempool: Persisted %zu transactions to %s",
+         ordered.size(), path.c_str());
 
     return Result<void>::Ok();
 }
 
 Result<void> INTcoinMempool::Restore() {
-    // Note: Caller must hold mutex lock
-    std::ifstream file(impl_->config.persist_file, std::ios::binary);
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        if (!impl_->is_initialized) {
+            return Result<void>::Error("Mempool not initialized");
+        }
+        path = impl_->config.persist_file;
+    }
+
+    // Decode and revalidate without the lock: the admission hooks may
+    // query the mempool themselves
+    DumpBatch batch;
+    auto read_result = ReadDump(path, batch);
+    if (read_result.IsError()) {
+        return read_result;
+    }
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    if (!impl_->is_initialized) {
+        return Result<void>::Error("Mempool not initialized");
+    }
+    uint32_t restored = CommitDump(batch);
+
+    LogF(LogLevel::INFO, "Mempool: Restored %u of %zu transactions from %s",
+         restored, batch.dumped.size(), path.c_str());
+    return Result<void>::Ok();
+}
+
+Result<void> INTcoinMempool::ReadDump(const std::string& path, DumpBatch& batch) const {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
         return Result<void>::Error("Mempool file not found");
     }
+    std::streamoff file_size = file.tellg();
+    file.seekg(0);
+    FileReader reader(file, file_size > 0 ? static_cast<uint64_t>(file_size) : 0);
 
     // Read header
     uint32_t version = 0;
-    uint32_t count = 0;
-    file.read(reinterpret_cast<char*>(&version), sizeof(version));
-    file.read(reinterpret_cast<char*>(&count), sizeof(count));
-
-    if (version != 1) {
+    uint64_t count = 0;
+    if (!UnserializeUint32(reader, version) || !UnserializeUint64(reader, count)) {
+        return Result<void>::Error("Truncated mempool file");
+    }
+    if (version != MEMPOOL_DUMP_VERSION) {
         return Result<void>::Error("Unsupported mempool version");
     }
 
-    // Read entries (simplified - would need proper deserialization)
-    // This is a placeholder implementation
-    uint32_t restored = 0;
-    for (uint32_t i = 0; i < count; ++i) {
-        // Would deserialize MempoolEntry here
-        // Then call AddTransaction()
-        restored++;
+    // Decode records as they stream in
+    std::vector<DumpedTx>& dumped = batch.dumped;
+    dumped.reserve(BoundedReserve(reader, count, Transaction::MIN_SERIALIZED_SIZE));
+    for (uint64_t i = 0; i < count; ++i) {
+        auto result = UnserializeDumpedTx(reader, dumped.emplace_back());
+        if (result.IsError()) {
+            return Result<void>::Error("Corrupt mempool file (entry " + std::to_string(i) + "): " +
+                                       result.error);
+        }
     }
-
     file.close();
 
-    LogF(LogLevel::INFO, "Mempool: Restored %u transactions from %s",
-         restored, impl_->config.persist_file.c_str());
-
+    // Revalidate in parallel through the lock-free admission stage
+    // (stateless checks, transaction check, coin lookups)
+    batch.prepared.resize(dumped.size());
+    ibd::GetSharedThreadPool().ParallelFor(dumped.size(), [&](size_t i) {
+        PrepareTransaction(dumped[i].tx, batch.prepared[i]);
+    });
     return Result<void>::Ok();
 }
 
+uint32_t INTcoinMempool::CommitDump(const DumpBatch& batch) {
+    // Note: Caller must hold mutex lock
+    const std::vector<DumpedTx>& dumped = batch.dumped;
+    const std::vector<PreparedTx>& prepared = batch.prepared;
+
+    std::unordered_map<uint256, size_t, uint256_hash> index_by_hash;
+    index_by_hash.reserve(dumped.size());
+    for (size_t i = 0; i < dumped.size(); ++i) {
+        index_by_hash.emplace(prepared[i].tx_hash, i);
+    }
+
+    const std::time_t expiry_threshold =
+        std::time(nullptr) - static_cast<std::time_t>(impl_->config.expiry_hours) * 3600;
+
+    // Insert in dependency order (Kahn's algorithm over in-file parents),
+    // dropping anything whose parent was dropped
+    std::vector<std::vector<size_t>> children(dumped.size());
+    std::vector<size_t> pending_parents(dumped.size(), 0);
+    for (size_t i = 0; i < dumped.size(); ++i) {
+        std::set<size_t> parents;
+        for (const auto& input : dumped[i].tx.inputs) {
+            auto it = index_by_hash.find(input.prev_tx_hash);
+            if (it != index_by_hash.end() && it->second != i) parents.insert(it->second);
+        }
+        for (size_t parent : parents) children[parent].push_back(i);
+        pending_parents[i] = parents.size();
+    }
+
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < dumped.size(); ++i) {
+        if (pending_parents[i] == 0) ready.push_back(i);
+    }
+    std::reverse(ready.begin(), ready.end());  // pop in file order
+
+    std::vector<uint8_t> parent_dropped(dumped.size(), 0);
+    uint32_t restored = 0;
+    while (!ready.empty()) {
+        size_t i = ready.back();
+        ready.pop_back();
+        const DumpedTx& record = dumped[i];
+
+        const uint256& tx_hash = prepared[i].tx_hash;
+        if (record.added_time >= expiry_threshold && !parent_dropped[i] &&
+            CommitTransaction(prepared[i], record.priority).IsOk()) {
+            MempoolEntry* entry = impl_->Find(tx_hash);
+            impl_->SetEntryTime(entry, record.added_time);
+            if (record.fee_delta != 0) impl_->ApplyFeeDelta(entry, record.fee_delta);
+            restored++;
+        }
+
+        // Children need the parent in the pool, restored or already there
+        bool parent_present = impl_->entries.count(tx_hash) > 0;
+        for (size_t child : children[i]) {
+            if (!parent_present) parent_dropped[child] = 1;
+            if (--pending_parents[child] == 0) ready.push_back(child);
+        }
+    }
+
+    return restored;
+}
+
 Result<void> INTcoinMempool::Clear() {
     std::lock_guard<std::mutex> lock(impl_->mutex);
 
@@ -805,9 +2043,7 @@ Result<void> INTcoinMempool::Clear() {
         return Result<void>::Error("Mempool not initialized");
     }
 
-    impl_->entries.clear();
-    impl_->priority_queues.clear();
-    impl_->orphan_txs.clear();
+    impl_->ClearAll();
 
     // Re-initialize priority queues
     for (int i = 0; i <= static_cast<int>(TxPriority::CRITICAL); ++i) {
@@ -818,6 +2054,68 @@ Result<void> INTcoinMempool::Clear() {
     return Result<void>::Ok();
 }
 
+bool INTcoinMempool::HasOrphan(const uint256& tx_hash) const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->orphan_txs.count(tx_hash) > 0;
+}
+
+uint32_t INTcoinMempool::EraseOrphansForPeer(uint64_t peer_id) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->EraseOrphansForPeer(peer_id);
+}
+
+void INTcoinMempool::SetCoinLookup(CoinLookup lookup) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->coin_lookup = std::move(lookup);
+}
+
+void INTcoinMempool::SetTransactionCheck(TxCheck check) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->tx_check = std::move(check);
+}
+
+void INTcoinMempool::SetNonceLookup(NonceLookup lookup) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->nonce_lookup = std::move(lookup);
+}
+
+Result<uint32_t> INTcoinMempool::TrimToSize(uint64_t max_bytes) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+
+    if (!impl_->is_initialized) {
+        return Result<uint32_t>::Error("Mempool not initialized");
+    }
+
+    uint32_t removed_count = static_cast<uint32_t>(impl_->TrimToSize(max_bytes));
+    if (removed_count > 0) {
+        LogF(LogLevel::INFO, "Mempool: Trimmed %u transactions (rolling min fee: %lu ints/KB)",
+             removed_count, impl_->GetRollingMinFee());
+    }
+
+    return Result<uint32_t>::Ok(removed_count);
+}
+
+uint64_t INTcoinMempool::GetMinFeePerKb() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->GetMinFeePerKb();
+}
+
+Result<void> INTcoinMempool::PrioritiseTransaction(const uint256& tx_hash, int64_t fee_delta) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+
+    if (!impl_->is_initialized) {
+        return Result<void>::Error("Mempool not initialized");
+    }
+
+    MempoolEntry* entry = impl_->Find(tx_hash);
+    if (entry == nullptr) {
+        return Result<void>::Error("Transaction not found");
+    }
+
+    impl_->ApplyFeeDelta(entry, fee_delta);
+    return Result<void>::Ok();
+}
+
 // Private methods
 
 TxPriority INTcoinMempool::DeterminePriority(
@@ -849,28 +2147,23 @@ bool INTcoinMempool::ValidateTransaction(const Transaction& tx) const {
 }
 
 void INTcoinMempool::EvictLowPriority() {
-    // Evict lowest priority, lowest fee transactions first
-    for (int priority = 0; priority <= static_cast<int>(TxPriority::NORMAL); ++priority) {
-        auto& pq = impl_->priority_queues[static_cast<TxPriority>(priority)];
-
-        if (!pq.empty()) {
-            // Remove lowest fee transaction
-            auto it = pq.begin();
-            std::string tx_key = it->second;
-            pq.erase(it);
-            impl_->entries.erase(tx_key);
-
-            LogF(LogLevel::INFO, "Mempool: Evicted low priority tx %s",
-                 tx_key.substr(0, 16).c_str());
-            return;
-        }
-    }
+    // Evict the lowest priority, lowest descendant score package first.
+    // HIGH and above are never evicted.
+    if (impl_->by_descendant_score.empty()) return;
+
+    MempoolEntry* worst = *impl_->by_descendant_score.begin();
+    if (worst->priority > TxPriority::NORMAL) return;
+
+    uint256 tx_hash = worst->tx_hash;
+    size_t removed = impl_->RemoveWithDescendants(worst);
+
+    LogF(LogLevel::INFO, "Mempool: Evicted low priority tx %s (%zu with descendants)",
+         ShortHash(tx_hash).data(), removed);
 }
 
 uint64_t INTcoinMempool::CalculateTxSize(const Transaction& tx) const {
-    // Simplified size calculation
-    // Would calculate actual serialized size
-    return 250;  // Placeholder: average transaction size
+    // Serialized size: what the feerates, trimming and stats are measured in
+    return tx.GetSerializedSize();
 }
 
 } // namespace intcoin
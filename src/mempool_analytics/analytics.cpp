@@ -2,9 +2,11 @@
 // Distributed under the MIT software license
 
 #include <intcoin/mempool_analytics/analytics.h>
+#include <algorithm>
 #include <mutex>
 #include <deque>
 #include <chrono>
+#include <cmath>
 #include <sstream>
 
 namespace intcoin {
@@ -14,6 +16,7 @@ class MempoolAnalytics::Impl {
 public:
     mutable std::mutex mutex_;
     MempoolStats current_stats_;
+    FeeHistogram fee_histogram_;
     std::deque<MempoolSnapshot> history_;
 
     // Flow tracking
@@ -43,6 +46,17 @@ public:
         ).count();
     }
 
+    static uint64_t FeeOf(uint64_t tx_size, double fee_rate) {
+        return static_cast<uint64_t>(std::llround(std::max(fee_rate, 0.0) * static_cast<double>(tx_size)));
+    }
+
+    void UpdateFeeRates() {
+        current_stats_.avg_fee_rate = fee_histogram_.GetSizeBytes() > 0
+            ? static_cast<double>(fee_histogram_.GetFees()) / static_cast<double>(fee_histogram_.GetSizeBytes())
+            : 0.0;
+        current_stats_.median_fee_rate = fee_histogram_.GetFeeRatePercentile(0.5);
+    }
+
     void UpdateFlowMetrics() {
         uint64_t now = GetCurrentTimestamp();
         uint64_t elapsed = now - last_flow_update_;
@@ -70,6 +84,11 @@ MempoolStats MempoolAnalytics::GetCurrentStats() const {
     return pimpl_->current_stats_;
 }
 
+FeeHistogram MempoolAnalytics::GetFeeHistogram() const {
+    std::lock_guard<std::mutex> lock(pimpl_->mutex_);
+    return pimpl_->fee_histogram_;
+}
+
 std::vector<MempoolSnapshot> MempoolAnalytics::GetHistory(
     uint64_t start_time,
     uint64_t end_time
@@ -148,6 +167,8 @@ void MempoolAnalytics::OnTransactionAdded(
     pimpl_->current_stats_.bytes += tx_size;
     pimpl_->transactions_added_++;
     pimpl_->transactions_added_window_++;  // Track for flow window
+    pimpl_->fee_histogram_.Add(Impl::FeeOf(tx_size, fee_rate), tx_size);
+    pimpl_->UpdateFeeRates();
 
     // Update priority distribution
     switch (priority) {
@@ -177,6 +198,8 @@ void MempoolAnalytics::OnTransactionRemoved(
     }
     pimpl_->transactions_removed_++;
     pimpl_->transactions_removed_window_++;  // Track for flow window
+    pimpl_->fee_histogram_.Remove(Impl::FeeOf(tx_size, fee_rate), tx_size);
+    pimpl_->UpdateFeeRates();
 
     // Update priority distribution
     switch (priority) {
@@ -232,6 +255,8 @@ std::string MempoolAnalytics::ExportToJSON() const {
     oss << "  \"current_stats\": {\n";
     oss << "    \"size\": " << pimpl_->current_stats_.size << ",\n";
     oss << "    \"bytes\": " << pimpl_->current_stats_.bytes << ",\n";
+    oss << "    \"avg_fee_rate\": " << pimpl_->current_stats_.avg_fee_rate << ",\n";
+    oss << "    \"median_fee_rate\": " << pimpl_->current_stats_.median_fee_rate << ",\n";
     oss << "    \"priority_distribution\": {\n";
     oss << "      \"low\": " << pimpl_->current_stats_.priority_dist.low_count << ",\n";
     oss << "      \"normal\": " << pimpl_->current_stats_.priority_dist.normal_count << ",\n";
@@ -241,6 +266,19 @@ std::string MempoolAnalytics::ExportToJSON() const {
     oss << "      \"critical\": " << pimpl_->current_stats_.priority_dist.critical_count << "\n";
     oss << "    }\n";
     oss << "  },\n";
+    oss << "  \"fee_histogram\": [";
+    const auto& buckets = pimpl_->fee_histogram_.GetBuckets();
+    bool first = true;
+    for (size_t i = FeeHistogram::NUM_BUCKETS; i-- > 0;) {
+        if (buckets[i].count == 0) continue;
+        oss << (first ? "\n" : ",\n");
+        oss << "    {\"feerate\": " << FeeHistogram::BUCKET_MIN_FEE_RATES[i]
+            << ", \"count\": " << buckets[i].count
+            << ", \"size\": " << buckets[i].size_bytes
+            << ", \"fees\": " << buckets[i].fees << "}";
+        first = false;
+    }
+    oss << (first ? "],\n" : "\n  ],\n");
     oss << "  \"history_size\": " << pimpl_->history_.size() << "\n";
     oss << "}\n";
 
@@ -379,6 +379,16 @@ Histogram& message_processing_duration = MetricsRegistry::Instance().RegisterHis
     DURATION_BUCKETS
 );
 
+Counter& tx_recently_rejected_hits = MetricsRegistry::Instance().RegisterCounter(
+    "intcoin_tx_recently_rejected_hits_total",
+    "Total transaction announcements skipped because the tx was recently rejected"
+);
+
+Counter& tx_recently_confirmed_hits = MetricsRegistry::Instance().RegisterCounter(
+    "intcoin_tx_recently_confirmed_hits_total",
+    "Total transaction announcements skipped because the tx was recently confirmed"
+);
+
 // Mining metrics
 Counter& blocks_mined = MetricsRegistry::Instance().RegisterCounter(
     "intcoin_blocks_mined_total",
@@ -401,6 +411,22 @@ Histogram& mining_duration = MetricsRegistry::Instance().RegisterHistogram(
     {100, 500, 1000, 5000, 10000, 30000, 60000, 120000, 300000, 600000}
 );
 
+// Consensus metrics
+Counter& pow_cache_hits = MetricsRegistry::Instance().RegisterCounter(
+    "intcoin_pow_cache_hits_total",
+    "Total RandomX hash evaluations avoided by the PoW cache"
+);
+
+Counter& pow_cache_misses = MetricsRegistry::Instance().RegisterCounter(
+    "intcoin_pow_cache_misses_total",
+    "Total PoW cache lookups that required a RandomX hash evaluation"
+);
+
+Gauge& pow_cache_entries = MetricsRegistry::Instance().RegisterGauge(
+    "intcoin_pow_cache_entries",
+    "Current number of verified headers in the PoW cache"
+);
+
 // Wallet metrics
 Gauge& wallet_balance = MetricsRegistry::Instance().RegisterGauge(
     "intcoin_wallet_balance_ints",
@@ -53,18 +53,8 @@ double CalculateHashrate(uint64_t hashes, double time_seconds) {
 }
 
 bool CheckHash(const uint256& hash, const uint256& target) {
-    // Compare hash with target (lower hash value = more difficult)
-    // Compare in big-endian order (from most significant byte to least)
-    // to match CheckProofOfWork in consensus.cpp
-    for (int i = 31; i >= 0; --i) {
-        if (hash[i] < target[i]) {
-            return true; // Hash meets target
-        }
-        if (hash[i] > target[i]) {
-            return false; // Hash doesn't meet target
-        }
-    }
-    return true; // Hashes are equal
+    // Lower hash value = more difficult; matches CheckProofOfWork in consensus.cpp
+    return UintToArith256(hash) <= UintToArith256(target);
 }
 
 std::string FormatHashrate(double hashrate) {
@@ -958,31 +958,32 @@ Result<FeeRecommendation> FeeEstimator::EstimateFromMempool(
     const std::vector<Transaction>& mempool_txs,
     size_t tx_size_bytes) {
 
-    if (mempool_txs.empty()) {
-        return EstimateFee(tx_size_bytes, 6);
-    }
-
-    // Calculate fee rates for mempool transactions
-    std::vector<double> mempool_fee_rates;
+    // Bucket the mempool transactions' fee rates
+    FeeHistogram histogram;
     for (const auto& tx : mempool_txs) {
-        auto serialized = tx.Serialize();
-        size_t tx_size = serialized.size();
+        size_t tx_size = tx.GetSerializedSize();
 
         // Estimate input sum (we don't have UTXO set)
         uint64_t output_sum = tx.GetTotalOutputValue();
         uint64_t input_sum = static_cast<uint64_t>(output_sum * 1.01);
 
-        uint64_t fee = input_sum - output_sum;
-        double fee_rate = static_cast<double>(fee) / static_cast<double>(tx_size);
-        mempool_fee_rates.push_back(fee_rate);
+        histogram.Add(input_sum - output_sum, tx_size);
     }
 
-    // Sort and get percentiles
-    std::sort(mempool_fee_rates.begin(), mempool_fee_rates.end(), std::greater<double>());
+    return EstimateFromMempool(histogram, tx_size_bytes);
+}
+
+Result<FeeRecommendation> FeeEstimator::EstimateFromMempool(
+    const FeeHistogram& histogram,
+    size_t tx_size_bytes) {
+
+    if (histogram.GetCount() == 0) {
+        return EstimateFee(tx_size_bytes, 6);
+    }
 
-    double low_fee_rate = stats::Percentile(mempool_fee_rates, 0.75);
-    double med_fee_rate = stats::Percentile(mempool_fee_rates, 0.50);
-    double high_fee_rate = stats::Percentile(mempool_fee_rates, 0.25);
+    double low_fee_rate = histogram.GetFeeRatePercentile(0.25);
+    double med_fee_rate = histogram.GetFeeRatePercentile(0.50);
+    double high_fee_rate = histogram.GetFeeRatePercentile(0.75);
 
     FeeRecommendation rec;
     rec.low_priority_fee = static_cast<uint64_t>(low_fee_rate * tx_size_bytes);
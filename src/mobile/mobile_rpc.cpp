@@ -129,8 +129,7 @@ Result<SendTransactionResponse> MobileRPC::SendTransaction(const SendTransaction
     response.estimated_confirmation = 300;  // ~5 minutes (default block time)
 
     LogF(LogLevel::INFO, "Mobile RPC: Broadcasting transaction %s",
-         BytesToHex(std::vector<uint8_t>(response.tx_hash.begin(),
-                                         response.tx_hash.end())).substr(0, 16).c_str());
+         BytesToHex(response.tx_hash).substr(0, 16).c_str());
 
     return Result<SendTransactionResponse>::Ok(response);
 }
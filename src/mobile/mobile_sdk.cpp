@@ -333,8 +333,7 @@ Result<uint256> MobileSDK::SendTransaction(const Transaction& tx) {
     }
 
     LogF(LogLevel::INFO, "Mobile SDK: Broadcast transaction %s",
-         BytesToHex(std::vector<uint8_t>(response.tx_hash.begin(),
-                                        response.tx_hash.end())).substr(0, 16).c_str());
+         BytesToHex(response.tx_hash).substr(0, 16).c_str());
 
     // Trigger transaction event
     if (tx_callback_) {
@@ -5,12 +5,16 @@
 
 #include "intcoin/network.h"
 #include "intcoin/blockchain.h"
+#include "intcoin/consensus.h"
 #include "intcoin/crypto.h"
+#include "intcoin/metrics.h"
 #include "intcoin/util.h"
 #include <sstream>
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <cerrno>
+#include <memory_resource>
 #include <mutex>
 #include <unordered_map>
 #include <fstream>
@@ -19,6 +23,7 @@
 #include <optional>
 #include <ctime>
 #include <cmath>
+#include <span>
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
@@ -159,54 +164,19 @@ NetworkAddress::NetworkAddress(const std::string& ip_str, uint16_t p)
 
 std::vector<uint8_t> NetworkAddress::Serialize() const {
     std::vector<uint8_t> data;
-
-    // Timestamp (8 bytes)
-    for (int i = 0; i < 8; i++) {
-        data.push_back((timestamp >> (i * 8)) & 0xFF);
-    }
-
-    // Services (8 bytes)
-    for (int i = 0; i < 8; i++) {
-        data.push_back((services >> (i * 8)) & 0xFF);
-    }
-
-    // IP address (16 bytes)
-    data.insert(data.end(), ip.begin(), ip.end());
-
-    // Port (2 bytes, big-endian)
-    data.push_back((port >> 8) & 0xFF);
-    data.push_back(port & 0xFF);
-
+    data.reserve(SERIALIZED_SIZE);
+    VectorWriter writer(data);
+    Serialize(writer);
     return data;
 }
 
 Result<NetworkAddress> NetworkAddress::Deserialize(const std::vector<uint8_t>& data) {
-    if (data.size() < 34) {
-        return Result<NetworkAddress>::Error("NetworkAddress data too short");
-    }
-
+    SpanReader reader(data);
     NetworkAddress addr;
-    size_t pos = 0;
-
-    // Timestamp (8 bytes)
-    addr.timestamp = 0;
-    for (int i = 0; i < 8; i++) {
-        addr.timestamp |= (static_cast<uint64_t>(data[pos++]) << (i * 8));
-    }
-
-    // Services (8 bytes)
-    addr.services = 0;
-    for (int i = 0; i < 8; i++) {
-        addr.services |= (static_cast<uint64_t>(data[pos++]) << (i * 8));
+    auto result = addr.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<NetworkAddress>::Error(result.error);
     }
-
-    // IP address (16 bytes)
-    std::copy(data.begin() + pos, data.begin() + pos + 16, addr.ip.begin());
-    pos += 16;
-
-    // Port (2 bytes, big-endian)
-    addr.port = (static_cast<uint16_t>(data[pos]) << 8) | data[pos + 1];
-
     return Result<NetworkAddress>::Ok(addr);
 }
 
@@ -275,32 +245,17 @@ NetworkMessage::NetworkMessage(uint32_t m, const std::string& cmd,
     checksum = CalculateChecksum(payload);
 }
 
+NetworkMessage::NetworkMessage(uint32_t m, const std::string& cmd,
+                              std::vector<uint8_t>&& data)
+    : magic(m), command(cmd), length(data.size()), payload(std::move(data)) {
+    checksum = CalculateChecksum(payload);
+}
+
 std::vector<uint8_t> NetworkMessage::Serialize() const {
     std::vector<uint8_t> data;
-
-    // Magic (4 bytes)
-    for (int i = 0; i < 4; i++) {
-        data.push_back((magic >> (i * 8)) & 0xFF);
-    }
-
-    // Command (12 bytes, null-padded)
-    std::string cmd = command;
-    cmd.resize(12, '\0');
-    data.insert(data.end(), cmd.begin(), cmd.end());
-
-    // Length (4 bytes)
-    for (int i = 0; i < 4; i++) {
-        data.push_back((length >> (i * 8)) & 0xFF);
-    }
-
-    // Checksum (4 bytes)
-    for (int i = 0; i < 4; i++) {
-        data.push_back((checksum >> (i * 8)) & 0xFF);
-    }
-
-    // Payload
-    data.insert(data.end(), payload.begin(), payload.end());
-
+    data.reserve(GetSerializedSize());
+    VectorWriter writer(data);
+    Serialize(writer);
     return data;
 }
 
@@ -374,40 +329,34 @@ uint32_t NetworkMessage::CalculateChecksum(const std::vector<uint8_t>& data) {
 
 std::vector<uint8_t> InvVector::Serialize() const {
     std::vector<uint8_t> data;
-
-    // Type (4 bytes)
-    uint32_t type_val = static_cast<uint32_t>(type);
-    for (int i = 0; i < 4; i++) {
-        data.push_back((type_val >> (i * 8)) & 0xFF);
-    }
-
-    // Hash (32 bytes)
-    data.insert(data.end(), hash.begin(), hash.end());
-
+    data.reserve(SERIALIZED_SIZE);
+    VectorWriter writer(data);
+    Serialize(writer);
     return data;
 }
 
 Result<InvVector> InvVector::Deserialize(const std::vector<uint8_t>& data) {
-    if (data.size() < 36) {
-        return Result<InvVector>::Error("InvVector data too short");
-    }
-
+    SpanReader reader(data);
     InvVector inv;
-    size_t pos = 0;
-
-    // Type (4 bytes)
-    uint32_t type_val = 0;
-    for (int i = 0; i < 4; i++) {
-        type_val |= (static_cast<uint32_t>(data[pos++]) << (i * 8));
+    auto result = inv.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<InvVector>::Error(result.error);
     }
-    inv.type = static_cast<InvType>(type_val);
-
-    // Hash (32 bytes)
-    std::copy(data.begin() + pos, data.begin() + pos + 32, inv.hash.begin());
-
     return Result<InvVector>::Ok(inv);
 }
 
+/// Build an inv/getdata/notfound payload (1-byte count + items) in one allocation
+static std::vector<uint8_t> SerializeInvPayload(std::span<const InvVector> items) {
+    std::vector<uint8_t> payload;
+    payload.reserve(1 + items.size() * InvVector::SERIALIZED_SIZE);
+    payload.push_back(static_cast<uint8_t>(items.size()));
+    VectorWriter writer(payload);
+    for (const auto& inv : items) {
+        inv.Serialize(writer);
+    }
+    return payload;
+}
+
 // ============================================================================
 // Peer Implementation
 // ============================================================================
@@ -945,14 +894,8 @@ void P2PNode::BroadcastBlock(const uint256& block_hash) {
     inv.type = InvType::BLOCK;
     inv.hash = block_hash;
 
-    // Serialize INV vector
-    std::vector<uint8_t> inv_payload;
-    inv_payload.push_back(1); // count = 1
-    auto serialized = inv.Serialize();
-    inv_payload.insert(inv_payload.end(), serialized.begin(), serialized.end());
-
     // Create and broadcast INV message
-    NetworkMessage inv_msg(impl_->network_magic, "inv", inv_payload);
+    NetworkMessage inv_msg(impl_->network_magic, "inv", SerializeInvPayload({&inv, 1}));
     BroadcastMessage(inv_msg);
 }
 
@@ -962,14 +905,8 @@ void P2PNode::BroadcastTransaction(const uint256& tx_hash) {
     inv.type = InvType::TX;
     inv.hash = tx_hash;
 
-    // Serialize INV vector
-    std::vector<uint8_t> inv_payload;
-    inv_payload.push_back(1); // count = 1
-    auto serialized = inv.Serialize();
-    inv_payload.insert(inv_payload.end(), serialized.begin(), serialized.end());
-
     // Create and broadcast INV message
-    NetworkMessage inv_msg(impl_->network_magic, "inv", inv_payload);
+    NetworkMessage inv_msg(impl_->network_magic, "inv", SerializeInvPayload({&inv, 1}));
     BroadcastMessage(inv_msg);
 }
 
@@ -979,14 +916,8 @@ void P2PNode::BroadcastTransaction(const uint256& tx_hash, uint64_t skip_peer_id
     inv.type = InvType::TX;
     inv.hash = tx_hash;
 
-    // Serialize INV vector
-    std::vector<uint8_t> inv_payload;
-    inv_payload.push_back(1); // count = 1
-    auto serialized = inv.Serialize();
-    inv_payload.insert(inv_payload.end(), serialized.begin(), serialized.end());
-
     // Create and broadcast INV message (skip sender to prevent relay loop)
-    NetworkMessage inv_msg(impl_->network_magic, "inv", inv_payload);
+    NetworkMessage inv_msg(impl_->network_magic, "inv", SerializeInvPayload({&inv, 1}));
     BroadcastMessage(inv_msg, skip_peer_id);
 }
 
@@ -1425,40 +1356,24 @@ Result<void> MessageHandler::HandleInv(Peer& peer,
             }
             items_to_request.push_back(inv);
         } else if (inv.type == InvType::TX) {
-            // Check if we already have this transaction in mempool
-            bool have_tx = false;
-            if (blockchain) {
-                auto& mempool = blockchain->GetMempool();
-                auto mempool_txs = mempool.GetAllTransactions();
-                for (const auto& tx : mempool_txs) {
-                    if (tx.GetHash() == inv.hash) {
-                        have_tx = true;
-                        break;
-                    }
-                }
+            // Skip transactions we rejected or saw confirmed recently
+            if (RecentTxFilter::Instance().Contains(inv.hash)) {
+                continue;
             }
 
-            if (!have_tx) {
-                items_to_request.push_back(inv);
+            // Check if we already have this transaction in mempool
+            if (blockchain && blockchain->GetMempool().HasTransaction(inv.hash)) {
+                continue;
             }
+
+            items_to_request.push_back(inv);
         }
     }
 
     // Send GETDATA message to request the items
     if (!items_to_request.empty()) {
-        std::vector<uint8_t> getdata_payload;
-
-        // Count
-        getdata_payload.push_back(static_cast<uint8_t>(items_to_request.size()));
-
-        // Serialize each item
-        for (const auto& inv : items_to_request) {
-            auto serialized = inv.Serialize();
-            getdata_payload.insert(getdata_payload.end(),
-                                 serialized.begin(), serialized.end());
-        }
-
-        NetworkMessage getdata(network::MAINNET_MAGIC, "getdata", getdata_payload);
+        NetworkMessage getdata(network::MAINNET_MAGIC, "getdata",
+                               SerializeInvPayload(items_to_request));
         auto send_result = peer.SendMessage(getdata);
         if (send_result.IsError()) {
             return Result<void>::Error("Failed to send GETDATA: " + send_result.error);
@@ -1523,9 +1438,7 @@ Result<void> MessageHandler::HandleGetData(Peer& peer,
             if (block_result.IsOk()) {
                 // Serialize and send block
                 auto block = block_result.value.value();
-                auto block_payload = block.Serialize();
-
-                NetworkMessage block_msg(network::MAINNET_MAGIC, "block", block_payload);
+                NetworkMessage block_msg(network::MAINNET_MAGIC, "block", block.Serialize());
                 auto send_result = peer.SendMessage(block_msg);
                 if (send_result.IsError()) {
                     // Failed to send, but don't fail the whole handler
@@ -1545,8 +1458,7 @@ Result<void> MessageHandler::HandleGetData(Peer& peer,
             for (const auto& tx : mempool_txs) {
                 if (tx.GetHash() == inv.hash) {
                     // Found in mempool - send it
-                    auto tx_payload = tx.Serialize();
-                    NetworkMessage tx_msg(network::MAINNET_MAGIC, "tx", tx_payload);
+                    NetworkMessage tx_msg(network::MAINNET_MAGIC, "tx", tx.Serialize());
                     auto send_result = peer.SendMessage(tx_msg);
                     if (send_result.IsOk()) {
                         found = true;
@@ -1561,8 +1473,7 @@ Result<void> MessageHandler::HandleGetData(Peer& peer,
                 if (tx_result.IsOk()) {
                     // Found in blockchain - send it
                     auto tx = tx_result.value.value();
-                    auto tx_payload = tx.Serialize();
-                    NetworkMessage tx_msg(network::MAINNET_MAGIC, "tx", tx_payload);
+                    NetworkMessage tx_msg(network::MAINNET_MAGIC, "tx", tx.Serialize());
                     auto send_result = peer.SendMessage(tx_msg);
                     if (send_result.IsError()) {
                         continue;
@@ -1577,16 +1488,8 @@ Result<void> MessageHandler::HandleGetData(Peer& peer,
 
     // Send NOTFOUND message for items we couldn't find (batch)
     if (!not_found_items.empty()) {
-        std::vector<uint8_t> notfound_payload;
-        notfound_payload.push_back(static_cast<uint8_t>(not_found_items.size()));
-
-        for (const auto& inv : not_found_items) {
-            auto serialized = inv.Serialize();
-            notfound_payload.insert(notfound_payload.end(),
-                                  serialized.begin(), serialized.end());
-        }
-
-        NetworkMessage notfound_msg(network::MAINNET_MAGIC, "notfound", notfound_payload);
+        NetworkMessage notfound_msg(network::MAINNET_MAGIC, "notfound",
+                                    SerializeInvPayload(not_found_items));
         peer.SendMessage(notfound_msg);
     }
 
@@ -1604,17 +1507,33 @@ Result<void> MessageHandler::HandleBlock(Peer& peer,
         return Result<void>::Error("Empty BLOCK payload");
     }
 
-    // Deserialize block
-    auto result = Block::Deserialize(payload);
+    // Decode into an arena scoped to this message first: blocks we already
+    // have, and blocks whose transactions don't match their merkle root,
+    // are dropped without building the owning Block
+    std::pmr::monotonic_buffer_resource arena(BlockView::ArenaSizeHint(payload.size()));
+    BlockView view(&arena);
+    SpanReader reader(payload);
+    auto result = view.Unserialize(reader);
     if (result.IsError()) {
         peer.IncreaseBanScore(10);
         return Result<void>::Error("Invalid block: " + result.error);
     }
 
-    auto block = result.value.value();
-
     // Calculate block hash
-    auto block_hash = block.GetHash();
+    auto block_hash = view.GetHash();
+
+    // Check if we already have this block
+    if (blockchain && blockchain->HasBlock(block_hash)) {
+        return Result<void>::Ok();
+    }
+
+    // Check merkle root matches transactions (txids carry over to the Block)
+    if (view.CalculateMerkleRoot() != view.header.merkle_root) {
+        peer.IncreaseBanScore(100); // Severe violation
+        return Result<void>::Error("Merkle root mismatch");
+    }
+
+    Block block = view.ToBlock();
 
     // Basic validation
     // 1. Verify block structure and PoW (requires blockchain for full validation)
@@ -1640,13 +1559,7 @@ Result<void> MessageHandler::HandleBlock(Peer& peer,
 
     // Additional validation (if blockchain is available)
     if (blockchain) {
-        // 3. Check if we already have this block
-        if (blockchain->HasBlock(block_hash)) {
-            // Already have this block, no need to process
-            return Result<void>::Ok();
-        }
-
-        // 4. Verify block connects to the chain (check prev_block_hash exists)
+        // 3. Verify block connects to the chain (check prev_block_hash exists)
         if (!block.IsGenesis() && !blockchain->HasBlock(block.header.prev_block_hash)) {
             // Parent block is missing - add to orphan pool if available
             if (p2p_impl) {
@@ -1657,14 +1570,8 @@ Result<void> MessageHandler::HandleBlock(Peer& peer,
                 parent_inv.type = InvType::BLOCK;
                 parent_inv.hash = block.header.prev_block_hash;
 
-                std::vector<uint8_t> getdata_payload;
-                getdata_payload.push_back(1);  // Count: 1 item
-
-                auto serialized_inv = parent_inv.Serialize();
-                getdata_payload.insert(getdata_payload.end(),
-                                     serialized_inv.begin(), serialized_inv.end());
-
-                NetworkMessage getdata(network::MAINNET_MAGIC, "getdata", getdata_payload);
+                NetworkMessage getdata(network::MAINNET_MAGIC, "getdata",
+                                       SerializeInvPayload({&parent_inv, 1}));
                 auto send_result = peer.SendMessage(getdata);
                 if (send_result.IsError()) {
                     LogF(LogLevel::WARNING, "Failed to request parent block %s: %s",
@@ -1683,21 +1590,14 @@ Result<void> MessageHandler::HandleBlock(Peer& peer,
             }
         }
 
-        // 5. Validate all transactions in the block
+        // 4. Validate all transactions in the block
         auto tx_validate_result = block.VerifyTransactions(*blockchain);
         if (tx_validate_result.IsError()) {
             peer.IncreaseBanScore(50);
             return Result<void>::Error("Block transaction validation failed: " + tx_validate_result.error);
         }
 
-        // 6. Check merkle root matches transactions
-        uint256 calculated_merkle_root = block.CalculateMerkleRoot();
-        if (calculated_merkle_root != block.header.merkle_root) {
-            peer.IncreaseBanScore(100); // Severe violation
-            return Result<void>::Error("Merkle root mismatch");
-        }
-
-        // 7. Add to blockchain if valid
+        // 5. Add to blockchain if valid
         auto add_result = blockchain->AddBlock(block);
         if (add_result.IsError()) {
             peer.IncreaseBanScore(20);
@@ -1787,26 +1687,29 @@ Result<void> MessageHandler::HandleTx(Peer& peer,
         return Result<void>::Error("Empty TX payload");
     }
 
-    // Deserialize transaction
-    auto result = Transaction::Deserialize(payload);
+    // Decode in place first; the owning Transaction is only built for
+    // well-formed transactions the mempool doesn't already have
+    std::array<std::byte, 1024> arena_buffer;
+    std::pmr::monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size());
+    TransactionView view(&arena);
+    SpanReader reader(payload);
+    auto result = view.Unserialize(reader);
     if (result.IsError()) {
         peer.IncreaseBanScore(10);
         return Result<void>::Error("Invalid transaction: " + result.error);
     }
 
-    auto tx = result.value.value();
-
     // Calculate transaction hash
-    auto tx_hash = tx.GetHash();
+    auto tx_hash = view.GetHash();
 
     // Basic validation
     // 1. Check transaction format
-    if (tx.inputs.empty()) {
+    if (view.inputs.empty()) {
         peer.IncreaseBanScore(10);
         return Result<void>::Error("Transaction has no inputs");
     }
 
-    if (tx.outputs.empty()) {
+    if (view.outputs.empty()) {
         peer.IncreaseBanScore(10);
         return Result<void>::Error("Transaction has no outputs");
     }
@@ -1815,19 +1718,33 @@ Result<void> MessageHandler::HandleTx(Peer& peer,
     if (blockchain) {
         // 2. Check for duplicate transaction in mempool
         auto& mempool = blockchain->GetMempool();
-        auto mempool_txs = mempool.GetAllTransactions();
-        for (const auto& mempool_tx : mempool_txs) {
-            if (mempool_tx.GetHash() == tx_hash) {
-                // Already have this transaction in mempool
-                return Result<void>::Ok();
-            }
+        if (mempool.HasTransaction(tx_hash)) {
+            // Already have this transaction in mempool
+            return Result<void>::Ok();
+        }
+
+        // Rejected or confirmed recently: not worth validating again
+        auto& recent_txs = RecentTxFilter::Instance();
+        if (recent_txs.Contains(tx_hash)) {
+            return Result<void>::Ok();
         }
 
+        Transaction tx = view.ToTransaction();
+
         // 3. Validate transaction completely using TxValidator
         // This checks: structure, signatures, inputs exist, UTXOs, amounts, fees, double-spending
         TxValidator validator(*blockchain);
         auto validate_result = validator.Validate(tx);
         if (validate_result.IsError()) {
+            // Missing inputs may just mean the parent hasn't arrived yet;
+            // anything else fails the same way until the tip changes
+            bool inputs_known = std::all_of(tx.inputs.begin(), tx.inputs.end(), [&](const TxIn& input) {
+                return blockchain->HasUTXO(OutPoint(input.prev_tx_hash, input.prev_tx_index)) ||
+                       mempool.HasTransaction(input.prev_tx_hash);
+            });
+            if (inputs_known) {
+                recent_txs.AddRejected(tx_hash);
+            }
             peer.IncreaseBanScore(20);
             return Result<void>::Error("Transaction validation failed: " + validate_result.error);
         }
@@ -1836,6 +1753,7 @@ Result<void> MessageHandler::HandleTx(Peer& peer,
         auto add_result = mempool.AddTransaction(tx);
         if (add_result.IsError()) {
             // Not a ban-worthy offense - might be policy-related
+            recent_txs.AddRejected(tx_hash);
             return Result<void>::Error("Failed to add transaction to mempool: " + add_result.error);
         }
 
@@ -1972,6 +1890,8 @@ Result<void> MessageHandler::HandleGetHeaders(Peer& peer,
 
     // Send HEADERS response
     std::vector<uint8_t> headers_payload;
+    headers_payload.reserve(3 + headers.size() * (BlockHeader::SERIALIZED_SIZE + 1));
+    VectorWriter writer(headers_payload);
 
     // Count (varint, simplified to 1-2 bytes)
     if (headers.size() < 253) {
@@ -1985,14 +1905,13 @@ Result<void> MessageHandler::HandleGetHeaders(Peer& peer,
 
     // Serialize each header
     for (const auto& header : headers) {
-        auto header_data = header.Serialize();
-        headers_payload.insert(headers_payload.end(), header_data.begin(), header_data.end());
+        header.Serialize(writer);
 
         // Add tx count (always 0 for header-only messages)
         headers_payload.push_back(0);
     }
 
-    NetworkMessage headers_msg(network::MAINNET_MAGIC, "headers", headers_payload);
+    NetworkMessage headers_msg(network::MAINNET_MAGIC, "headers", std::move(headers_payload));
     auto send_result = peer.SendMessage(headers_msg);
     if (send_result.IsError()) {
         return Result<void>::Error("Failed to send HEADERS response: " + send_result.error);
@@ -2085,27 +2004,42 @@ Result<void> MessageHandler::HandleHeaders(Peer& peer,
         }
     }
 
-    // Validate header chain (each header should connect to previous)
-    for (size_t i = 1; i < headers.size(); i++) {
-        if (headers[i].prev_block_hash != headers[i - 1].GetHash()) {
+    // Hash each header once; reused for linkage, lookups and the PoW cache
+    std::vector<uint256> header_hashes;
+    header_hashes.reserve(headers.size());
+    for (const auto& header : headers) {
+        header_hashes.push_back(header.GetHash());
+    }
+
+    // Cheap checks first: chain linkage, difficulty bits and timestamp
+    uint64_t max_timestamp = static_cast<uint64_t>(std::time(nullptr)) +
+                             consensus::MAX_FUTURE_BLOCK_TIME;
+    for (size_t i = 0; i < headers.size(); i++) {
+        if (i > 0 && headers[i].prev_block_hash != header_hashes[i - 1]) {
             peer.IncreaseBanScore(10);
             return Result<void>::Error("Headers do not form a valid chain");
         }
+        if (headers[i].bits == 0) {
+            peer.IncreaseBanScore(20);
+            return Result<void>::Error("Header has invalid difficulty bits");
+        }
+        if (headers[i].timestamp > max_timestamp) {
+            peer.IncreaseBanScore(10);
+            return Result<void>::Error("Header timestamp too far in future");
+        }
     }
 
     // Process headers - add them to the blockchain
     // In a full implementation, we would:
-    // 1. Validate each header (PoW, difficulty, timestamp)
-    // 2. Add headers to a headers-only chain
-    // 3. Request full blocks if needed
-    // 4. Continue syncing if we received max headers (2000)
+    // 1. Add headers to a headers-only chain
+    // 2. Request full blocks if needed
+    // 3. Continue syncing if we received max headers (2000)
 
-    // For now, just validate the first header connects to our chain
     if (!headers.empty()) {
         const auto& first_header = headers[0];
 
         // Check if we already have this header
-        auto existing = blockchain->GetBlockHeader(first_header.GetHash());
+        auto existing = blockchain->GetBlockHeader(header_hashes[0]);
         if (existing.IsOk()) {
             // We already have this header, likely during sync overlap
             return Result<void>::Ok();
@@ -2119,6 +2053,13 @@ Result<void> MessageHandler::HandleHeaders(Peer& peer,
             return Result<void>::Error("Header does not connect to known blockchain");
         }
 
+        // Expensive check last: RandomX PoW for the whole batch, in parallel
+        auto pow_result = RandomXValidator::ValidateHeaderBatch(headers, header_hashes);
+        if (pow_result.IsError()) {
+            peer.IncreaseBanScore(100); // Severe violation
+            return Result<void>::Error("Header PoW validation failed: " + pow_result.error);
+        }
+
         // Headers are valid and connected
         // In a full implementation, we would store these headers
         // and potentially request full blocks via GETDATA
@@ -2138,7 +2079,7 @@ Result<void> MessageHandler::HandleHeaders(Peer& peer,
             getheaders_payload.push_back(1);
 
             // Last received header hash
-            uint256 last_hash = headers.back().GetHash();
+            const uint256& last_hash = header_hashes.back();
             getheaders_payload.insert(getheaders_payload.end(),
                                      last_hash.data(), last_hash.data() + 32);
 
@@ -2218,6 +2159,63 @@ Result<void> MessageHandler::HandlePong(Peer& peer,
     return Result<void>::Ok();
 }
 
+// ============================================================================
+// RecentTxFilter Implementation
+// ============================================================================
+
+RecentTxFilter& RecentTxFilter::Instance() {
+    static RecentTxFilter instance;
+    return instance;
+}
+
+// One-in-a-million false positives: a false hit only delays a transaction
+// until another peer's announcement arrives after the next tip change
+RecentTxFilter::RecentTxFilter()
+    : rejected_(MAX_REJECTED, 0.000001),
+      confirmed_(MAX_CONFIRMED, 0.000001) {
+}
+
+bool RecentTxFilter::Contains(const uint256& txid) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rejected_.Contains(txid)) {
+        metrics::tx_recently_rejected_hits.Inc();
+        return true;
+    }
+    if (confirmed_.Contains(txid)) {
+        metrics::tx_recently_confirmed_hits.Inc();
+        return true;
+    }
+    return false;
+}
+
+void RecentTxFilter::AddRejected(const uint256& txid) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rejected_.Insert(txid);
+}
+
+void RecentTxFilter::BlockConnected(const Block& block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // A block that doesn't extend the previous tip means a reorg: some
+    // "confirmed" transactions may be unconfirmed again
+    if (tip_hash_ != uint256{} && block.header.prev_block_hash != tip_hash_) {
+        confirmed_.Reset();
+    }
+    tip_hash_ = block.GetHash();
+
+    rejected_.Reset();
+    for (const auto& tx : block.transactions) {
+        confirmed_.Insert(tx.GetHash());
+    }
+}
+
+void RecentTxFilter::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rejected_.Reset();
+    confirmed_.Reset();
+    tip_hash_ = uint256{};
+}
+
 // ============================================================================
 // PeerDiscovery Implementation
 // ============================================================================
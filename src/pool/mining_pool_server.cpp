@@ -7,6 +7,7 @@
 #include "intcoin/pool.h"
 #include "intcoin/consensus.h"
 #include "intcoin/util.h"
+#include "intcoin/codec.h"
 #include <algorithm>
 #include <cmath>
 #include <random>
@@ -1430,17 +1431,8 @@ Result<bool> MiningPoolServer::HandleSubmit(uint64_t conn_id,
     if (impl_->blockchain_ && impl_->current_work_.has_value()) {
         // Get network target from current work's bits field
         const Work& current_work = *impl_->current_work_;
-        uint256 network_target = DifficultyCalculator::CompactToTarget(current_work.header.bits);
-
-        // Compare hash with network target
-        bool is_valid_block = true;
-        for (int i = 31; i >= 0; i--) {
-            if (result_hash[i] < network_target[i]) break;
-            if (result_hash[i] > network_target[i]) {
-                is_valid_block = false;
-                break;
-            }
-        }
+        arith_uint256 network_target = DifficultyCalculator::CompactToArith(current_work.header.bits);
+        bool is_valid_block = UintToArith256(result_hash) <= network_target;
 
         if (is_valid_block) {
             share.is_block = true;
@@ -1496,10 +1488,10 @@ void MiningPoolServer::SendNotify(uint64_t conn_id, const Work& work) {
     notify.job_id = job_id_stream.str();
 
     // Convert previous block hash to hex string (reversed for Stratum)
-    notify.prev_hash.resize(64);
-    for (int i = 0; i < 32; i++) {
-        snprintf(&notify.prev_hash[i * 2], 3, "%02x", work.header.prev_block_hash[31 - i]);
-    }
+    uint256 prev_hash_reversed;
+    std::reverse_copy(work.header.prev_block_hash.begin(), work.header.prev_block_hash.end(),
+                      prev_hash_reversed.begin());
+    notify.prev_hash = codec::EncodeHex(prev_hash_reversed);
 
     // Coinbase transaction split (simplified)
     // In full implementation, this would split the coinbase at the extranonce location
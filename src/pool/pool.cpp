@@ -5,6 +5,8 @@
  */
 
 #include "intcoin/pool.h"
+#include "intcoin/arith_uint256.h"
+#include "intcoin/codec.h"
 #include "intcoin/rpc.h"
 #include "intcoin/util.h"
 #include <algorithm>
@@ -454,55 +456,20 @@ uint64_t CalculateShareDifficulty(const uint256& hash) {
     // 0x00000000FFFF0000000000000000000000000000000000000000000000000000
     //
     // This is the target for 1 difficulty share (roughly 2^32 hashes on average)
+    constexpr arith_uint256 DIFF1_TARGET = arith_uint256(0xFFFF) << 208;
 
-    // Count leading zero bits in hash
-    size_t leading_zeros = 0;
-    for (size_t i = 0; i < 32; i++) {
-        uint8_t byte = hash.data()[31 - i];  // Start from most significant byte
-        if (byte == 0) {
-            leading_zeros += 8;
-        } else {
-            // Count leading zeros in this byte
-            for (int bit = 7; bit >= 0; bit--) {
-                if ((byte & (1 << bit)) == 0) {
-                    leading_zeros++;
-                } else {
-                    break;
-                }
-            }
-            break;
-        }
-    }
-
-    // Calculate difficulty based on leading zeros
-    // Each leading zero bit roughly doubles the difficulty
-    // Base difficulty (pool difficulty 1) has ~32 leading zeros (0x00000000FFFF...)
-    //
-    // For a more accurate calculation:
-    // difficulty = 2^(leading_zeros - 32) * adjustment_factor
-    //
-    // Simplified formula: difficulty ≈ 2^(leading_zeros - 32) * 65536
-
-    if (leading_zeros < 32) {
-        // Hash doesn't meet even difficulty 1 (very unlikely in practice)
-        return 1;
+    arith_uint256 hash_value = UintToArith256(hash);
+    if (hash_value.IsZero()) {
+        return UINT64_MAX;
     }
 
-    // Calculate difficulty: 2^(leading_zeros - 32) * 65536
-    uint64_t difficulty = 65536ULL;  // Base multiplier (0xFFFF + 1)
-    size_t extra_zeros = leading_zeros - 32;
-
-    // Multiply by 2^extra_zeros (with overflow protection)
-    if (extra_zeros > 0) {
-        if (extra_zeros >= 48) {
-            // Cap at maximum uint64_t to prevent overflow
-            return UINT64_MAX;
-        }
-        difficulty <<= extra_zeros;
+    arith_uint256 difficulty = DIFF1_TARGET / hash_value;
+    if (difficulty.bits() > 64) {
+        return UINT64_MAX;
     }
 
     // Minimum difficulty of 1
-    return std::max(difficulty, static_cast<uint64_t>(1));
+    return std::max(difficulty.GetLow64(), static_cast<uint64_t>(1));
 }
 
 uint256 GenerateJobID() {
@@ -1714,16 +1681,8 @@ Result<bool> MiningPoolServer::HandleSubmit(uint64_t conn_id,
     // Check if this share is a valid block (meets network difficulty)
     if (impl_->blockchain_ && impl_->current_work_.has_value()) {
         const Work& current_work = *impl_->current_work_;
-        uint256 network_target = DifficultyCalculator::CompactToTarget(current_work.header.bits);
-
-        bool is_valid_block = true;
-        for (int i = 31; i >= 0; i--) {
-            if (result_hash[i] < network_target[i]) break;
-            if (result_hash[i] > network_target[i]) {
-                is_valid_block = false;
-                break;
-            }
-        }
+        arith_uint256 network_target = DifficultyCalculator::CompactToArith(current_work.header.bits);
+        bool is_valid_block = UintToArith256(result_hash) <= network_target;
 
         if (is_valid_block) {
             share.is_block = true;
@@ -1770,15 +1729,25 @@ void MiningPoolServer::SendNotify(uint64_t conn_id, const Work& work) {
     notify.job_id = job_id_stream.str();
 
     // Convert previous block hash to hex string (reversed for Stratum)
-    notify.prev_hash.resize(64);
-    for (int i = 0; i < 32; i++) {
-        snprintf(&notify.prev_hash[i * 2], 3, "%02x", work.header.prev_block_hash[31 - i]);
-    }
+    uint256 prev_hash_reversed;
+    std::reverse_copy(work.header.prev_block_hash.begin(), work.header.prev_block_hash.end(),
+                      prev_hash_reversed.begin());
+    notify.prev_hash = codec::EncodeHex(prev_hash_reversed);
 
     // Coinbase transaction split (simplified)
     notify.coinbase1 = "";
     notify.coinbase2 = "";
-    notify.merkle_branches = {};
+
+    // Coinbase merkle branch (transactions[0] is the coinbase; txids are
+    // cached on the work's transactions, so this is just the tree walk)
+    std::vector<uint256> tx_hashes;
+    tx_hashes.reserve(work.transactions.size() + 1);
+    for (const auto& tx : work.transactions) {
+        tx_hashes.push_back(tx.GetHash());
+    }
+    for (const auto& sibling : GetMerkleBranch(std::move(tx_hashes), 0)) {
+        notify.merkle_branches.push_back(codec::EncodeHex(sibling));
+    }
 
     // Block version (4 bytes, hex)
     std::ostringstream version_stream;
@@ -6,6 +6,8 @@
 
 #include "intcoin/pool.h"
 #include "intcoin/util.h"
+#include "intcoin/codec.h"
+#include <algorithm>
 #include <thread>
 #include <map>
 #include <iostream>
@@ -80,35 +82,23 @@ Result<std::vector<uint8_t>> HexToBytes(const std::string& hex) {
     }
 
     std::vector<uint8_t> bytes;
-    for (size_t i = 0; i < hex.length(); i += 2) {
-        std::string byte_str = hex.substr(i, 2);
-        try {
-            bytes.push_back(static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16)));
-        } catch (const std::exception& e) {
-            return Result<std::vector<uint8_t>>::Error("Invalid hex character");
-        }
+    if (!codec::DecodeHex(hex, bytes)) {
+        return Result<std::vector<uint8_t>>::Error("Invalid hex character");
     }
 
-    return Result<std::vector<uint8_t>>::Ok(bytes);
+    return Result<std::vector<uint8_t>>::Ok(std::move(bytes));
 }
 
 // Convert uint256 to hex with endian control
 std::string ToHex(const uint256& data, bool little_endian = false) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    if (little_endian) {
-        // Reverse byte order
-        for (int i = 31; i >= 0; i--) {
-            ss << std::setw(2) << static_cast<int>(data[i]);
-        }
-    } else {
-        for (size_t i = 0; i < 32; i++) {
-            ss << std::setw(2) << static_cast<int>(data[i]);
-        }
+    if (!little_endian) {
+        return codec::EncodeHex(data);
     }
 
-    return ss.str();
+    // Reverse byte order
+    uint256 reversed;
+    std::reverse_copy(data.begin(), data.end(), reversed.begin());
+    return codec::EncodeHex(reversed);
 }
 
 // Convert uint32 to hex (8 characters)
@@ -120,12 +110,7 @@ std::string ToHex(uint32_t value) {
 
 // Convert byte vector to hex
 std::string ToHex(const std::vector<uint8_t>& data) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (uint8_t byte : data) {
-        ss << std::setw(2) << static_cast<int>(byte);
-    }
-    return ss.str();
+    return codec::EncodeHex(data);
 }
 
 // Simple JSON parser for Stratum messages
@@ -939,23 +924,10 @@ private:
                 tx_hashes.push_back(tx.GetHash());
             }
 
-            // Build merkle tree
-            auto merkle_tree = BuildMerkleTree(tx_hashes);
-
-            // Extract merkle branches (the sibling hashes needed to verify)
-            // For Stratum, we need the branches to reconstruct merkle root
-            size_t tree_size = merkle_tree.size();
-            size_t height = 0;
-            size_t current_size = tx_hashes.size();
-
-            while (current_size > 1) {
-                // Get the sibling hash for this level
-                size_t sibling_index = (height % 2 == 0) ? height + 1 : height - 1;
-                if (sibling_index < tree_size) {
-                    merkle_branch.push_back(ToHex(merkle_tree[sibling_index]));
-                }
-                current_size = (current_size + 1) / 2;
-                height = (height + current_size);
+            // The coinbase's branch: the sibling hashes the miner combines
+            // with its coinbase hash to reconstruct the merkle root
+            for (const auto& sibling : GetMerkleBranch(std::move(tx_hashes), 0)) {
+                merkle_branch.push_back(ToHex(sibling));
             }
         }
 
@@ -2,6 +2,7 @@
 // Distributed under the MIT software license
 
 #include <intcoin/privacy/stealth_addresses.h>
+#include <intcoin/codec.h>
 #include <mutex>
 #include <random>
 #include <algorithm>
@@ -81,19 +82,14 @@ StealthAddressManager::StealthKeyPair StealthAddressManager::GenerateStealthAddr
 std::string StealthAddressManager::EncodeAddress(const StealthAddress& address, const std::string& hrp) const {
     // TODO: Implement Bech32 encoding
     // For now, return hex representation
-    std::string encoded = hrp + "1";
-
-    auto to_hex = [](uint8_t byte) -> std::string {
-        const char* hex = "0123456789abcdef";
-        return std::string{hex[byte >> 4], hex[byte & 0xF]};
-    };
-
-    for (auto byte : address.view_public_key) {
-        encoded += to_hex(byte);
-    }
-    for (auto byte : address.spend_public_key) {
-        encoded += to_hex(byte);
-    }
+    const size_t view_len = codec::HexEncodedSize(address.view_public_key.size());
+    const size_t spend_len = codec::HexEncodedSize(address.spend_public_key.size());
+    std::string encoded(hrp.size() + 1 + view_len + spend_len, '\0');
+
+    char* out = std::copy(hrp.begin(), hrp.end(), encoded.data());
+    *out++ = '1';
+    out = codec::HexToChars(out, out + view_len, address.view_public_key).ptr;
+    codec::HexToChars(out, out + spend_len, address.spend_public_key);
 
     return encoded;
 }
@@ -99,6 +99,7 @@ int main(int argc, char *argv[]) {
             if (startResult.IsOk() && blockchain) {
                 // Register blockchain callbacks for P2P relay
                 blockchain->RegisterBlockCallback([p2p_ptr = p2p.get()](const intcoin::Block& block) {
+                    intcoin::RecentTxFilter::Instance().BlockConnected(block);
                     p2p_ptr->BroadcastBlock(block.GetHash());
                 });
                 blockchain->RegisterTransactionCallback([p2p_ptr = p2p.get()](const intcoin::Transaction& tx) {
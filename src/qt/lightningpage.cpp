@@ -703,8 +703,7 @@ void LightningPage::updateNodeInfo() {
     auto stats = lightning_->GetStats();
 
     nodeIdLabel_->setText(tr("Running"));
-    nodePubKeyLabel_->setText(QString::fromStdString(BytesToHex(std::vector<uint8_t>(
-        nodeId.begin(), nodeId.end()))));
+    nodePubKeyLabel_->setText(QString::fromStdString(BytesToHex(nodeId)));
     nodeAddressLabel_->setText(tr("127.0.0.1")); // TODO: Get actual address
     nodePortLabel_->setText(tr("2213"));
 
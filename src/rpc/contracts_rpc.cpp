@@ -7,8 +7,8 @@
 #include "intcoin/contracts/storage.h"
 #include "intcoin/contracts/transaction.h"
 #include "intcoin/crypto.h"
-#include <sstream>
-#include <iomanip>
+#include "intcoin/codec.h"
+#include <stdexcept>
 
 namespace intcoin {
 namespace rpc {
@@ -18,31 +18,28 @@ namespace rpc {
 //
 
 static std::vector<uint8_t> HexToBytes(const std::string& hex) {
-    std::vector<uint8_t> bytes;
-    std::string hex_str = hex;
+    std::string_view hex_str = hex;
 
     // Remove 0x prefix if present
-    if (hex_str.length() >= 2 && hex_str.substr(0, 2) == "0x") {
-        hex_str = hex_str.substr(2);
+    if (hex_str.substr(0, 2) == "0x") {
+        hex_str.remove_prefix(2);
     }
 
-    for (size_t i = 0; i < hex_str.length(); i += 2) {
-        if (i + 1 >= hex_str.length()) break;
-        std::string byte_str = hex_str.substr(i, 2);
-        uint8_t byte = static_cast<uint8_t>(std::stoi(byte_str, nullptr, 16));
-        bytes.push_back(byte);
+    // A trailing odd digit is ignored
+    std::vector<uint8_t> bytes;
+    if (!codec::DecodeHex(hex_str.substr(0, hex_str.size() & ~size_t{1}), bytes)) {
+        throw std::invalid_argument("Invalid hex string");
     }
 
     return bytes;
 }
 
 static std::string BytesToHex(const std::vector<uint8_t>& bytes) {
-    std::stringstream ss;
-    ss << "0x";
-    for (uint8_t byte : bytes) {
-        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
-    }
-    return ss.str();
+    std::string hex(2 + codec::HexEncodedSize(bytes.size()), '\0');
+    hex[0] = '0';
+    hex[1] = 'x';
+    codec::HexToChars(hex.data() + 2, hex.data() + hex.size(), bytes);
+    return hex;
 }
 
 [[maybe_unused]] static std::vector<std::string> JSONArrayToStringVector(const JSONValue& arr) {
@@ -5,8 +5,6 @@
 #include <intcoin/rpc.h>
 #include <intcoin/util.h>
 
-#include <sstream>
-#include <iomanip>
 
 namespace intcoin {
 namespace rpc {
@@ -16,35 +14,6 @@ using namespace htlc;
 // Global HTLC manager (should be part of blockchain state in production)
 static HTLCManager g_htlc_manager;
 
-// Helper: Convert bytes to hex string
-static std::string BytesToHex(const std::vector<uint8_t>& bytes) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (uint8_t byte : bytes) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    return oss.str();
-}
-
-// Helper: Convert hex string to bytes
-static Result<std::vector<uint8_t>> HexToBytes(const std::string& hex) {
-    if (hex.length() % 2 != 0) {
-        return Result<std::vector<uint8_t>>::Error("Hex string must have even length");
-    }
-
-    std::vector<uint8_t> bytes;
-    for (size_t i = 0; i < hex.length(); i += 2) {
-        std::string byte_str = hex.substr(i, 2);
-        try {
-            uint8_t byte = static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16));
-            bytes.push_back(byte);
-        } catch (...) {
-            return Result<std::vector<uint8_t>>::Error("Invalid hex string");
-        }
-    }
-    return Result<std::vector<uint8_t>>::Ok(bytes);
-}
-
 // HTLC RPC Methods
 class HTLCRPC {
 public:
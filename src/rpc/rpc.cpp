@@ -693,6 +693,14 @@ void BlockchainRPC::RegisterMethods(RPCServer& server, Blockchain& blockchain) {
         [&blockchain](const JSONValue& params) { return getrawmempool(params, blockchain); }
     });
 
+    server.RegisterMethod({
+        "getmempoolfeehistogram",
+        "Returns the mempool feerate histogram (count, size and fees per bucket)",
+        {},
+        false,
+        [&blockchain](const JSONValue&) { return getmempoolfeehistogram({}, blockchain); }
+    });
+
     server.RegisterMethod({
         "getblockstats",
         "Returns statistics for a given block",
@@ -791,6 +799,32 @@ JSONValue BlockchainRPC::getmempoolinfo(const JSONValue&, Blockchain& blockchain
     return JSONValue(info);
 }
 
+JSONValue BlockchainRPC::getmempoolfeehistogram(const JSONValue&, Blockchain& blockchain) {
+    FeeHistogram histogram = blockchain.GetMempool().GetFeeHistogram();
+    const auto& buckets = histogram.GetBuckets();
+
+    // Non-empty buckets, highest feerate first
+    std::vector<JSONValue> result_buckets;
+    for (size_t i = FeeHistogram::NUM_BUCKETS; i-- > 0;) {
+        if (buckets[i].count == 0) continue;
+
+        std::map<std::string, JSONValue> bucket;
+        bucket["feerate"] = JSONValue(static_cast<int64_t>(FeeHistogram::BUCKET_MIN_FEE_RATES[i]));
+        bucket["count"] = JSONValue(static_cast<int64_t>(buckets[i].count));
+        bucket["size"] = JSONValue(static_cast<int64_t>(buckets[i].size_bytes));
+        bucket["fees"] = JSONValue(static_cast<int64_t>(buckets[i].fees));
+        result_buckets.push_back(JSONValue(bucket));
+    }
+
+    std::map<std::string, JSONValue> result;
+    result["count"] = JSONValue(static_cast<int64_t>(histogram.GetCount()));
+    result["size"] = JSONValue(static_cast<int64_t>(histogram.GetSizeBytes()));
+    result["fees"] = JSONValue(static_cast<int64_t>(histogram.GetFees()));
+    result["buckets"] = JSONValue(result_buckets);
+
+    return JSONValue(result);
+}
+
 JSONValue BlockchainRPC::getrawmempool(const JSONValue& params, Blockchain& blockchain) {
     auto& mempool = blockchain.GetMempool();
     bool verbose = false;
@@ -2227,8 +2261,7 @@ JSONValue LightningRPC::lightning_listchannels(const JSONValue&, LightningNetwor
     for (const auto& channel : channels) {
         std::map<std::string, JSONValue> channel_info;
         channel_info["channel_id"] = JSONValue(Uint256ToHex(channel.channel_id));
-        channel_info["remote_node"] = JSONValue(BytesToHex(std::vector<uint8_t>(channel.remote_node_id.begin(),
-                                                                                 channel.remote_node_id.end())));
+        channel_info["remote_node"] = JSONValue(BytesToHex(channel.remote_node_id));
         channel_info["capacity"] = JSONValue(static_cast<int64_t>(channel.capacity));
         channel_info["local_balance"] = JSONValue(static_cast<int64_t>(channel.local_balance));
         channel_info["remote_balance"] = JSONValue(static_cast<int64_t>(channel.remote_balance));
@@ -2244,8 +2277,7 @@ JSONValue LightningRPC::lightning_listchannels(const JSONValue&, LightningNetwor
 JSONValue LightningRPC::lightning_getnodeinfo(const JSONValue&, LightningNetwork& lightning) {
     std::map<std::string, JSONValue> info;
 
-    info["node_id"] = JSONValue(BytesToHex(std::vector<uint8_t>(lightning.GetNodeId().begin(),
-                                                                lightning.GetNodeId().end())));
+    info["node_id"] = JSONValue(BytesToHex(lightning.GetNodeId()));
     info["alias"] = JSONValue(lightning.GetNodeAlias());
     info["running"] = JSONValue(lightning.IsRunning());
 
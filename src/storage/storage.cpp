@@ -4,6 +4,7 @@
  */
 
 #include "intcoin/storage.h"
+#include "intcoin/compressor.h"
 #include "intcoin/util.h"
 #include "intcoin/crypto.h"
 #include <rocksdb/db.h>
@@ -20,112 +21,98 @@
 
 namespace intcoin {
 
-// ============================================================================
-// ChainState Serialization
-// ============================================================================
-
-std::vector<uint8_t> ChainState::Serialize() const {
-    std::vector<uint8_t> result;
-    SerializeUint256(result, best_block_hash);
-    SerializeUint64(result, best_height);
-    SerializeUint256(result, chain_work);
-    SerializeUint64(result, total_transactions);
-    SerializeUint64(result, utxo_count);
-    SerializeUint64(result, total_supply);
-    return result;
-}
+namespace {
 
-Result<ChainState> ChainState::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
-    ChainState state;
+/// Appends serialized bytes to a std::string (RocksDB keys)
+class StringWriter {
+public:
+    explicit StringWriter(std::string& out) : out_(out) {}
 
-    // Deserialize best_block_hash (32 bytes)
-    auto hash_result = DeserializeUint256(data, pos);
-    if (hash_result.IsError()) {
-        return Result<ChainState>::Error("Failed to deserialize best_block_hash: " + hash_result.error);
+    StringWriter& Write(const uint8_t* data, size_t len) {
+        out_.append(reinterpret_cast<const char*>(data), len);
+        return *this;
     }
-    state.best_block_hash = *hash_result.value;
 
-    // Deserialize best_height (8 bytes)
-    auto height_result = DeserializeUint64(data, pos);
-    if (height_result.IsError()) {
-        return Result<ChainState>::Error("Failed to deserialize best_height: " + height_result.error);
-    }
-    state.best_height = *height_result.value;
+private:
+    std::string& out_;
+};
 
-    // Deserialize chain_work (32 bytes)
-    auto work_result = DeserializeUint256(data, pos);
-    if (work_result.IsError()) {
-        return Result<ChainState>::Error("Failed to deserialize chain_work: " + work_result.error);
+/// Decode a record with an Unserialize(Stream&) member straight from a
+/// byte range (e.g. a RocksDB value), without copying it into a vector first
+template <typename T>
+Result<T> DecodeRecord(const uint8_t* data, size_t size) {
+    SpanReader reader(data, size);
+    T record;
+    auto result = record.Unserialize(reader);
+    if (result.IsError()) {
+        return Result<T>::Error(result.error);
     }
-    state.chain_work = *work_result.value;
+    return Result<T>::Ok(std::move(record));
+}
 
-    // Deserialize total_transactions (8 bytes)
-    auto tx_count_result = DeserializeUint64(data, pos);
-    if (tx_count_result.IsError()) {
-        return Result<ChainState>::Error("Failed to deserialize total_transactions: " + tx_count_result.error);
-    }
-    state.total_transactions = *tx_count_result.value;
+template <typename T>
+Result<T> DecodeRecord(const std::string& value) {
+    return DecodeRecord<T>(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+}
 
-    // Deserialize utxo_count (8 bytes)
-    auto utxo_result = DeserializeUint64(data, pos);
-    if (utxo_result.IsError()) {
-        return Result<ChainState>::Error("Failed to deserialize utxo_count: " + utxo_result.error);
+/// Decode a record in the compact storage encoding (UnserializeCompact)
+template <typename T>
+Result<T> DecodeCompactRecord(const uint8_t* data, size_t size) {
+    SpanReader reader(data, size);
+    T record;
+    auto result = UnserializeCompact(reader, record);
+    if (result.IsError()) {
+        return Result<T>::Error(result.error);
     }
-    state.utxo_count = *utxo_result.value;
+    return Result<T>::Ok(std::move(record));
+}
 
-    // Deserialize total_supply (8 bytes)
-    auto supply_result = DeserializeUint64(data, pos);
-    if (supply_result.IsError()) {
-        return Result<ChainState>::Error("Failed to deserialize total_supply: " + supply_result.error);
-    }
-    state.total_supply = *supply_result.value;
+/// Undo entry in the compact encoding: compact outpoint, compact output
+template <typename Stream>
+void SerializeCompact(Stream& s, const SpentOutput& spent) {
+    SerializeCompact(s, spent.outpoint);
+    SerializeCompact(s, spent.output);
+}
 
-    return Result<ChainState>::Ok(std::move(state));
+template <typename Stream>
+Result<void> UnserializeCompact(Stream& s, SpentOutput& spent) {
+    auto outpoint_result = UnserializeCompact(s, spent.outpoint);
+    if (outpoint_result.IsError()) {
+        return Result<void>::Error("Failed to deserialize outpoint: " + outpoint_result.error);
+    }
+    auto output_result = UnserializeCompact(s, spent.output);
+    if (output_result.IsError()) {
+        return Result<void>::Error("Failed to deserialize output: " + output_result.error);
+    }
+    return Result<void>::Ok();
 }
 
+constexpr size_t MIN_COMPACT_SPENT_OUTPUT_SIZE = 32 + 1 + MIN_COMPACT_TXOUT_SIZE;
+
+} // namespace
+
 // ============================================================================
-// SpentOutput Serialization
+// ChainState Serialization
 // ============================================================================
 
-std::vector<uint8_t> SpentOutput::Serialize() const {
-    std::vector<uint8_t> result;
+std::vector<uint8_t> ChainState::Serialize() const {
+    return SerializeToVector(*this);
+}
 
-    // Serialize outpoint
-    auto outpoint_data = outpoint.Serialize();
-    result.insert(result.end(), outpoint_data.begin(), outpoint_data.end());
+Result<ChainState> ChainState::Deserialize(const std::vector<uint8_t>& data) {
+    return DecodeRecord<ChainState>(data.data(), data.size());
+}
 
-    // Serialize output
-    auto output_data = output.Serialize();
-    result.insert(result.end(), output_data.begin(), output_data.end());
+// ============================================================================
+// SpentOutput Serialization
+// ============================================================================
 
-    return result;
+std::vector<uint8_t> SpentOutput::Serialize() const {
+    return SerializeToVector(*this);
 }
 
 Result<SpentOutput> SpentOutput::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
-    SpentOutput spent;
-
-    // Deserialize outpoint
-    std::vector<uint8_t> outpoint_data(data.begin(), data.end());
-    auto outpoint_result = OutPoint::Deserialize(outpoint_data);
-    if (outpoint_result.IsError()) {
-        return Result<SpentOutput>::Error("Failed to deserialize outpoint: " +
-                                         outpoint_result.error);
-    }
-    spent.outpoint = *outpoint_result.value;
-    pos += outpoint_result.value->Serialize().size();
-
-    // Deserialize output
-    std::vector<uint8_t> output_data(data.begin() + pos, data.end());
-    auto output_result = TxOut::Deserialize(output_data);
-    if (output_result.IsError()) {
-        return Result<SpentOutput>::Error("Failed to deserialize output: " +
-                                         output_result.error);
-    }
-    spent.output = *output_result.value;
-
-    return Result<SpentOutput>::Ok(std::move(spent));
+    return DecodeRecord<SpentOutput>(data.data(), data.size());
 }
 
 // ============================================================================
@@ -133,87 +120,11 @@ Result<SpentOutput> SpentOutput::Deserialize(const std::vector<uint8_t>& data) {
 // ============================================================================
 
 std::vector<uint8_t> BlockIndex::Serialize() const {
-    std::vector<uint8_t> result;
-    SerializeUint256(result, hash);
-    SerializeUint64(result, height);
-    SerializeUint256(result, prev_hash);
-    SerializeUint64(result, timestamp);
-    SerializeUint32(result, bits);
-    SerializeUint256(result, chain_work);
-    SerializeUint32(result, tx_count);
-    SerializeUint32(result, size);
-    SerializeUint64(result, file_pos);
-    return result;
+    return SerializeToVector(*this);
 }
 
 Result<BlockIndex> BlockIndex::Deserialize(const std::vector<uint8_t>& data) {
-    size_t pos = 0;
-    BlockIndex index;
-
-    // Deserialize hash (32 bytes)
-    auto hash_result = DeserializeUint256(data, pos);
-    if (hash_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize hash: " + hash_result.error);
-    }
-    index.hash = *hash_result.value;
-
-    // Deserialize height (8 bytes)
-    auto height_result = DeserializeUint64(data, pos);
-    if (height_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize height: " + height_result.error);
-    }
-    index.height = *height_result.value;
-
-    // Deserialize prev_hash (32 bytes)
-    auto prev_result = DeserializeUint256(data, pos);
-    if (prev_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize prev_hash: " + prev_result.error);
-    }
-    index.prev_hash = *prev_result.value;
-
-    // Deserialize timestamp (8 bytes)
-    auto time_result = DeserializeUint64(data, pos);
-    if (time_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize timestamp: " + time_result.error);
-    }
-    index.timestamp = *time_result.value;
-
-    // Deserialize bits (4 bytes)
-    auto bits_result = DeserializeUint32(data, pos);
-    if (bits_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize bits: " + bits_result.error);
-    }
-    index.bits = *bits_result.value;
-
-    // Deserialize chain_work (32 bytes)
-    auto work_result = DeserializeUint256(data, pos);
-    if (work_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize chain_work: " + work_result.error);
-    }
-    index.chain_work = *work_result.value;
-
-    // Deserialize tx_count (4 bytes)
-    auto tx_result = DeserializeUint32(data, pos);
-    if (tx_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize tx_count: " + tx_result.error);
-    }
-    index.tx_count = *tx_result.value;
-
-    // Deserialize size (4 bytes)
-    auto size_result = DeserializeUint32(data, pos);
-    if (size_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize size: " + size_result.error);
-    }
-    index.size = *size_result.value;
-
-    // Deserialize file_pos (8 bytes)
-    auto pos_result = DeserializeUint64(data, pos);
-    if (pos_result.IsError()) {
-        return Result<BlockIndex>::Error("Failed to deserialize file_pos: " + pos_result.error);
-    }
-    index.file_pos = *pos_result.value;
-
-    return Result<BlockIndex>::Ok(std::move(index));
+    return DecodeRecord<BlockIndex>(data.data(), data.size());
 }
 
 // ============================================================================
@@ -229,6 +140,7 @@ public:
     bool in_batch_;
     bool pruning_enabled_;
     uint64_t pruning_target_size_;
+    uint32_t storage_version_;
 
     Impl(const std::string& data_dir)
         : db_(nullptr)
@@ -238,6 +150,7 @@ public:
         , in_batch_(false)
         , pruning_enabled_(false)
         , pruning_target_size_(0)
+        , storage_version_(db::STORAGE_VERSION_COMPACT)
     {}
 
     ~Impl() {
@@ -270,9 +183,10 @@ public:
 
     std::string MakeKey(char prefix, const OutPoint& outpoint) const {
         std::string key;
+        key.reserve(1 + OutPoint::SERIALIZED_SIZE);
         key.push_back(prefix);
-        auto serialized = outpoint.Serialize();
-        key.append(reinterpret_cast<const char*>(serialized.data()), serialized.size());
+        StringWriter writer(key);
+        outpoint.Serialize(writer);
         return key;
     }
 
@@ -280,6 +194,65 @@ public:
         return std::string(1, prefix);
     }
 
+    bool IsCompact() const {
+        return storage_version_ == db::STORAGE_VERSION_COMPACT;
+    }
+
+    // Helper: Encode a block, transaction or UTXO value in this database's format
+    template <typename T>
+    std::vector<uint8_t> EncodeRecord(const T& record) const {
+        if (!IsCompact()) {
+            return SerializeToVector(record);
+        }
+        return SerializeExact([&record](auto& s) { SerializeCompact(s, record); });
+    }
+
+    // Helper: Decode a value written by EncodeRecord()
+    template <typename T>
+    Result<T> DecodeStoredRecord(const uint8_t* data, size_t size) const {
+        return IsCompact() ? DecodeCompactRecord<T>(data, size) : DecodeRecord<T>(data, size);
+    }
+
+    template <typename T>
+    Result<T> DecodeStoredRecord(const std::string& value) const {
+        return DecodeStoredRecord<T>(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+    }
+
+    // Helper: Read the storage format version, or record one for a database
+    // that has none. Empty databases get the compact format; databases with
+    // records predating versioning are marked legacy and keep their encoding.
+    Result<void> LoadStorageVersion() {
+        std::string key = MakeKey(db::PREFIX_DB_VERSION);
+        std::string value;
+        rocksdb::Status status = Get(key, value);
+
+        if (status.ok()) {
+            SpanReader reader(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+            uint32_t version = 0;
+            if (!UnserializeUint32(reader, version) ||
+                version < db::STORAGE_VERSION_LEGACY || version > db::STORAGE_VERSION_COMPACT) {
+                return Result<void>::Error("Unsupported storage format version");
+            }
+            storage_version_ = version;
+            return Result<void>::Ok();
+        }
+        if (!status.IsNotFound()) {
+            return Result<void>::Error("Failed to read storage version: " + status.ToString());
+        }
+
+        std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(rocksdb::ReadOptions()));
+        it->SeekToFirst();
+        storage_version_ = it->Valid() ? db::STORAGE_VERSION_LEGACY : db::STORAGE_VERSION_COMPACT;
+
+        std::vector<uint8_t> data;
+        SerializeUint32(data, storage_version_);
+        status = Put(key, data);
+        if (!status.ok()) {
+            return Result<void>::Error("Failed to store storage version: " + status.ToString());
+        }
+        return Result<void>::Ok();
+    }
+
     // Helper: Put data
     rocksdb::Status Put(const std::string& key, const std::vector<uint8_t>& value) {
         rocksdb::Slice key_slice(key);
@@ -355,6 +328,13 @@ Result<void> BlockchainDB::Open() {
         return Result<void>::Error("Failed to open database: " + status.ToString());
     }
 
+    auto version_result = impl_->LoadStorageVersion();
+    if (version_result.IsError()) {
+        delete impl_->db_;
+        impl_->db_ = nullptr;
+        return version_result;
+    }
+
     impl_->is_open_ = true;
     return Result<void>::Ok();
 }
@@ -384,6 +364,11 @@ std::string BlockchainDB::GetDataDir() const {
     return impl_->data_dir_;
 }
 
+// Get storage format version
+uint32_t BlockchainDB::GetStorageVersion() const {
+    return impl_->storage_version_;
+}
+
 // ============================================================================
 // Block Operations
 // ============================================================================
@@ -394,7 +379,7 @@ Result<void> BlockchainDB::StoreBlock(const Block& block) {
     }
 
     // Serialize block
-    auto serialized = block.Serialize();
+    auto serialized = impl_->EncodeRecord(block);
 
     // Store block data
     std::string key = impl_->MakeKey(db::PREFIX_BLOCK, block.GetHash());
@@ -421,8 +406,7 @@ Result<Block> BlockchainDB::GetBlock(const uint256& hash) const {
     }
 
     // Deserialize block
-    std::vector<uint8_t> data(value.begin(), value.end());
-    return Block::Deserialize(data);
+    return impl_->DecodeStoredRecord<Block>(value);
 }
 
 Result<Block> BlockchainDB::GetBlockByHeight(uint64_t height) const {
@@ -498,8 +482,7 @@ Result<BlockIndex> BlockchainDB::GetBlockIndex(const uint256& hash) const {
         return Result<BlockIndex>::Error("Block index not found");
     }
 
-    std::vector<uint8_t> data(value.begin(), value.end());
-    return BlockIndex::Deserialize(data);
+    return DecodeRecord<BlockIndex>(value);
 }
 
 Result<uint256> BlockchainDB::GetBlockHash(uint64_t height) const {
@@ -547,7 +530,7 @@ Result<void> BlockchainDB::StoreTransaction(const Transaction& tx) {
         return Result<void>::Error("Database not open");
     }
 
-    auto serialized = tx.Serialize();
+    auto serialized = impl_->EncodeRecord(tx);
     std::string key = impl_->MakeKey(db::PREFIX_TX, tx.GetHash());
     rocksdb::Status status = impl_->Put(key, serialized);
 
@@ -571,8 +554,7 @@ Result<Transaction> BlockchainDB::GetTransaction(const uint256& hash) const {
         return Result<Transaction>::Error("Transaction not found");
     }
 
-    std::vector<uint8_t> data(value.begin(), value.end());
-    return Transaction::Deserialize(data);
+    return impl_->DecodeStoredRecord<Transaction>(value);
 }
 
 bool BlockchainDB::HasTransaction(const uint256& hash) const {
@@ -613,7 +595,7 @@ Result<void> BlockchainDB::StoreUTXO(const OutPoint& outpoint, const TxOut& outp
         return Result<void>::Error("Database not open");
     }
 
-    auto serialized = output.Serialize();
+    auto serialized = impl_->EncodeRecord(output);
     std::string key = impl_->MakeKey(db::PREFIX_UTXO, outpoint);
     rocksdb::Status status = impl_->Put(key, serialized);
 
@@ -637,8 +619,7 @@ Result<TxOut> BlockchainDB::GetUTXO(const OutPoint& outpoint) const {
         return Result<TxOut>::Error("UTXO not found");
     }
 
-    std::vector<uint8_t> data(value.begin(), value.end());
-    return TxOut::Deserialize(data);
+    return impl_->DecodeStoredRecord<TxOut>(value);
 }
 
 bool BlockchainDB::HasUTXO(const OutPoint& outpoint) const {
@@ -702,8 +683,8 @@ Result<std::vector<std::pair<OutPoint, TxOut>>> BlockchainDB::GetAllUTXOs(size_t
         }
 
         // Parse OutPoint from key (skip prefix byte)
-        std::vector<uint8_t> key_data(key_str.begin() + 1, key_str.end());
-        auto outpoint_result = OutPoint::Deserialize(key_data);
+        auto outpoint_result = DecodeRecord<OutPoint>(
+            reinterpret_cast<const uint8_t*>(key_str.data()) + 1, key_str.size() - 1);
         if (outpoint_result.IsError()) {
             it->Next();
             continue;  // Skip invalid entries
@@ -711,9 +692,8 @@ Result<std::vector<std::pair<OutPoint, TxOut>>> BlockchainDB::GetAllUTXOs(size_t
 
         // Parse TxOut from value
         rocksdb::Slice value_slice = it->value();
-        std::vector<uint8_t> value_data(value_slice.data(),
-                                        value_slice.data() + value_slice.size());
-        auto txout_result = TxOut::Deserialize(value_data);
+        auto txout_result = impl_->DecodeStoredRecord<TxOut>(
+            reinterpret_cast<const uint8_t*>(value_slice.data()), value_slice.size());
         if (txout_result.IsError()) {
             it->Next();
             continue;  // Skip invalid entries
@@ -753,22 +733,26 @@ Result<void> BlockchainDB::StoreSpentOutputs(const uint256& block_hash,
     key.push_back(db::PREFIX_SPENT_OUTPUTS);
     key.append(reinterpret_cast<const char*>(block_hash.data()), block_hash.size());
 
-    // Serialize vector of spent outputs
-    std::vector<uint8_t> value_data;
-
-    // Serialize count
-    SerializeUint64(value_data, static_cast<uint64_t>(spent_outputs.size()));
-
-    // Serialize each spent output
-    for (const SpentOutput& spent : spent_outputs) {
-        auto spent_data = spent.Serialize();
-        value_data.insert(value_data.end(), spent_data.begin(), spent_data.end());
-    }
+    // Serialize count + each spent output into one exactly-sized buffer
+    const bool compact = impl_->IsCompact();
+    auto value_data = SerializeExact([&spent_outputs, compact](auto& s) {
+        if (compact) {
+            SerializeVarInt(s, spent_outputs.size());
+            for (const SpentOutput& spent : spent_outputs) {
+                SerializeCompact(s, spent);
+            }
+        } else {
+            SerializeUint64(s, static_cast<uint64_t>(spent_outputs.size()));
+            for (const SpentOutput& spent : spent_outputs) {
+                spent.Serialize(s);
+            }
+        }
+    });
 
     // Write to database
     rocksdb::WriteOptions write_options;
-    std::string value_str(value_data.begin(), value_data.end());
-    rocksdb::Status status = impl_->db_->Put(write_options, key, value_str);
+    rocksdb::Slice value_slice(reinterpret_cast<const char*>(value_data.data()), value_data.size());
+    rocksdb::Status status = impl_->db_->Put(write_options, key, value_slice);
 
     if (!status.ok()) {
         return Result<void>::Error("Failed to store spent outputs: " +
@@ -802,31 +786,29 @@ Result<std::vector<SpentOutput>> BlockchainDB::GetSpentOutputs(const uint256& bl
                                                        status.ToString());
     }
 
-    // Deserialize vector of spent outputs
-    std::vector<uint8_t> value_data(value_str.begin(), value_str.end());
-    size_t pos = 0;
+    // Deserialize vector of spent outputs (read in place, one pass)
+    SpanReader reader(reinterpret_cast<const uint8_t*>(value_str.data()), value_str.size());
 
     // Deserialize count
-    auto count_result = DeserializeUint64(value_data, pos);
-    if (count_result.IsError()) {
-        return Result<std::vector<SpentOutput>>::Error("Failed to deserialize count: " +
-                                                       count_result.error);
+    const bool compact = impl_->IsCompact();
+    uint64_t count = 0;
+    if (!(compact ? UnserializeVarInt(reader, count) : UnserializeUint64(reader, count))) {
+        return Result<std::vector<SpentOutput>>::Error(
+            "Failed to deserialize count: Buffer underflow: not enough bytes for count");
     }
-    uint64_t count = *count_result.value;
 
     // Deserialize each spent output
     std::vector<SpentOutput> spent_outputs;
-    spent_outputs.reserve(count);
+    spent_outputs.reserve(BoundedReserve(reader, count,
+        compact ? MIN_COMPACT_SPENT_OUTPUT_SIZE : OutPoint::SERIALIZED_SIZE + Transaction::MIN_TXOUT_SIZE));
 
     for (uint64_t i = 0; i < count; i++) {
-        std::vector<uint8_t> spent_data(value_data.begin() + pos, value_data.end());
-        auto spent_result = SpentOutput::Deserialize(spent_data);
+        SpentOutput& spent = spent_outputs.emplace_back();
+        auto spent_result = compact ? UnserializeCompact(reader, spent) : spent.Unserialize(reader);
         if (spent_result.IsError()) {
             return Result<std::vector<SpentOutput>>::Error("Failed to deserialize spent output: " +
                                                            spent_result.error);
         }
-        spent_outputs.push_back(*spent_result.value);
-        pos += spent_result.value->Serialize().size();
     }
 
     return Result<std::vector<SpentOutput>>::Ok(std::move(spent_outputs));
@@ -893,8 +875,7 @@ Result<ChainState> BlockchainDB::GetChainState() const {
         return Result<ChainState>::Ok(state);
     }
 
-    std::vector<uint8_t> data(value.begin(), value.end());
-    return ChainState::Deserialize(data);
+    return DecodeRecord<ChainState>(value);
 }
 
 Result<void> BlockchainDB::UpdateBestBlock(const uint256& hash, uint64_t height) {
@@ -1517,6 +1498,7 @@ public:
     std::unordered_map<OutPoint, uint256, OutPointHash> outpoint_to_tx;
     mutable std::mutex mutex;
     size_t total_size = 0;
+    FeeHistogram fee_histogram;
 
     static constexpr size_t MAX_MEMPOOL_SIZE = 100 * 1024 * 1024; // 100 MB
 };
@@ -1559,6 +1541,7 @@ Result<void> Mempool::AddTransaction(const Transaction& tx) {
     // Add to mempool
     MempoolEntry entry(tx, fee);
     impl_->total_size += entry.size;
+    impl_->fee_histogram.Add(entry.fee, entry.size);
     impl_->transactions[tx_hash] = entry;
 
     // Track outpoints
@@ -1579,6 +1562,7 @@ void Mempool::RemoveTransaction(const uint256& tx_hash) {
     }
 
     impl_->total_size -= it->second.size;
+    impl_->fee_histogram.Remove(it->second.fee, it->second.size);
 
     for (const auto& input : it->second.tx.inputs) {
         OutPoint outpoint(input.prev_tx_hash, input.prev_tx_index);
@@ -1654,6 +1638,7 @@ void Mempool::RemoveBlockTransactions(const Block& block) {
         }
 
         impl_->total_size -= it->second.size;
+        impl_->fee_histogram.Remove(it->second.fee, it->second.size);
 
         for (const auto& input : it->second.tx.inputs) {
             OutPoint outpoint(input.prev_tx_hash, input.prev_tx_index);
@@ -1680,11 +1665,17 @@ uint64_t Mempool::GetTotalFees() const {
     return total;
 }
 
+FeeHistogram Mempool::GetFeeHistogram() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->fee_histogram;
+}
+
 void Mempool::Clear() {
     std::lock_guard<std::mutex> lock(impl_->mutex);
     impl_->transactions.clear();
     impl_->outpoint_to_tx.clear();
     impl_->total_size = 0;
+    impl_->fee_histogram.Clear();
 }
 
 void Mempool::LimitSize(size_t max_size) {
@@ -1714,6 +1705,7 @@ void Mempool::LimitSize(size_t max_size) {
         }
 
         impl_->total_size -= entry.size;
+        impl_->fee_histogram.Remove(entry.fee, entry.size);
 
         for (const auto& input : entry.tx.inputs) {
             OutPoint outpoint(input.prev_tx_hash, input.prev_tx_index);
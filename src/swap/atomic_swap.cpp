@@ -78,7 +78,7 @@ Result<SwapOffer> AtomicSwapCoordinator::CreateSwapOffer(
     swaps_[offer.swap_id] = swap_info;
 
     LogF(LogLevel::INFO, "Atomic Swap: Created offer %s (%llu %s for %llu %s)",
-         BytesToHex(std::vector<uint8_t>(offer.swap_id.begin(), offer.swap_id.end())).substr(0, 16).c_str(),
+         BytesToHex(offer.swap_id).substr(0, 16).c_str(),
          initiator_amount,
          GetChainName(initiator_chain).c_str(),
          participant_amount,
@@ -125,7 +125,7 @@ Result<SwapOffer> AtomicSwapCoordinator::AcceptSwapOffer(
     swaps_[offer.swap_id] = swap_info;
 
     LogF(LogLevel::INFO, "Atomic Swap: Accepted offer %s",
-         BytesToHex(std::vector<uint8_t>(offer.swap_id.begin(), offer.swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(offer.swap_id).substr(0, 16).c_str());
 
     TriggerEvent(SwapEventType::OFFER_ACCEPTED, offer.swap_id,
                 SwapState::OFFER_ACCEPTED, "Swap offer accepted");
@@ -151,7 +151,7 @@ Result<void> AtomicSwapCoordinator::CancelSwap(const uint256& swap_id) {
     UpdateSwapState(swap_id, SwapState::CANCELLED);
 
     LogF(LogLevel::INFO, "Atomic Swap: Cancelled swap %s",
-         BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(swap_id).substr(0, 16).c_str());
 
     return Result<void>::Ok();
 }
@@ -182,7 +182,7 @@ Result<void> AtomicSwapCoordinator::StartSwapExecution(const uint256& swap_id) {
     }
 
     LogF(LogLevel::INFO, "Atomic Swap: Started execution for swap %s",
-         BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(swap_id).substr(0, 16).c_str());
 
     return Result<void>::Ok();
 }
@@ -235,7 +235,7 @@ Result<Transaction> AtomicSwapCoordinator::CreateInitiatorHTLC(
     UpdateSwapState(swap_id, SwapState::INITIATOR_HTLC_FUNDED);
 
     LogF(LogLevel::INFO, "Atomic Swap: Created initiator HTLC for swap %s",
-         BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(swap_id).substr(0, 16).c_str());
 
     return Result<Transaction>::Ok(tx);
 }
@@ -293,7 +293,7 @@ Result<Transaction> AtomicSwapCoordinator::CreateParticipantHTLC(
     UpdateSwapState(swap_id, SwapState::PARTICIPANT_HTLC_FUNDED);
 
     LogF(LogLevel::INFO, "Atomic Swap: Created participant HTLC for swap %s",
-         BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(swap_id).substr(0, 16).c_str());
 
     return Result<Transaction>::Ok(tx);
 }
@@ -369,7 +369,7 @@ Result<Transaction> AtomicSwapCoordinator::ClaimHTLC(
 
     LogF(LogLevel::INFO, "Atomic Swap: %s claimed HTLC for swap %s",
          is_initiator ? "Initiator" : "Participant",
-         BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(swap_id).substr(0, 16).c_str());
 
     return Result<Transaction>::Ok(tx);
 }
@@ -424,7 +424,7 @@ Result<Transaction> AtomicSwapCoordinator::RefundHTLC(
     UpdateSwapState(swap_id, SwapState::REFUNDED);
 
     LogF(LogLevel::INFO, "Atomic Swap: Refunded HTLC for swap %s",
-         BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str());
+         BytesToHex(swap_id).substr(0, 16).c_str());
 
     TriggerEvent(SwapEventType::SWAP_REFUNDED, swap_id,
                 SwapState::REFUNDED, "Swap refunded after timeout");
@@ -660,7 +660,7 @@ void AtomicSwapCoordinator::UpdateSwapState(const uint256& swap_id, SwapState ne
         it->second.updated_at = std::time(nullptr);
 
         LogF(LogLevel::INFO, "Atomic Swap: Updated state for swap %s to %s",
-             BytesToHex(std::vector<uint8_t>(swap_id.begin(), swap_id.end())).substr(0, 16).c_str(),
+             BytesToHex(swap_id).substr(0, 16).c_str(),
              GetStateName(new_state).c_str());
     }
 }
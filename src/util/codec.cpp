@@ -0,0 +1,617 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+#include "intcoin/codec.h"
+#include <array>
+#include <cstring>
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace intcoin {
+namespace codec {
+
+namespace {
+
+// ============================================================================
+// Lookup Tables
+// ============================================================================
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+constexpr char BASE58_ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+constexpr char BECH32_CHARSET[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+/// Two hex characters for every byte value ("00" .. "ff")
+constexpr std::array<char, 512> MakeHexPairs() {
+    std::array<char, 512> pairs{};
+    for (int i = 0; i < 256; ++i) {
+        pairs[2 * i] = HEX_DIGITS[i >> 4];
+        pairs[2 * i + 1] = HEX_DIGITS[i & 0x0F];
+    }
+    return pairs;
+}
+
+/// Value of every character in an alphabet (case-insensitive if asked), -1 if absent
+constexpr std::array<int8_t, 256> MakeReverseTable(const char* alphabet, bool fold_case) {
+    std::array<int8_t, 256> values{};
+    values.fill(-1);
+    for (int i = 0; alphabet[i] != '\0'; ++i) {
+        const char c = alphabet[i];
+        values[static_cast<uint8_t>(c)] = static_cast<int8_t>(i);
+        if (fold_case && c >= 'a' && c <= 'z') {
+            values[static_cast<uint8_t>(c - 'a' + 'A')] = static_cast<int8_t>(i);
+        }
+    }
+    return values;
+}
+
+constexpr auto HEX_PAIRS = MakeHexPairs();
+constexpr auto HEX_VALUES = MakeReverseTable(HEX_DIGITS, true);
+constexpr auto BASE58_VALUES = MakeReverseTable(BASE58_ALPHABET, false);
+constexpr auto BECH32_VALUES = MakeReverseTable(BECH32_CHARSET, true);
+
+/// Checksum feedback for the five bits shifted out of a Bech32 polymod step
+constexpr std::array<uint32_t, 32> MakeBech32Feedback() {
+    constexpr uint32_t GENERATOR[5] = {0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3};
+    std::array<uint32_t, 32> table{};
+    for (uint32_t top = 0; top < 32; ++top) {
+        for (int i = 0; i < 5; ++i) {
+            if ((top >> i) & 1) {
+                table[top] ^= GENERATOR[i];
+            }
+        }
+    }
+    return table;
+}
+
+constexpr auto BECH32_FEEDBACK = MakeBech32Feedback();
+
+std::to_chars_result TooLarge(char* last) {
+    return {last, std::errc::value_too_large};
+}
+
+/// Limb scratch space: on the stack for typical inputs, heap beyond that
+class LimbBuffer {
+public:
+    explicit LimbBuffer(size_t size) {
+        if (size > INLINE_LIMBS) {
+            heap_.resize(size);
+            data_ = heap_.data();
+        }
+    }
+
+    LimbBuffer(const LimbBuffer&) = delete;
+    LimbBuffer& operator=(const LimbBuffer&) = delete;
+
+    uint32_t& operator[](size_t i) { return data_[i]; }
+
+private:
+    static constexpr size_t INLINE_LIMBS = 64;
+    uint32_t inline_[INLINE_LIMBS];
+    std::vector<uint32_t> heap_;
+    uint32_t* data_ = inline_;
+};
+
+// ============================================================================
+// Hex Kernels
+// ============================================================================
+
+void EncodeHexUnchecked(const uint8_t* data, size_t len, char* out) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    {
+        const __m256i lut = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                             '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+                                             '0', '1', '2', '3', '4', '5', '6', '7',
+                                             '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+        const __m256i mask = _mm256_set1_epi8(0x0F);
+        for (; i + 32 <= len; i += 32) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+            const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(in, mask));
+            // Unpacks work per 128-bit lane: a = bytes 0-7 | 16-23, b = 8-15 | 24-31
+            const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+            const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i),
+                                _mm256_permute2x128_si256(a, b, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32),
+                                _mm256_permute2x128_si256(a, b, 0x31));
+        }
+    }
+#endif
+#if defined(__SSSE3__)
+    {
+        const __m128i lut = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                          '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+        const __m128i mask = _mm_set1_epi8(0x0F);
+        for (; i + 16 <= len; i += 16) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+            const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(in, mask));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+        }
+    }
+#endif
+    for (; i < len; ++i) {
+        std::memcpy(out + 2 * i, &HEX_PAIRS[2 * data[i]], 2);
+    }
+}
+
+#if defined(__AVX2__)
+/// Value (0-15) of each of 32 hex digits; lanes holding a non-digit are set in bad
+__m256i HexDigitValues(__m256i c, __m256i& bad) {
+    const __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)),
+                                           _mm256_set1_epi8('a'));
+    const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+    bad = _mm256_or_si256(bad, _mm256_xor_si256(_mm256_or_si256(is_digit, is_letter),
+                                                _mm256_set1_epi8(-1)));
+    return _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                           _mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+}
+#endif
+
+#if defined(__SSSE3__)
+/// Value (0-15) of each of 16 hex digits; lanes holding a non-digit are set in bad
+__m128i HexDigitValues(__m128i c, __m128i& bad) {
+    const __m128i digit = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i letter = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    bad = _mm_or_si128(bad, _mm_xor_si128(_mm_or_si128(is_digit, is_letter), _mm_set1_epi8(-1)));
+    return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                        _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+#endif
+
+/// Decode len bytes from 2 * len digits; invalid digits are only reported
+/// at the end, so the loops have no data-dependent branches
+bool DecodeHexUnchecked(const char* hex, size_t len, uint8_t* out) {
+    size_t i = 0;
+    bool valid = true;
+#if defined(__AVX2__)
+    {
+        // (hi, lo) digit pairs -> hi * 16 + lo in each 16-bit lane
+        const __m256i weights = _mm256_set1_epi16(0x0110);
+        __m256i bad = _mm256_setzero_si256();
+        for (; i + 32 <= len; i += 32) {
+            const char* in = hex + 2 * i;
+            const __m256i a = HexDigitValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)), bad);
+            const __m256i b = HexDigitValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 32)), bad);
+            // packus interleaves the lanes: a0 b0 a1 b1 -> a0 a1 b0 b1
+            const __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights),
+                                                       _mm256_maddubs_epi16(b, weights));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                _mm256_permute4x64_epi64(packed, 0xD8));
+        }
+        valid &= _mm256_testz_si256(bad, bad) != 0;
+    }
+#endif
+#if defined(__SSSE3__)
+    {
+        const __m128i weights = _mm_set1_epi16(0x0110);
+        __m128i bad = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16) {
+            const char* in = hex + 2 * i;
+            const __m128i a = HexDigitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), bad);
+            const __m128i b = HexDigitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16)), bad);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                             _mm_packus_epi16(_mm_maddubs_epi16(a, weights),
+                                              _mm_maddubs_epi16(b, weights)));
+        }
+        valid &= _mm_movemask_epi8(bad) == 0;
+    }
+#endif
+    int invalid = 0;
+    for (; i < len; ++i) {
+        const int hi = HEX_VALUES[static_cast<uint8_t>(hex[2 * i])];
+        const int lo = HEX_VALUES[static_cast<uint8_t>(hex[2 * i + 1])];
+        invalid |= hi | lo;
+        out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return valid && invalid >= 0;
+}
+
+// ============================================================================
+// Bech32 Checksum
+// ============================================================================
+
+uint32_t PolymodStep(uint32_t chk, uint8_t value) {
+    return ((chk & 0x1ffffff) << 5) ^ value ^ BECH32_FEEDBACK[chk >> 25];
+}
+
+/// Checksum state after the expanded human-readable part
+uint32_t HrpPolymod(std::string_view hrp) {
+    uint32_t chk = 1;
+    for (char c : hrp) {
+        chk = PolymodStep(chk, static_cast<uint8_t>(c) >> 5);
+    }
+    chk = PolymodStep(chk, 0);
+    for (char c : hrp) {
+        chk = PolymodStep(chk, static_cast<uint8_t>(c) & 31);
+    }
+    return chk;
+}
+
+/// Append the six checksum characters for chk (state after the data words)
+char* WriteBech32Checksum(uint32_t chk, char* out) {
+    for (int i = 0; i < 6; ++i) {
+        chk = PolymodStep(chk, 0);
+    }
+    chk ^= 1;
+    for (int i = 0; i < 6; ++i) {
+        *out++ = BECH32_CHARSET[(chk >> (5 * (5 - i))) & 31];
+    }
+    return out;
+}
+
+} // namespace
+
+// ============================================================================
+// Hex
+// ============================================================================
+
+std::to_chars_result HexToChars(char* first, char* last, std::span<const uint8_t> data) {
+    const size_t needed = HexEncodedSize(data.size());
+    if (static_cast<size_t>(last - first) < needed) {
+        return TooLarge(last);
+    }
+    EncodeHexUnchecked(data.data(), data.size(), first);
+    return {first + needed, std::errc{}};
+}
+
+std::string EncodeHex(std::span<const uint8_t> data) {
+    std::string out(HexEncodedSize(data.size()), '\0');
+    EncodeHexUnchecked(data.data(), data.size(), out.data());
+    return out;
+}
+
+bool DecodeHex(std::string_view hex, std::span<uint8_t> out) {
+    if (hex.size() != HexEncodedSize(out.size())) {
+        return false;
+    }
+    return DecodeHexUnchecked(hex.data(), out.size(), out.data());
+}
+
+bool DecodeHex(std::string_view hex, std::vector<uint8_t>& out) {
+    if (hex.size() % 2 != 0) {
+        return false;
+    }
+    out.resize(hex.size() / 2);
+    return DecodeHexUnchecked(hex.data(), out.size(), out.data());
+}
+
+size_t FindInvalidHex(std::string_view hex) {
+    for (size_t i = 0; i < hex.size(); ++i) {
+        if (HEX_VALUES[static_cast<uint8_t>(hex[i])] < 0) {
+            return i;
+        }
+    }
+    return hex.size();
+}
+
+// ============================================================================
+// Base58
+// ============================================================================
+//
+// Base conversion with 32-bit limbs: encoding holds the number in base 58^5
+// and feeds it four input bytes per pass, decoding holds it in base 2^32 and
+// feeds it five digits per pass, so the quadratic inner loop runs about 20x
+// fewer times than converting one byte / digit at a time.
+
+namespace {
+constexpr uint32_t BASE58_POW5 = 58 * 58 * 58 * 58 * 58;  // 656,356,768 < 2^30
+}
+
+std::to_chars_result Base58ToChars(char* first, char* last, std::span<const uint8_t> data) {
+    size_t zeros = 0;
+    while (zeros < data.size() && data[zeros] == 0) {
+        ++zeros;
+    }
+
+    const size_t rest = data.size() - zeros;
+    LimbBuffer limbs(Base58MaxEncodedSize(rest) / 5 + 2);
+    size_t count = 0;
+
+    // Feed the input most significant first, in chunks of up to four bytes
+    size_t pos = zeros;
+    size_t chunk = rest % 4 == 0 ? 4 : rest % 4;
+    while (pos < data.size()) {
+        uint64_t carry = 0;
+        for (size_t k = 0; k < chunk; ++k) {
+            carry = (carry << 8) | data[pos + k];
+        }
+        const uint64_t multiplier = uint64_t{1} << (8 * chunk);
+        for (size_t j = 0; j < count; ++j) {
+            const uint64_t x = limbs[j] * multiplier + carry;
+            limbs[j] = static_cast<uint32_t>(x % BASE58_POW5);
+            carry = x / BASE58_POW5;
+        }
+        while (carry != 0) {
+            limbs[count++] = static_cast<uint32_t>(carry % BASE58_POW5);
+            carry /= BASE58_POW5;
+        }
+        pos += chunk;
+        chunk = 4;
+    }
+
+    // Digits in the top limb, without its leading zeros
+    size_t top_digits = 0;
+    if (count > 0) {
+        for (uint32_t v = limbs[count - 1]; v != 0; v /= 58) {
+            ++top_digits;
+        }
+    }
+    const size_t digits = count == 0 ? 0 : (count - 1) * 5 + top_digits;
+    if (static_cast<size_t>(last - first) < zeros + digits) {
+        return TooLarge(last);
+    }
+
+    char* out = first;
+    std::memset(out, '1', zeros);
+    out += zeros;
+    char* end = out + digits;
+
+    // Write least significant digits first, from the end backwards
+    char* p = end;
+    for (size_t j = 0; j < count; ++j) {
+        uint32_t v = limbs[j];
+        const size_t n = (j + 1 == count) ? top_digits : 5;
+        for (size_t k = 0; k < n; ++k) {
+            *--p = BASE58_ALPHABET[v % 58];
+            v /= 58;
+        }
+    }
+    return {end, std::errc{}};
+}
+
+std::string EncodeBase58(std::span<const uint8_t> data) {
+    std::string out(Base58MaxEncodedSize(data.size()), '\0');
+    auto [end, ec] = Base58ToChars(out.data(), out.data() + out.size(), data);
+    out.resize(ec == std::errc{} ? static_cast<size_t>(end - out.data()) : 0);
+    return out;
+}
+
+bool DecodeBase58(std::string_view encoded, std::vector<uint8_t>& out) {
+    size_t ones = 0;
+    while (ones < encoded.size() && encoded[ones] == '1') {
+        ++ones;
+    }
+
+    const size_t rest = encoded.size() - ones;
+    LimbBuffer limbs((rest * 733 / 1000 + 1) / 4 + 2);
+    size_t count = 0;
+
+    // Feed the digits most significant first, in chunks of up to five
+    size_t pos = ones;
+    size_t chunk = rest % 5 == 0 ? 5 : rest % 5;
+    while (pos < encoded.size()) {
+        uint64_t carry = 0;
+        uint64_t multiplier = 1;
+        for (size_t k = 0; k < chunk; ++k) {
+            const int v = BASE58_VALUES[static_cast<uint8_t>(encoded[pos + k])];
+            if (v < 0) {
+                return false;
+            }
+            carry = carry * 58 + static_cast<uint64_t>(v);
+            multiplier *= 58;
+        }
+        for (size_t j = 0; j < count; ++j) {
+            const uint64_t x = limbs[j] * multiplier + carry;
+            limbs[j] = static_cast<uint32_t>(x);
+            carry = x >> 32;
+        }
+        while (carry != 0) {
+            limbs[count++] = static_cast<uint32_t>(carry);
+            carry >>= 32;
+        }
+        pos += chunk;
+        chunk = 5;
+    }
+
+    // Bytes in the top limb, without its leading zeros
+    size_t top_bytes = 0;
+    if (count > 0) {
+        for (uint32_t v = limbs[count - 1]; v != 0; v >>= 8) {
+            ++top_bytes;
+        }
+    }
+    const size_t bytes = count == 0 ? 0 : (count - 1) * 4 + top_bytes;
+
+    out.assign(ones + bytes, 0);
+    uint8_t* p = out.data() + out.size();
+    for (size_t j = 0; j < count; ++j) {
+        uint32_t v = limbs[j];
+        const size_t n = (j + 1 == count) ? top_bytes : 4;
+        for (size_t k = 0; k < n; ++k) {
+            *--p = static_cast<uint8_t>(v);
+            v >>= 8;
+        }
+    }
+    return true;
+}
+
+size_t FindInvalidBase58(std::string_view encoded) {
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        if (BASE58_VALUES[static_cast<uint8_t>(encoded[i])] < 0) {
+            return i;
+        }
+    }
+    return encoded.size();
+}
+
+// ============================================================================
+// Bech32
+// ============================================================================
+
+std::to_chars_result Bech32WordsToChars(char* first, char* last, std::string_view hrp,
+                                        std::span<const uint8_t> words) {
+    const size_t needed = hrp.size() + 1 + words.size() + 6;
+    if (static_cast<size_t>(last - first) < needed) {
+        return TooLarge(last);
+    }
+
+    char* out = first;
+    std::memcpy(out, hrp.data(), hrp.size());
+    out += hrp.size();
+    *out++ = '1';
+
+    uint32_t chk = HrpPolymod(hrp);
+    for (uint8_t word : words) {
+        if (word >= 32) {
+            return {last, std::errc::invalid_argument};
+        }
+        *out++ = BECH32_CHARSET[word];
+        chk = PolymodStep(chk, word);
+    }
+    return {WriteBech32Checksum(chk, out), std::errc{}};
+}
+
+std::to_chars_result Bech32ToChars(char* first, char* last, std::string_view hrp,
+                                   std::span<const uint8_t> data) {
+    const size_t needed = Bech32EncodedSize(hrp.size(), data.size());
+    if (static_cast<size_t>(last - first) < needed) {
+        return TooLarge(last);
+    }
+
+    char* out = first;
+    std::memcpy(out, hrp.data(), hrp.size());
+    out += hrp.size();
+    *out++ = '1';
+
+    // Regroup bytes into 5-bit words as they are written
+    uint32_t chk = HrpPolymod(hrp);
+    uint32_t acc = 0;
+    int bits = 0;
+    for (uint8_t byte : data) {
+        acc = (acc << 8) | byte;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            const uint8_t word = (acc >> bits) & 31;
+            *out++ = BECH32_CHARSET[word];
+            chk = PolymodStep(chk, word);
+        }
+    }
+    if (bits > 0) {
+        const uint8_t word = (acc << (5 - bits)) & 31;
+        *out++ = BECH32_CHARSET[word];
+        chk = PolymodStep(chk, word);
+    }
+    return {WriteBech32Checksum(chk, out), std::errc{}};
+}
+
+std::string EncodeBech32Words(std::string_view hrp, std::span<const uint8_t> words) {
+    std::string out(hrp.size() + 1 + words.size() + 6, '\0');
+    auto [end, ec] = Bech32WordsToChars(out.data(), out.data() + out.size(), hrp, words);
+    if (ec != std::errc{}) {
+        return "";
+    }
+    return out;
+}
+
+std::string EncodeBech32(std::string_view hrp, std::span<const uint8_t> data) {
+    std::string out(Bech32EncodedSize(hrp.size(), data.size()), '\0');
+    Bech32ToChars(out.data(), out.data() + out.size(), hrp, data);
+    return out;
+}
+
+Result<void> DecodeBech32Words(std::string_view encoded, std::string& hrp,
+                               std::vector<uint8_t>& words) {
+    bool has_lower = false;
+    bool has_upper = false;
+    for (char c : encoded) {
+        has_lower |= (c >= 'a' && c <= 'z');
+        has_upper |= (c >= 'A' && c <= 'Z');
+    }
+    if (has_lower && has_upper) {
+        return Result<void>::Error("Mixed case in Bech32 string");
+    }
+
+    const size_t sep = encoded.rfind('1');
+    if (sep == std::string_view::npos || sep == 0) {
+        return Result<void>::Error("No separator found in Bech32 string");
+    }
+    const size_t data_len = encoded.size() - sep - 1;
+    if (data_len < 6) {
+        return Result<void>::Error("Bech32 string too short");
+    }
+
+    hrp.assign(encoded.data(), sep);
+    for (char& c : hrp) {
+        if (c < 33 || c > 126) {
+            return Result<void>::Error("Invalid character in Bech32 string");
+        }
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+
+    uint32_t chk = HrpPolymod(hrp);
+    words.clear();
+    words.reserve(data_len - 6);
+    for (size_t i = 0; i < data_len; ++i) {
+        const int v = BECH32_VALUES[static_cast<uint8_t>(encoded[sep + 1 + i])];
+        if (v < 0) {
+            return Result<void>::Error("Invalid character in Bech32 string");
+        }
+        chk = PolymodStep(chk, static_cast<uint8_t>(v));
+        if (i < data_len - 6) {
+            words.push_back(static_cast<uint8_t>(v));
+        }
+    }
+    if (chk != 1) {
+        return Result<void>::Error("Invalid checksum");
+    }
+    return Result<void>::Ok();
+}
+
+Result<void> DecodeBech32(std::string_view encoded, std::string& hrp,
+                          std::vector<uint8_t>& data) {
+    std::vector<uint8_t> words;
+    auto result = DecodeBech32Words(encoded, hrp, words);
+    if (result.IsError()) {
+        return result;
+    }
+    data.clear();
+    data.reserve(words.size() * 5 / 8);
+    if (!ConvertBits(words, 5, 8, false, data)) {
+        return Result<void>::Error("Invalid padding in Bech32 data");
+    }
+    return Result<void>::Ok();
+}
+
+bool ConvertBits(std::span<const uint8_t> in, int frombits, int tobits, bool pad,
+                 std::vector<uint8_t>& out) {
+    uint32_t acc = 0;
+    int bits = 0;
+    const uint32_t maxv = (1u << tobits) - 1;
+    const uint32_t max_acc = (1u << (frombits + tobits - 1)) - 1;
+
+    for (uint8_t value : in) {
+        if ((value >> frombits) != 0) {
+            return false;
+        }
+        acc = ((acc << frombits) | value) & max_acc;
+        bits += frombits;
+        while (bits >= tobits) {
+            bits -= tobits;
+            out.push_back(static_cast<uint8_t>((acc >> bits) & maxv));
+        }
+    }
+
+    if (pad) {
+        if (bits > 0) {
+            out.push_back(static_cast<uint8_t>((acc << (tobits - bits)) & maxv));
+        }
+    } else if (bits >= frombits || ((acc << (tobits - bits)) & maxv) != 0) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace codec
+} // namespace intcoin
@@ -4,9 +4,8 @@
  */
 
 #include "intcoin/types.h"
+#include "intcoin/codec.h"
 #include <cstring>
-#include <sstream>
-#include <iomanip>
 
 namespace intcoin {
 
@@ -15,34 +14,16 @@ namespace intcoin {
 // ============================================================================
 
 std::string ToHex(const uint256& hash) {
-    std::stringstream ss;
     // Output in natural byte order (big-endian, matching standard hex representations)
-    for (size_t i = 0; i < 32; ++i) {
-        ss << std::hex << std::setw(2) << std::setfill('0')
-           << static_cast<int>(hash[i]);
-    }
-    return ss.str();
+    return codec::EncodeHex(hash);
 }
 
 std::optional<uint256> FromHex(const std::string& hex) {
-    if (hex.length() != 64) {
-        return std::nullopt;
-    }
-
     uint256 result{};
 
     // Parse hex string (big-endian format, matching ToHex output)
-    for (size_t i = 0; i < 32; ++i) {
-        std::string byte_str = hex.substr(i * 2, 2);
-        char* end;
-        long value = std::strtol(byte_str.c_str(), &end, 16);
-
-        if (end != byte_str.c_str() + 2) {
-            return std::nullopt; // Invalid hex character
-        }
-
-        // Store in natural byte order
-        result[i] = static_cast<uint8_t>(value);
+    if (!codec::DecodeHex(hex, result)) {
+        return std::nullopt;
     }
 
     return result;
@@ -4,6 +4,7 @@
  */
 
 #include "intcoin/util.h"
+#include "intcoin/codec.h"
 #include "intcoin/crypto.h"
 #include "intcoin/consensus.h"
 #include <sstream>
@@ -24,13 +25,8 @@ namespace intcoin {
 // String Utilities
 // ============================================================================
 
-std::string BytesToHex(const std::vector<uint8_t>& bytes) {
-    std::stringstream ss;
-    for (auto byte : bytes) {
-        ss << std::hex << std::setw(2) << std::setfill('0')
-           << static_cast<int>(byte);
-    }
-    return ss.str();
+std::string BytesToHex(std::span<const uint8_t> bytes) {
+    return codec::EncodeHex(bytes);
 }
 
 Result<std::vector<uint8_t>> HexToBytes(const std::string& hex) {
@@ -40,23 +36,10 @@ Result<std::vector<uint8_t>> HexToBytes(const std::string& hex) {
     }
 
     std::vector<uint8_t> bytes;
-    bytes.reserve(hex.length() / 2);
-
-    for (size_t i = 0; i < hex.length(); i += 2) {
-        // Get two hex characters
-        std::string byte_str = hex.substr(i, 2);
-
-        // Convert to byte
-        char* end;
-        long value = std::strtol(byte_str.c_str(), &end, 16);
-
-        // Check for conversion errors
-        if (end != byte_str.c_str() + 2) {
-            return Result<std::vector<uint8_t>>::Error(
-                "Invalid hex character at position " + std::to_string(i));
-        }
-
-        bytes.push_back(static_cast<uint8_t>(value));
+    if (!codec::DecodeHex(hex, bytes)) {
+        const size_t pos = codec::FindInvalidHex(hex);
+        return Result<std::vector<uint8_t>>::Error(
+            "Invalid hex character at position " + std::to_string(pos - pos % 2));
     }
 
     return Result<std::vector<uint8_t>>::Ok(std::move(bytes));
@@ -68,9 +51,9 @@ std::string Uint256ToHex(const uint256& hash) {
 
 Result<uint256> HexToUint256(const std::string& hex) {
     // Remove 0x prefix if present
-    std::string hex_str = hex;
-    if (hex_str.length() >= 2 && hex_str.substr(0, 2) == "0x") {
-        hex_str = hex_str.substr(2);
+    std::string_view hex_str = hex;
+    if (hex_str.substr(0, 2) == "0x") {
+        hex_str.remove_prefix(2);
     }
 
     // Validate hex string length (uint256 = 32 bytes = 64 hex chars)
@@ -78,18 +61,10 @@ Result<uint256> HexToUint256(const std::string& hex) {
         return Result<uint256>::Error("Invalid hex string length: expected 64 characters, got " + std::to_string(hex_str.length()));
     }
 
-    // Validate hex characters
-    for (char c : hex_str) {
-        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
-            return Result<uint256>::Error(std::string("Invalid hex character: ") + c);
-        }
-    }
-
-    // Convert hex string to bytes
     uint256 result;
-    for (size_t i = 0; i < 32; ++i) {
-        std::string byte_str = hex_str.substr(i * 2, 2);
-        result.data()[i] = static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16));
+    if (!codec::DecodeHex(hex_str, result)) {
+        return Result<uint256>::Error(std::string("Invalid hex character: ") +
+                                      hex_str[codec::FindInvalidHex(hex_str)]);
     }
 
     return Result<uint256>::Ok(result);
@@ -302,105 +277,17 @@ Result<std::vector<uint8_t>> Base64Decode(const std::string& encoded) {
 // Base58 Encoding/Decoding
 // ============================================================================
 
-// Base58 alphabet (Bitcoin-style)
-static const char* base58_chars = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-
 std::string Base58Encode(const std::vector<uint8_t>& data) {
-    // Count leading zeros
-    size_t leading_zeros = 0;
-    for (size_t i = 0; i < data.size() && data[i] == 0; i++) {
-        leading_zeros++;
-    }
-
-    // Allocate enough space in big-endian base58 representation
-    size_t size = data.size() * 138 / 100 + 1; // log(256) / log(58), rounded up
-    std::vector<uint8_t> b58(size);
-
-    // Process the bytes
-    for (size_t i = 0; i < data.size(); i++) {
-        int carry = data[i];
-        // Apply "b58 = b58 * 256 + ch"
-        for (size_t j = size; j > 0; j--) {
-            carry += 256 * b58[j - 1];
-            b58[j - 1] = carry % 58;
-            carry /= 58;
-        }
-    }
-
-    // Skip leading zeros in base58 result
-    size_t start_idx = 0;
-    while (start_idx < size && b58[start_idx] == 0) {
-        start_idx++;
-    }
-
-    // Translate to base58 characters
-    std::string result;
-    result.reserve(leading_zeros + (size - start_idx));
-
-    // Add '1' for each leading zero byte
-    for (size_t i = 0; i < leading_zeros; i++) {
-        result += '1';
-    }
-
-    // Add base58 encoded characters
-    for (size_t i = start_idx; i < size; i++) {
-        result += base58_chars[b58[i]];
-    }
-
-    return result;
+    return codec::EncodeBase58(data);
 }
 
 Result<std::vector<uint8_t>> Base58Decode(const std::string& encoded) {
-    // Count leading '1's
-    size_t leading_ones = 0;
-    for (size_t i = 0; i < encoded.size() && encoded[i] == '1'; i++) {
-        leading_ones++;
-    }
-
-    // Allocate enough space
-    size_t size = encoded.size() * 733 / 1000 + 1; // log(58) / log(256), rounded up
-    std::vector<uint8_t> b256(size);
-
-    // Process the characters
-    for (size_t i = 0; i < encoded.size(); i++) {
-        // Find character in base58 alphabet
-        const char* ch = strchr(base58_chars, encoded[i]);
-        if (ch == nullptr) {
-            return Result<std::vector<uint8_t>>::Error(
-                std::string("Invalid base58 character: ") + encoded[i]);
-        }
-
-        int carry = static_cast<int>(ch - base58_chars);
-
-        // Apply "b256 = b256 * 58 + carry"
-        for (size_t j = size; j > 0; j--) {
-            carry += 58 * b256[j - 1];
-            b256[j - 1] = carry % 256;
-            carry /= 256;
-        }
-    }
-
-    // Skip leading zeros in result
-    size_t start_idx = 0;
-    while (start_idx < size && b256[start_idx] == 0) {
-        start_idx++;
-    }
-
-    // Construct result with leading zeros
     std::vector<uint8_t> result;
-    result.reserve(leading_ones + (size - start_idx));
-
-    // Add zero bytes for leading '1's
-    for (size_t i = 0; i < leading_ones; i++) {
-        result.push_back(0);
-    }
-
-    // Add remaining bytes
-    for (size_t i = start_idx; i < size; i++) {
-        result.push_back(b256[i]);
+    if (!codec::DecodeBase58(encoded, result)) {
+        return Result<std::vector<uint8_t>>::Error(
+            std::string("Invalid base58 character: ") + encoded[codec::FindInvalidBase58(encoded)]);
     }
-
-    return Result<std::vector<uint8_t>>::Ok(result);
+    return Result<std::vector<uint8_t>>::Ok(std::move(result));
 }
 
 std::string Base58CheckEncode(const std::vector<uint8_t>& data) {
@@ -855,109 +742,17 @@ uint256 DoubleSHA3_256(const std::vector<uint8_t>& data) {
 // Bech32 Encoding
 // ============================================================================
 
-namespace {
-    const char* BECH32_CHARSET = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
-
-    uint32_t Bech32Polymod(const std::vector<uint8_t>& values) {
-        uint32_t c = 1;
-        for (uint8_t v : values) {
-            uint8_t c0 = c >> 25;
-            c = ((c & 0x1ffffff) << 5) ^ v;
-            if (c0 & 1) c ^= 0x3b6a57b2;
-            if (c0 & 2) c ^= 0x26508e6d;
-            if (c0 & 4) c ^= 0x1ea119fa;
-            if (c0 & 8) c ^= 0x3d4233dd;
-            if (c0 & 16) c ^= 0x2a1462b3;
-        }
-        return c;
-    }
-
-    std::vector<uint8_t> ExpandHRP(const std::string& hrp) {
-        std::vector<uint8_t> result;
-        result.reserve(hrp.size() * 2 + 1);
-        for (char c : hrp) {
-            result.push_back(c >> 5);
-        }
-        result.push_back(0);
-        for (char c : hrp) {
-            result.push_back(c & 31);
-        }
-        return result;
-    }
-
-    std::vector<uint8_t> CreateChecksum(const std::string& hrp, const std::vector<uint8_t>& data) {
-        std::vector<uint8_t> values = ExpandHRP(hrp);
-        values.insert(values.end(), data.begin(), data.end());
-        values.resize(values.size() + 6);
-        uint32_t polymod = Bech32Polymod(values) ^ 1;
-
-        std::vector<uint8_t> checksum(6);
-        for (int i = 0; i < 6; ++i) {
-            checksum[i] = (polymod >> (5 * (5 - i))) & 31;
-        }
-        return checksum;
-    }
-
-    std::vector<uint8_t> ConvertBits(const std::vector<uint8_t>& data,
-                                     int frombits, int tobits, bool pad) {
-        std::vector<uint8_t> result;
-        int acc = 0;
-        int bits = 0;
-        int maxv = (1 << tobits) - 1;
-        int max_acc = (1 << (frombits + tobits - 1)) - 1;
-
-        for (uint8_t value : data) {
-            if ((value >> frombits) != 0) {
-                return {}; // Invalid input
-            }
-            acc = ((acc << frombits) | value) & max_acc;
-            bits += frombits;
-            while (bits >= tobits) {
-                bits -= tobits;
-                result.push_back((acc >> bits) & maxv);
-            }
-        }
-
-        if (pad) {
-            if (bits > 0) {
-                result.push_back((acc << (tobits - bits)) & maxv);
-            }
-        } else if (bits >= frombits || ((acc << (tobits - bits)) & maxv)) {
-            return {}; // Invalid padding
-        }
-
-        return result;
-    }
-}
-
 std::string Bech32Encode(const std::string& hrp, const std::vector<uint8_t>& data) {
-    // Convert from 8-bit to 5-bit
-    std::vector<uint8_t> data_5bit = ConvertBits(data, 8, 5, true);
-    if (data_5bit.empty()) {
-        return ""; // Encoding failed
-    }
-
-    // Create checksum
-    std::vector<uint8_t> checksum = CreateChecksum(hrp, data_5bit);
-
-    // Combine data and checksum
-    data_5bit.insert(data_5bit.end(), checksum.begin(), checksum.end());
-
-    // Encode to Bech32 string
-    std::string result = hrp + "1";
-    for (uint8_t value : data_5bit) {
-        if (value >= 32) {
-            return ""; // Invalid value
-        }
-        result += BECH32_CHARSET[value];
-    }
-
-    return result;
+    return codec::EncodeBech32(hrp, data);
 }
 
 Result<std::pair<std::string, std::vector<uint8_t>>> Bech32Decode(const std::string& encoded) {
-    // Implementation stub for now
-    return Result<std::pair<std::string, std::vector<uint8_t>>>::Error("Bech32Decode not yet implemented");
+    std::pair<std::string, std::vector<uint8_t>> decoded;
+    auto result = codec::DecodeBech32(encoded, decoded.first, decoded.second);
+    if (result.IsError()) {
+        return Result<std::pair<std::string, std::vector<uint8_t>>>::Error(result.error);
+    }
+    return Result<std::pair<std::string, std::vector<uint8_t>>>::Ok(std::move(decoded));
 }
 
 } // namespace intcoin
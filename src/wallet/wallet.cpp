@@ -18,6 +18,7 @@
 #include <atomic>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 #include <rocksdb/db.h>
 #include <rocksdb/options.h>
 #include <rocksdb/slice.h>
@@ -2878,9 +2879,29 @@ Result<Transaction> Wallet::SignTransaction(const Transaction& tx) {
     // Create a copy of the transaction to sign
     Transaction signed_tx = tx;
 
-    // Sign each input
+    // Inputs and outputs are serialized once for all input signature hashes
+    // (filling in script_sigs below does not invalidate this)
+    const PrecomputedTxData txdata(signed_tx);
+
+    // Wallet addresses by string, so each input is a lookup rather than a scan
+    std::unordered_map<std::string, const WalletAddress*> addresses_by_string;
+    addresses_by_string.reserve(impl_->addresses.size());
+    for (const auto& addr : impl_->addresses) {
+        addresses_by_string.emplace(addr.address, &addr);
+    }
+
+    // Keys derived so far, by address: inputs spending the same address
+    // (common for consolidations and payouts) share one derivation
+    std::unordered_map<std::string, ExtendedKey> derived_keys;
+
+    std::vector<DilithiumCrypto::SignRequest> requests;
+    std::vector<const PublicKey*> input_pubkeys;
+    requests.reserve(signed_tx.inputs.size());
+    input_pubkeys.reserve(signed_tx.inputs.size());
+
+    // Resolve the key and signature hash of each input
     for (size_t i = 0; i < signed_tx.inputs.size(); i++) {
-        TxIn& input = signed_tx.inputs[i];
+        const TxIn& input = signed_tx.inputs[i];
 
         // Find the UTXO being spent
         OutPoint prevout;
@@ -2900,72 +2921,75 @@ Result<Transaction> Wallet::SignTransaction(const Transaction& tx) {
             return Result<Transaction>::Error("Could not extract address from UTXO script");
         }
 
-        // Find the wallet address
-        WalletAddress* wallet_addr = nullptr;
-        for (auto& addr : impl_->addresses) {
-            if (addr.address == address) {
-                wallet_addr = &addr;
-                break;
+        auto key_it = derived_keys.find(address);
+        if (key_it == derived_keys.end()) {
+            // Find the wallet address
+            auto addr_it = addresses_by_string.find(address);
+            if (addr_it == addresses_by_string.end()) {
+                return Result<Transaction>::Error("Address not found in wallet: " + address);
             }
-        }
 
-        if (!wallet_addr) {
-            return Result<Transaction>::Error("Address not found in wallet: " + address);
-        }
+            // Derive the key for this address using its path
+            auto key_result = HDKeyDerivation::DerivePath(impl_->master_key, addr_it->second->path);
+            if (!key_result.IsOk()) {
+                return Result<Transaction>::Error("Failed to derive key: " + key_result.error);
+            }
 
-        // Derive the key for this address using its path
-        auto key_result = HDKeyDerivation::DerivePath(impl_->master_key, wallet_addr->path);
-        if (!key_result.IsOk()) {
-            return Result<Transaction>::Error("Failed to derive key: " + key_result.error);
-        }
+            ExtendedKey derived_key = key_result.value.value();
+            if (!derived_key.private_key.has_value()) {
+                return Result<Transaction>::Error("Derived key has no private key");
+            }
 
-        ExtendedKey derived_key = key_result.value.value();
-        if (!derived_key.private_key.has_value()) {
-            return Result<Transaction>::Error("Derived key has no private key");
-        }
+            // Get public key for verification
+            if (!derived_key.public_key.has_value()) {
+                return Result<Transaction>::Error("Derived key has no public key");
+            }
 
-        // Get public key for verification
-        if (!derived_key.public_key.has_value()) {
-            return Result<Transaction>::Error("Derived key has no public key");
+            key_it = derived_keys.emplace(address, std::move(derived_key)).first;
         }
 
-        const SecretKey& secret_key = derived_key.private_key.value();
-        const PublicKey& public_key = derived_key.public_key.value();
+        // SIGHASH_ALL hash committing to the previous output's script,
+        // matching what OP_CHECKSIG verifies
+        DilithiumCrypto::SignRequest request;
+        request.hash = signed_tx.GetHashForSigning(SIGHASH_ALL, i, prev_output.script_pubkey, txdata);
+        request.secret_key = &key_it->second.private_key.value();
+        requests.push_back(request);
+        input_pubkeys.push_back(&key_it->second.public_key.value());
+    }
 
-        // Create transaction hash for signing
-        // For now, we'll sign the entire transaction (simplified)
-        // In production, this should be more sophisticated (e.g., SIGHASH types)
-        uint256 tx_hash = signed_tx.GetHash();
+    // Sign with Dilithium3, all inputs at once across the crypto thread pool
+    auto signatures = DilithiumCrypto::BatchSign(requests);
 
-        // Sign with Dilithium3
-        auto sign_result = DilithiumCrypto::SignHash(tx_hash, secret_key);
-        if (!sign_result.IsOk()) {
-            return Result<Transaction>::Error("Failed to sign transaction: " + sign_result.error);
+    for (size_t i = 0; i < signed_tx.inputs.size(); i++) {
+        if (!signatures[i].IsOk()) {
+            return Result<Transaction>::Error("Failed to sign input " + std::to_string(i) +
+                                              ": " + signatures[i].error);
         }
 
-        Signature signature = sign_result.value.value();
+        const Signature& signature = signatures[i].value.value();
+        const PublicKey& public_key = *input_pubkeys[i];
 
         // Create script_sig (P2PKH: <signature> <pubkey>)
-        // For now, use a simplified format: OP_PUSHDATA + length + data
+        // Each push is OP_PUSHDATA + 2-byte little-endian length + data,
+        // the encoding the script interpreter reads
         std::vector<uint8_t> script_data;
+        script_data.reserve(2 * 3 + signature.size() + public_key.size());
 
         // Add signature
         script_data.push_back(static_cast<uint8_t>(OpCode::OP_PUSHDATA));
-        uint32_t sig_len = signature.size();
-        script_data.insert(script_data.end(),
-                          reinterpret_cast<uint8_t*>(&sig_len),
-                          reinterpret_cast<uint8_t*>(&sig_len) + sizeof(sig_len));
+        uint16_t sig_len = static_cast<uint16_t>(signature.size());
+        script_data.push_back(sig_len & 0xFF);
+        script_data.push_back((sig_len >> 8) & 0xFF);
         script_data.insert(script_data.end(), signature.begin(), signature.end());
 
         // Add public key
         script_data.push_back(static_cast<uint8_t>(OpCode::OP_PUSHDATA));
-        uint32_t pk_len = public_key.size();
-        script_data.insert(script_data.end(),
-                          reinterpret_cast<uint8_t*>(&pk_len),
-                          reinterpret_cast<uint8_t*>(&pk_len) + sizeof(pk_len));
+        uint16_t pk_len = static_cast<uint16_t>(public_key.size());
+        script_data.push_back(pk_len & 0xFF);
+        script_data.push_back((pk_len >> 8) & 0xFF);
         script_data.insert(script_data.end(), public_key.begin(), public_key.end());
 
-        input.script_sig = Script(script_data);
+        signed_tx.inputs[i].script_sig = Script(script_data);
     }
 
     return Result<Transaction>::Ok(signed_tx);
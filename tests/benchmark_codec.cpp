@@ -0,0 +1,386 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+/**
+ * Codec Benchmarks
+ *
+ * Measures encode/decode time and heap allocations per call for the text
+ * codecs (codec.h) used by RPC, the explorer, wallet addresses and the
+ * mempool: hex for hashes and raw transactions, Base58 for legacy payloads
+ * and Bech32 for addresses and invoices. Each codec is compared against a
+ * reference that does the same work the old way (iostream hex, byte-at-a-time
+ * Base58, vector-building Bech32).
+ */
+
+#include <intcoin/codec.h>
+#include <intcoin/crypto.h>
+#include <intcoin/util.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace intcoin;
+using namespace std::chrono;
+
+// ============================================================================
+// Allocation Counting
+// ============================================================================
+
+static std::atomic<uint64_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// ============================================================================
+// Benchmark Utilities
+// ============================================================================
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations;
+    size_t bytes;
+    double allocs_per_op;
+    double time_per_op_ns;
+    double mb_per_sec;
+};
+
+std::vector<BenchmarkResult> benchmark_results;
+
+void ReportBenchmark(const BenchmarkResult& result) {
+    std::cout << std::left << std::setw(36) << result.name
+              << " bytes=" << std::setw(7) << result.bytes
+              << " allocs/op=" << std::setw(6) << std::fixed << std::setprecision(1) << result.allocs_per_op
+              << " time/op=" << std::setw(9) << std::setprecision(1) << result.time_per_op_ns << " ns"
+              << "  " << std::setprecision(0) << result.mb_per_sec << " MB/s"
+              << std::endl;
+    benchmark_results.push_back(result);
+}
+
+void SaveBenchmarkCSV(const std::string& filename) {
+    std::ofstream csv(filename);
+    csv << "Benchmark,Iterations,Bytes,Allocs_Per_Op,Time_Per_Op_ns,MB_Per_Sec\n";
+
+    for (const auto& result : benchmark_results) {
+        csv << result.name << ","
+            << result.iterations << ","
+            << result.bytes << ","
+            << result.allocs_per_op << ","
+            << result.time_per_op_ns << ","
+            << result.mb_per_sec << "\n";
+    }
+
+    csv.close();
+    std::cout << "\nBenchmark results saved to: " << filename << std::endl;
+}
+
+/// Run fn iterations times; fn returns the number of input bytes it processed
+template <typename Fn>
+void RunBenchmark(const std::string& name, uint64_t iterations, Fn&& fn) {
+    size_t bytes = fn();  // Warm up (and record the input size)
+
+    uint64_t allocs_before = g_allocations.load(std::memory_order_relaxed);
+    auto start = high_resolution_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+        bytes = fn();
+    }
+    auto end = high_resolution_clock::now();
+    uint64_t allocs = g_allocations.load(std::memory_order_relaxed) - allocs_before;
+
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.bytes = bytes;
+    result.allocs_per_op = static_cast<double>(allocs) / iterations;
+    result.time_per_op_ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()) / iterations;
+    result.mb_per_sec = bytes * 1000.0 / result.time_per_op_ns;  // bytes/ns * 1000 == MB/s
+    ReportBenchmark(result);
+}
+
+// ============================================================================
+// Reference Codecs
+// ============================================================================
+
+static const char* REFERENCE_BASE58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+static const char* REFERENCE_BECH32 = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+std::string ReferenceEncodeHex(const std::vector<uint8_t>& data) {
+    std::stringstream ss;
+    for (auto byte : data) {
+        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+    }
+    return ss.str();
+}
+
+std::vector<uint8_t> ReferenceDecodeHex(const std::string& hex) {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(hex.length() / 2);
+    for (size_t i = 0; i < hex.length(); i += 2) {
+        std::string byte_str = hex.substr(i, 2);
+        bytes.push_back(static_cast<uint8_t>(std::strtol(byte_str.c_str(), nullptr, 16)));
+    }
+    return bytes;
+}
+
+std::string ReferenceEncodeBase58(const std::vector<uint8_t>& data) {
+    size_t leading_zeros = 0;
+    while (leading_zeros < data.size() && data[leading_zeros] == 0) {
+        leading_zeros++;
+    }
+    std::vector<uint8_t> b58(data.size() * 138 / 100 + 1);
+    for (uint8_t byte : data) {
+        int carry = byte;
+        for (size_t j = b58.size(); j > 0; j--) {
+            carry += 256 * b58[j - 1];
+            b58[j - 1] = carry % 58;
+            carry /= 58;
+        }
+    }
+    size_t start = 0;
+    while (start < b58.size() && b58[start] == 0) {
+        start++;
+    }
+    std::string result(leading_zeros, '1');
+    for (size_t i = start; i < b58.size(); i++) {
+        result += REFERENCE_BASE58[b58[i]];
+    }
+    return result;
+}
+
+std::vector<uint8_t> ReferenceDecodeBase58(const std::string& encoded) {
+    size_t leading_ones = 0;
+    while (leading_ones < encoded.size() && encoded[leading_ones] == '1') {
+        leading_ones++;
+    }
+    std::vector<uint8_t> b256(encoded.size() * 733 / 1000 + 1);
+    for (char c : encoded) {
+        int carry = static_cast<int>(std::strchr(REFERENCE_BASE58, c) - REFERENCE_BASE58);
+        for (size_t j = b256.size(); j > 0; j--) {
+            carry += 58 * b256[j - 1];
+            b256[j - 1] = carry % 256;
+            carry /= 256;
+        }
+    }
+    size_t start = 0;
+    while (start < b256.size() && b256[start] == 0) {
+        start++;
+    }
+    std::vector<uint8_t> result(leading_ones, 0);
+    result.insert(result.end(), b256.begin() + start, b256.end());
+    return result;
+}
+
+uint32_t ReferenceBech32Polymod(const std::vector<uint8_t>& values) {
+    uint32_t c = 1;
+    for (uint8_t v : values) {
+        uint8_t c0 = c >> 25;
+        c = ((c & 0x1ffffff) << 5) ^ v;
+        if (c0 & 1) c ^= 0x3b6a57b2;
+        if (c0 & 2) c ^= 0x26508e6d;
+        if (c0 & 4) c ^= 0x1ea119fa;
+        if (c0 & 8) c ^= 0x3d4233dd;
+        if (c0 & 16) c ^= 0x2a1462b3;
+    }
+    return c;
+}
+
+std::string ReferenceEncodeBech32(const std::string& hrp, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> words;
+    int acc = 0;
+    int bits = 0;
+    for (uint8_t value : data) {
+        acc = ((acc << 8) | value) & 0xFFF;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            words.push_back((acc >> bits) & 31);
+        }
+    }
+    if (bits > 0) {
+        words.push_back((acc << (5 - bits)) & 31);
+    }
+
+    std::vector<uint8_t> values;
+    for (char c : hrp) values.push_back(c >> 5);
+    values.push_back(0);
+    for (char c : hrp) values.push_back(c & 31);
+    values.insert(values.end(), words.begin(), words.end());
+    values.resize(values.size() + 6);
+    uint32_t polymod = ReferenceBech32Polymod(values) ^ 1;
+    for (int i = 0; i < 6; ++i) {
+        words.push_back((polymod >> (5 * (5 - i))) & 31);
+    }
+
+    std::string result = hrp + "1";
+    for (uint8_t value : words) {
+        result += REFERENCE_BECH32[value];
+    }
+    return result;
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+std::vector<uint8_t> RandomBytes(size_t len) {
+    static std::mt19937 rng(42);
+    std::vector<uint8_t> data(len);
+    for (auto& byte : data) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    return data;
+}
+
+void BenchmarkHex(uint64_t iterations) {
+    uint256 hash;
+    auto hash_bytes = RandomBytes(32);
+    std::copy(hash_bytes.begin(), hash_bytes.end(), hash.begin());
+    auto raw_tx = RandomBytes(4096);  // a typical post-quantum transaction
+    std::string tx_hex = codec::EncodeHex(raw_tx);
+    if (tx_hex != ReferenceEncodeHex(raw_tx)) {
+        throw std::runtime_error("Hex encodings differ");
+    }
+
+    RunBenchmark("Hex encode 32B (reference)", iterations, [&] {
+        return ReferenceEncodeHex(hash_bytes).size() / 2;
+    });
+    RunBenchmark("Hex encode 32B (codec)", iterations, [&] {
+        return codec::EncodeHex(hash).size() / 2;
+    });
+    RunBenchmark("Hex encode 32B (to_chars, stack)", iterations, [&] {
+        char buf[64];
+        codec::HexToChars(buf, buf + sizeof(buf), hash);
+        return static_cast<size_t>(buf[0] != 0) * 32;
+    });
+    RunBenchmark("Hex encode 4KB (reference)", iterations / 50, [&] {
+        return ReferenceEncodeHex(raw_tx).size() / 2;
+    });
+    RunBenchmark("Hex encode 4KB (codec)", iterations / 50, [&] {
+        return codec::EncodeHex(raw_tx).size() / 2;
+    });
+    RunBenchmark("Hex decode 4KB (reference)", iterations / 50, [&] {
+        return ReferenceDecodeHex(tx_hex).size();
+    });
+    RunBenchmark("Hex decode 4KB (codec)", iterations / 50, [&] {
+        std::vector<uint8_t> out;
+        codec::DecodeHex(tx_hex, out);
+        return out.size();
+    });
+}
+
+void BenchmarkBase58(uint64_t iterations) {
+    auto payload = RandomBytes(25);  // version + hash160 + checksum
+    payload[0] = 0;
+    auto wide = RandomBytes(128);
+    std::string payload_b58 = codec::EncodeBase58(payload);
+    std::string wide_b58 = codec::EncodeBase58(wide);
+    if (payload_b58 != ReferenceEncodeBase58(payload) || wide_b58 != ReferenceEncodeBase58(wide)) {
+        throw std::runtime_error("Base58 encodings differ");
+    }
+
+    RunBenchmark("Base58 encode 25B (reference)", iterations, [&] {
+        return ReferenceEncodeBase58(payload).size() ? payload.size() : 0;
+    });
+    RunBenchmark("Base58 encode 25B (codec)", iterations, [&] {
+        return codec::EncodeBase58(payload).size() ? payload.size() : 0;
+    });
+    RunBenchmark("Base58 encode 128B (reference)", iterations / 10, [&] {
+        return ReferenceEncodeBase58(wide).size() ? wide.size() : 0;
+    });
+    RunBenchmark("Base58 encode 128B (codec)", iterations / 10, [&] {
+        return codec::EncodeBase58(wide).size() ? wide.size() : 0;
+    });
+    RunBenchmark("Base58 decode 128B (reference)", iterations / 10, [&] {
+        return ReferenceDecodeBase58(wide_b58).size();
+    });
+    RunBenchmark("Base58 decode 128B (codec)", iterations / 10, [&] {
+        std::vector<uint8_t> out;
+        codec::DecodeBase58(wide_b58, out);
+        return out.size();
+    });
+}
+
+void BenchmarkBech32(uint64_t iterations) {
+    auto payload = RandomBytes(33);  // address version + pubkey hash
+    auto invoice = RandomBytes(400);
+    if (codec::EncodeBech32("int", payload) != ReferenceEncodeBech32("int", payload)) {
+        throw std::runtime_error("Bech32 encodings differ");
+    }
+
+    uint256 pubkey_hash;
+    std::copy(payload.begin() + 1, payload.end(), pubkey_hash.begin());
+    std::string address = *AddressEncoder::EncodeAddress(pubkey_hash).value;
+    std::string invoice_b32 = codec::EncodeBech32("lint", invoice);
+
+    RunBenchmark("Bech32 encode 33B (reference)", iterations, [&] {
+        return ReferenceEncodeBech32("int", payload).size() ? payload.size() : 0;
+    });
+    RunBenchmark("Bech32 encode 33B (codec)", iterations, [&] {
+        return codec::EncodeBech32("int", payload).size() ? payload.size() : 0;
+    });
+    RunBenchmark("Bech32 encode 400B (reference)", iterations / 10, [&] {
+        return ReferenceEncodeBech32("lint", invoice).size() ? invoice.size() : 0;
+    });
+    RunBenchmark("Bech32 encode 400B (codec)", iterations / 10, [&] {
+        return codec::EncodeBech32("lint", invoice).size() ? invoice.size() : 0;
+    });
+    RunBenchmark("Bech32 decode 400B (codec)", iterations / 10, [&] {
+        std::string hrp;
+        std::vector<uint8_t> out;
+        codec::DecodeBech32(invoice_b32, hrp, out);
+        return out.size();
+    });
+    RunBenchmark("Address encode (AddressEncoder)", iterations, [&] {
+        return AddressEncoder::EncodeAddress(pubkey_hash).value->size() ? 32 : 0;
+    });
+    RunBenchmark("Address decode (AddressEncoder)", iterations, [&] {
+        return AddressEncoder::DecodeAddress(address).IsOk() ? 32 : 0;
+    });
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "========================================" << std::endl;
+    std::cout << "  INTcoin Hex / Base58 / Bech32" << std::endl;
+    std::cout << "  Performance Benchmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    uint64_t iterations = 200000;
+    if (argc > 1) iterations = std::stoull(argv[1]);
+
+    try {
+        std::cout << std::endl;
+        BenchmarkHex(iterations);
+        BenchmarkBase58(iterations / 10);
+        BenchmarkBech32(iterations);
+
+        SaveBenchmarkCSV("codec_benchmark_results.csv");
+
+        std::cout << "\n✓ All benchmarks completed successfully" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+/**
+ * Mempool Admission Benchmarks
+ *
+ * Submits signed P2PKH transactions to the mempool from 1, 8 and 32 threads,
+ * and through the batch AddTransactions API, with a transaction check that
+ * verifies every input signature. Signature checks and coin lookups run
+ * outside the mempool lock, so admission should scale with the submitters.
+ */
+
+#include <intcoin/ibd/check_queue.h>
+#include <intcoin/crypto.h>
+#include <intcoin/mempool.h>
+#include <intcoin/script.h>
+#include <intcoin/transaction.h>
+#include <intcoin/util.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace intcoin;
+using namespace std::chrono;
+
+// ============================================================================
+// Benchmark Utilities
+// ============================================================================
+
+struct BenchmarkResult {
+    std::string name;
+    size_t threads;
+    uint64_t transactions;
+    uint64_t accepted;
+    double total_time_ms;
+    double tx_per_sec;
+};
+
+std::vector<BenchmarkResult> benchmark_results;
+
+void ReportBenchmark(const BenchmarkResult& result) {
+    std::cout << std::left << std::setw(24) << result.name
+              << " threads=" << std::setw(3) << result.threads
+              << " time=" << std::fixed << std::setprecision(2) << result.total_time_ms << " ms"
+              << "  " << std::setprecision(0) << result.tx_per_sec << " tx/sec"
+              << "  (" << result.accepted << "/" << result.transactions << " accepted)"
+              << std::endl;
+    benchmark_results.push_back(result);
+}
+
+void SaveBenchmarkCSV(const std::string& filename) {
+    std::ofstream csv(filename);
+    csv << "Benchmark,Threads,Transactions,Accepted,Total_Time_ms,Tx_Per_Sec\n";
+
+    for (const auto& result : benchmark_results) {
+        csv << result.name << ","
+            << result.threads << ","
+            << result.transactions << ","
+            << result.accepted << ","
+            << result.total_time_ms << ","
+            << result.tx_per_sec << "\n";
+    }
+
+    csv.close();
+    std::cout << "\nBenchmark results saved to: " << filename << std::endl;
+}
+
+// ============================================================================
+// Synthetic Transactions
+// ============================================================================
+
+Script MakeScriptSig(const Signature& signature, const PublicKey& pubkey) {
+    std::vector<uint8_t> bytes;
+    auto push = [&bytes](const uint8_t* data, size_t len) {
+        bytes.push_back(static_cast<uint8_t>(OpCode::OP_PUSHDATA));
+        bytes.push_back(static_cast<uint8_t>(len & 0xFF));
+        bytes.push_back(static_cast<uint8_t>((len >> 8) & 0xFF));
+        bytes.insert(bytes.end(), data, data + len);
+    };
+    push(signature.data(), signature.size());
+    push(pubkey.data(), pubkey.size());
+    return Script(bytes);
+}
+
+/// Build num_txs independent transactions, each spending one signed P2PKH coin
+std::vector<Transaction> BuildTransactions(size_t num_txs,
+                                           const DilithiumCrypto::KeyPair& keypair,
+                                           const Script& script_pubkey) {
+    std::vector<Transaction> txs(num_txs);
+    for (size_t t = 0; t < num_txs; t++) {
+        Transaction& tx = txs[t];
+        tx.version = 1;
+
+        TxIn input;
+        input.prev_tx_hash = {};
+        input.prev_tx_hash[0] = static_cast<uint8_t>(t);
+        input.prev_tx_hash[1] = static_cast<uint8_t>(t >> 8);
+        input.prev_tx_hash[2] = static_cast<uint8_t>(t >> 16);
+        input.prev_tx_index = 0;
+        input.sequence = 0xFFFFFFFF;
+        tx.inputs.push_back(input);
+        tx.outputs.emplace_back(90000 - (t % 1000), script_pubkey);
+
+        uint256 sighash = tx.GetHashForSigning(SIGHASH_ALL, 0, script_pubkey);
+        auto signature = DilithiumCrypto::SignHash(sighash, keypair.secret_key).GetValue();
+        tx.inputs[0].script_sig = MakeScriptSig(signature, keypair.public_key);
+    }
+    return txs;
+}
+
+/// A mempool whose coins are all worth 100,000 and locked to script_pubkey,
+/// and whose admission check runs every input script
+std::unique_ptr<INTcoinMempool> CreateMempool(const Script& script_pubkey) {
+    MempoolConfig config;
+    config.max_size_mb = 1000;
+    config.persist_on_shutdown = false;
+    config.priority_limits[TxPriority::NORMAL] = 1000000;
+
+    auto mempool = std::make_unique<INTcoinMempool>();
+    mempool->Initialize(config);
+    mempool->SetCoinLookup([script_pubkey](const OutPoint&) -> std::optional<TxOut> {
+        return TxOut(100000, script_pubkey);
+    });
+    mempool->SetTransactionCheck([script_pubkey](const Transaction& tx) -> Result<void> {
+        for (size_t i = 0; i < tx.inputs.size(); i++) {
+            ibd::ScriptCheck check;
+            check.tx = &tx;
+            check.input_index = i;
+            check.script_pubkey = script_pubkey;
+            auto result = check();
+            if (!result.success) {
+                return Result<void>::Error("Script verification failed: " + result.error);
+            }
+        }
+        return Result<void>::Ok();
+    });
+    return mempool;
+}
+
+// ============================================================================
+// Benchmark: Concurrent AddTransaction
+// ============================================================================
+
+void BenchmarkConcurrentAdmission(const std::vector<Transaction>& txs,
+                                  const Script& script_pubkey, size_t threads) {
+    auto mempool = CreateMempool(script_pubkey);
+    SignatureCache::Instance().Clear();
+
+    std::atomic<uint64_t> accepted{0};
+    std::vector<std::thread> workers;
+    auto start = high_resolution_clock::now();
+    for (size_t w = 0; w < threads; w++) {
+        workers.emplace_back([&, w]() {
+            for (size_t i = w; i < txs.size(); i += threads) {
+                if (mempool->AddTransaction(txs[i], TxPriority::NORMAL).IsOk()) {
+                    accepted++;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = high_resolution_clock::now();
+
+    BenchmarkResult result;
+    result.name = "AddTransaction";
+    result.threads = threads;
+    result.transactions = txs.size();
+    result.accepted = accepted.load();
+    result.total_time_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    result.tx_per_sec = txs.size() / (result.total_time_ms / 1000.0);
+    ReportBenchmark(result);
+}
+
+// ============================================================================
+// Benchmark: Batch AddTransactions
+// ============================================================================
+
+void BenchmarkBatchAdmission(const std::vector<Transaction>& txs, const Script& script_pubkey) {
+    auto mempool = CreateMempool(script_pubkey);
+    SignatureCache::Instance().Clear();
+
+    auto start = high_resolution_clock::now();
+    auto results = mempool->AddTransactions(txs, TxPriority::NORMAL);
+    auto end = high_resolution_clock::now();
+
+    BenchmarkResult result;
+    result.name = "AddTransactions (batch)";
+    result.threads = std::max(1u, std::thread::hardware_concurrency());
+    result.transactions = txs.size();
+    result.accepted = std::count_if(results.begin(), results.end(),
+                                    [](const Result<void>& r) { return r.IsOk(); });
+    result.total_time_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    result.tx_per_sec = txs.size() / (result.total_time_ms / 1000.0);
+    ReportBenchmark(result);
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "========================================" << std::endl;
+    std::cout << "  INTcoin Mempool Admission" << std::endl;
+    std::cout << "  Performance Benchmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    size_t num_txs = 2000;
+    if (argc > 1) num_txs = std::stoul(argv[1]);
+
+    try {
+        auto keypair = DilithiumCrypto::GenerateKeyPair().GetValue();
+        Script script_pubkey = Script::CreateP2PKH(PublicKeyToHash(keypair.public_key));
+
+        std::cout << "\nSigning " << num_txs << " transactions..." << std::endl;
+        auto txs = BuildTransactions(num_txs, keypair, script_pubkey);
+
+        for (size_t threads : {1, 8, 32}) {
+            BenchmarkConcurrentAdmission(txs, script_pubkey, threads);
+        }
+        BenchmarkBatchAdmission(txs, script_pubkey);
+
+        SaveBenchmarkCSV("mempool_benchmark_results.csv");
+
+        std::cout << "\n✓ All benchmarks completed successfully" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
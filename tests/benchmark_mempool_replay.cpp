@@ -0,0 +1,467 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+/**
+ * Mempool Replay Benchmark
+ *
+ * Generates a mixed transaction workload and replays it into
+ * INTcoinMempool from several threads:
+ *   - chains:    each transaction spends the previous one (up to the
+ *                ancestor limit)
+ *   - fan-out:   one parent with many outputs, a child spending each
+ *   - contracts: per-sender nonce sequences of contract calls
+ *   - conflicts: pairs of transactions spending the same coin
+ * Fees and gas prices vary throughout, so priority classes, package
+ * scores and trimming all come into play.
+ *
+ * Reports admission tx/s, block template build latency, eviction cost and
+ * memory per entry, and writes them as JSON to
+ * <output_dir>/mempool_replay_YYYYMMDD_HHMMSS.json.
+ *
+ * Usage: benchmark_mempool_replay [num_txs] [threads] [mempool_mb] [output_dir]
+ */
+
+#include <intcoin/consensus.h>
+#include <intcoin/contracts/transaction.h>
+#include <intcoin/mempool.h>
+#include <intcoin/transaction.h>
+#include <intcoin/util.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace intcoin;
+using namespace std::chrono;
+
+// ============================================================================
+// Workload Generation
+// ============================================================================
+
+/// Value of every coin the mempool's coin lookup reports
+constexpr uint64_t COIN_VALUE = 1'000'000;
+
+enum Workload : size_t { CHAINS = 0, FANOUT = 1, CONTRACTS = 2, CONFLICTS = 3, NUM_WORKLOADS = 4 };
+
+const char* WorkloadName(size_t workload) {
+    switch (workload) {
+        case CHAINS: return "chains";
+        case FANOUT: return "fanout";
+        case CONTRACTS: return "contracts";
+        case CONFLICTS: return "conflicts";
+    }
+    return "unknown";
+}
+
+/// Transactions one submitter sends in order (parents before children)
+struct TxGroup {
+    Workload workload;
+    std::vector<Transaction> txs;
+};
+
+class WorkloadGenerator {
+public:
+    explicit WorkloadGenerator(uint64_t seed) : rng_(seed) {}
+
+    /// A fresh coin, found by the coin lookup
+    OutPoint NewCoin() {
+        uint256 hash{};
+        uint64_t n = next_coin_++;
+        for (size_t i = 0; i < 8; i++) hash[i] = static_cast<uint8_t>(n >> (8 * i));
+        hash[31] = 0xC0;
+        return OutPoint(hash, 0);
+    }
+
+    uint64_t RandomFee() { return std::uniform_int_distribution<uint64_t>(300, 30000)(rng_); }
+
+    Transaction Spend(const std::vector<OutPoint>& prevouts, uint64_t value_in, size_t num_outputs) {
+        Transaction tx;
+        tx.version = 1;
+        for (const auto& prevout : prevouts) {
+            TxIn input;
+            input.prev_tx_hash = prevout.tx_hash;
+            input.prev_tx_index = prevout.index;
+            input.script_sig.bytes.assign(72, static_cast<uint8_t>(rng_()));
+            input.sequence = 0xFFFFFFFF;
+            tx.inputs.push_back(input);
+        }
+        uint64_t fee = std::min(RandomFee(), value_in / 2);
+        uint64_t value_out = (value_in - fee) / num_outputs;
+        for (size_t i = 0; i < num_outputs; i++) {
+            TxOut output;
+            output.value = value_out;
+            output.script_pubkey.bytes.assign(25, static_cast<uint8_t>(0x76 + i));
+            tx.outputs.push_back(output);
+        }
+        return tx;
+    }
+
+    /// Each transaction spends output 0 of the one before
+    TxGroup Chain(size_t length) {
+        TxGroup group{CHAINS, {}};
+        OutPoint prevout = NewCoin();
+        uint64_t value = COIN_VALUE;
+        for (size_t i = 0; i < length; i++) {
+            Transaction tx = Spend({prevout}, value, 1);
+            prevout = OutPoint(tx.GetHash(), 0);
+            value = tx.outputs[0].value;
+            group.txs.push_back(std::move(tx));
+        }
+        return group;
+    }
+
+    /// One parent with width outputs and a child spending each
+    TxGroup FanOut(size_t width) {
+        TxGroup group{FANOUT, {}};
+        Transaction parent = Spend({NewCoin()}, COIN_VALUE, width);
+        uint256 parent_hash = parent.GetHash();
+        uint64_t value = parent.outputs[0].value;
+        group.txs.push_back(std::move(parent));
+        for (size_t i = 0; i < width; i++) {
+            group.txs.push_back(Spend({OutPoint(parent_hash, static_cast<uint32_t>(i))}, value, 1));
+        }
+        return group;
+    }
+
+    /// Contract calls from one sender, nonces 0..count-1
+    TxGroup ContractCalls(size_t count) {
+        TxGroup group{CONTRACTS, {}};
+        uint64_t sender = next_sender_++;
+        for (size_t nonce = 0; nonce < count; nonce++) {
+            contracts::ContractCallTx call;
+            call.from.fill(0);
+            for (size_t i = 0; i < 8; i++) call.from[i] = static_cast<uint8_t>(sender >> (8 * i));
+            call.nonce = nonce;
+            call.to = "int1replaybenchmarkcontract";
+            call.data.assign(64, static_cast<uint8_t>(nonce));
+            call.gas_limit = std::uniform_int_distribution<uint64_t>(21000, 30000)(rng_);
+            call.gas_price = std::uniform_int_distribution<uint64_t>(1, 200)(rng_);
+
+            Transaction tx = Spend({NewCoin()}, COIN_VALUE, 1);
+            tx.type = TxType::CONTRACT_CALL;
+            tx.contract_data = call.Serialize();
+            group.txs.push_back(std::move(tx));
+        }
+        return group;
+    }
+
+    /// Two transactions spending the same coin; only the first can get in
+    TxGroup Conflict() {
+        TxGroup group{CONFLICTS, {}};
+        OutPoint coin = NewCoin();
+        group.txs.push_back(Spend({coin}, COIN_VALUE, 2));
+        group.txs.push_back(Spend({coin}, COIN_VALUE, 2));
+        return group;
+    }
+
+    /// About num_txs transactions: 40% chains, 25% fan-out, 15% contract
+    /// calls (capped by the mempool's two blocks of gas) and 20% conflicts,
+    /// shuffled by group
+    std::vector<TxGroup> Generate(size_t num_txs) {
+        std::vector<TxGroup> groups;
+        auto add = [&](size_t budget, auto make) {
+            size_t made = 0;
+            while (made < budget) {
+                groups.push_back(make(budget - made));
+                made += groups.back().txs.size();
+            }
+        };
+        auto length = [&](size_t lo, size_t hi, size_t left) {
+            return std::min(left, std::uniform_int_distribution<size_t>(lo, hi)(rng_));
+        };
+
+        add(num_txs * 40 / 100, [&](size_t left) { return Chain(length(2, 25, left)); });
+        add(num_txs * 25 / 100, [&](size_t left) { return FanOut(std::max<size_t>(1, length(3, 21, left) - 1)); });
+        add(std::min<size_t>(num_txs * 15 / 100, 2000), [&](size_t left) { return ContractCalls(length(1, 10, left)); });
+        add(num_txs * 20 / 100, [&](size_t) { return Conflict(); });
+
+        std::shuffle(groups.begin(), groups.end(), rng_);
+        return groups;
+    }
+
+private:
+    std::mt19937_64 rng_;
+    uint64_t next_coin_ = 0;
+    uint64_t next_sender_ = 1;
+};
+
+std::unique_ptr<INTcoinMempool> CreateMempool(uint64_t max_size_mb) {
+    MempoolConfig config;
+    config.max_size_mb = max_size_mb;
+    config.persist_on_shutdown = false;
+    for (auto& [priority, limit] : config.priority_limits) {
+        limit = 1000000;
+    }
+
+    auto mempool = std::make_unique<INTcoinMempool>();
+    mempool->Initialize(config);
+    mempool->SetCoinLookup([](const OutPoint&) -> std::optional<TxOut> {
+        TxOut coin;
+        coin.value = COIN_VALUE;
+        return coin;
+    });
+    return mempool;
+}
+
+double ElapsedMs(high_resolution_clock::time_point start, high_resolution_clock::time_point end) {
+    return duration_cast<microseconds>(end - start).count() / 1000.0;
+}
+
+// ============================================================================
+// Results
+// ============================================================================
+
+struct ReplayResult {
+    size_t num_txs = 0;
+    size_t threads = 0;
+    uint64_t mempool_mb = 0;
+
+    // Admission
+    uint64_t submitted[NUM_WORKLOADS] = {};
+    uint64_t accepted[NUM_WORKLOADS] = {};
+    double admission_ms = 0;
+
+    // Block template
+    size_t template_runs = 0;
+    size_t template_txs = 0;
+    double template_avg_ms = 0;
+    double template_max_ms = 0;
+
+    // Eviction
+    uint64_t eviction_mempool_mb = 0;
+    uint64_t eviction_submitted = 0;
+    uint64_t evicted = 0;
+    double eviction_ms = 0;
+
+    // Memory
+    uint64_t entries = 0;
+    uint64_t memory_bytes = 0;
+};
+
+std::string CurrentTimestamp(const char* format) {
+    std::time_t now = std::time(nullptr);
+    std::tm tm{};
+    gmtime_r(&now, &tm);
+    std::ostringstream out;
+    out << std::put_time(&tm, format);
+    return out.str();
+}
+
+void SaveResultsJSON(const ReplayResult& r, const std::string& output_dir) {
+    std::filesystem::create_directories(output_dir);
+    std::string path = output_dir + "/mempool_replay_" + CurrentTimestamp("%Y%m%d_%H%M%S") + ".json";
+
+    uint64_t total_submitted = 0;
+    uint64_t total_accepted = 0;
+    for (size_t w = 0; w < NUM_WORKLOADS; w++) {
+        total_submitted += r.submitted[w];
+        total_accepted += r.accepted[w];
+    }
+
+    std::ofstream json(path);
+    json << std::fixed << std::setprecision(3);
+    json << "{\n";
+    json << "  \"benchmark_date\": \"" << CurrentTimestamp("%Y-%m-%dT%H:%M:%SZ") << "\",\n";
+    json << "  \"benchmark\": \"mempool_replay\",\n";
+    json << "  \"config\": {\n";
+    json << "    \"transactions\": " << r.num_txs << ",\n";
+    json << "    \"threads\": " << r.threads << ",\n";
+    json << "    \"mempool_mb\": " << r.mempool_mb << "\n";
+    json << "  },\n";
+    json << "  \"admission\": {\n";
+    json << "    \"submitted\": " << total_submitted << ",\n";
+    json << "    \"accepted\": " << total_accepted << ",\n";
+    json << "    \"total_ms\": " << r.admission_ms << ",\n";
+    json << "    \"tx_per_sec\": " << total_submitted / (r.admission_ms / 1000.0) << ",\n";
+    json << "    \"workloads\": {\n";
+    for (size_t w = 0; w < NUM_WORKLOADS; w++) {
+        json << "      \"" << WorkloadName(w) << "\": {\"submitted\": " << r.submitted[w]
+             << ", \"accepted\": " << r.accepted[w] << "}" << (w + 1 < NUM_WORKLOADS ? ",\n" : "\n");
+    }
+    json << "    }\n";
+    json << "  },\n";
+    json << "  \"block_template\": {\n";
+    json << "    \"runs\": " << r.template_runs << ",\n";
+    json << "    \"transactions\": " << r.template_txs << ",\n";
+    json << "    \"avg_ms\": " << r.template_avg_ms << ",\n";
+    json << "    \"max_ms\": " << r.template_max_ms << "\n";
+    json << "  },\n";
+    json << "  \"eviction\": {\n";
+    json << "    \"mempool_mb\": " << r.eviction_mempool_mb << ",\n";
+    json << "    \"submitted\": " << r.eviction_submitted << ",\n";
+    json << "    \"evicted\": " << r.evicted << ",\n";
+    json << "    \"total_ms\": " << r.eviction_ms << ",\n";
+    json << "    \"us_per_eviction\": " << (r.evicted > 0 ? r.eviction_ms * 1000.0 / r.evicted : 0.0) << "\n";
+    json << "  },\n";
+    json << "  \"memory\": {\n";
+    json << "    \"entries\": " << r.entries << ",\n";
+    json << "    \"usage_bytes\": " << r.memory_bytes << ",\n";
+    json << "    \"bytes_per_entry\": " << (r.entries > 0 ? r.memory_bytes / r.entries : 0) << "\n";
+    json << "  }\n";
+    json << "}\n";
+    json.close();
+
+    std::cout << "\nBenchmark results saved to: " << path << std::endl;
+}
+
+// ============================================================================
+// Benchmark: Replay
+// ============================================================================
+
+/// Submitters take whole groups, so parents always precede their children
+void BenchmarkReplay(const std::vector<TxGroup>& groups, ReplayResult& result) {
+    auto mempool = CreateMempool(result.mempool_mb);
+
+    std::atomic<size_t> next_group{0};
+    std::atomic<uint64_t> accepted[NUM_WORKLOADS] = {};
+    std::vector<std::thread> workers;
+
+    auto start = high_resolution_clock::now();
+    for (size_t t = 0; t < result.threads; t++) {
+        workers.emplace_back([&]() {
+            for (size_t g = next_group++; g < groups.size(); g = next_group++) {
+                for (const auto& tx : groups[g].txs) {
+                    if (mempool->AddTransaction(tx, TxPriority::NORMAL).IsOk()) {
+                        accepted[groups[g].workload]++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = high_resolution_clock::now();
+
+    result.admission_ms = ElapsedMs(start, end);
+    for (const auto& group : groups) {
+        result.submitted[group.workload] += group.txs.size();
+    }
+    for (size_t w = 0; w < NUM_WORKLOADS; w++) {
+        result.accepted[w] = accepted[w].load();
+    }
+
+    // Block template over the replayed mempool
+    constexpr size_t TEMPLATE_RUNS = 20;
+    double total_ms = 0;
+    for (size_t run = 0; run < TEMPLATE_RUNS; run++) {
+        auto template_start = high_resolution_clock::now();
+        auto block = mempool->GetBlockTemplate(consensus::MAX_BLOCK_SIZE, 0);
+        double ms = ElapsedMs(template_start, high_resolution_clock::now());
+        total_ms += ms;
+        result.template_max_ms = std::max(result.template_max_ms, ms);
+        result.template_txs = block.size();
+    }
+    result.template_runs = TEMPLATE_RUNS;
+    result.template_avg_ms = total_ms / TEMPLATE_RUNS;
+
+    MempoolStats stats = mempool->GetStats();
+    result.entries = stats.total_transactions;
+    result.memory_bytes = stats.memory_usage_bytes;
+}
+
+// ============================================================================
+// Benchmark: Eviction
+// ============================================================================
+
+/// Overfill a 1 MB mempool with independent transactions of rising fee,
+/// so that once it is full each admission trims the cheapest entries
+void BenchmarkEviction(WorkloadGenerator& generator, ReplayResult& result) {
+    constexpr uint64_t EVICTION_MEMPOOL_MB = 1;
+    auto mempool = CreateMempool(EVICTION_MEMPOOL_MB);
+
+    // Roughly three mempools' worth of ~190 byte transactions
+    size_t count = 3 * EVICTION_MEMPOOL_MB * 1024 * 1024 / 190;
+    std::vector<Transaction> txs;
+    txs.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        txs.push_back(generator.Spend({generator.NewCoin()}, COIN_VALUE, 1));
+    }
+    std::sort(txs.begin(), txs.end(), [](const Transaction& a, const Transaction& b) {
+        return a.outputs[0].value > b.outputs[0].value;  // lowest fee first
+    });
+
+    uint64_t accepted = 0;
+    auto start = high_resolution_clock::now();
+    for (const auto& tx : txs) {
+        if (mempool->AddTransaction(tx, TxPriority::NORMAL).IsOk()) {
+            accepted++;
+        }
+    }
+    auto end = high_resolution_clock::now();
+
+    uint64_t remaining = mempool->GetStats().total_transactions;
+    result.eviction_mempool_mb = EVICTION_MEMPOOL_MB;
+    result.eviction_submitted = txs.size();
+    result.evicted = accepted > remaining ? accepted - remaining : 0;
+    result.eviction_ms = ElapsedMs(start, end);
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "========================================" << std::endl;
+    std::cout << "  INTcoin Mempool Replay" << std::endl;
+    std::cout << "  Performance Benchmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    ReplayResult result;
+    result.num_txs = 20000;
+    result.threads = std::max(1u, std::thread::hardware_concurrency());
+    result.mempool_mb = 300;
+    std::string output_dir = "benchmarks/results";
+
+    if (argc > 1) result.num_txs = std::stoul(argv[1]);
+    if (argc > 2) result.threads = std::max<size_t>(1, std::stoul(argv[2]));
+    if (argc > 3) result.mempool_mb = std::stoull(argv[3]);
+    if (argc > 4) output_dir = argv[4];
+
+    try {
+        WorkloadGenerator generator(20260101);
+
+        std::cout << "\nGenerating ~" << result.num_txs << " transactions..." << std::endl;
+        auto groups = generator.Generate(result.num_txs);
+
+        BenchmarkReplay(groups, result);
+        BenchmarkEviction(generator, result);
+
+        uint64_t total_submitted = 0;
+        uint64_t total_accepted = 0;
+        for (size_t w = 0; w < NUM_WORKLOADS; w++) {
+            std::cout << std::left << std::setw(12) << WorkloadName(w)
+                      << result.accepted[w] << "/" << result.submitted[w] << " accepted" << std::endl;
+            total_submitted += result.submitted[w];
+            total_accepted += result.accepted[w];
+        }
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "\nAdmission:      " << result.admission_ms << " ms, "
+                  << std::setprecision(0) << total_submitted / (result.admission_ms / 1000.0) << " tx/sec"
+                  << " (" << total_accepted << "/" << total_submitted << " accepted, "
+                  << result.threads << " threads)" << std::endl;
+        std::cout << std::setprecision(2);
+        std::cout << "Block template: " << result.template_avg_ms << " ms avg, "
+                  << result.template_max_ms << " ms max (" << result.template_txs << " txs)" << std::endl;
+        std::cout << "Eviction:       " << result.evicted << " evicted in " << result.eviction_ms << " ms ("
+                  << (result.evicted > 0 ? result.eviction_ms * 1000.0 / result.evicted : 0.0)
+                  << " us each)" << std::endl;
+        std::cout << "Memory:         " << (result.entries > 0 ? result.memory_bytes / result.entries : 0)
+                  << " bytes/entry over " << result.entries << " entries" << std::endl;
+
+        SaveResultsJSON(result, output_dir);
+
+        std::cout << "\n✓ All benchmarks completed successfully" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
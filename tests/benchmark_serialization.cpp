@@ -0,0 +1,404 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+
+/**
+ * Serialization Benchmarks
+ *
+ * Measures encode/decode time and heap allocations per object graph for the
+ * hot paths that use the stream serialization layer (serialize.h): blocks,
+ * P2P message framing, undo (spent output) records and Lightning messages.
+ * The block and undo encoders are compared against a reference that builds
+ * the same bytes the old way, by concatenating freshly allocated child
+ * vectors, and block decoding against the arena-backed BlockView.
+ */
+
+#include <intcoin/block.h>
+#include <intcoin/network.h>
+#include <intcoin/serialize.h>
+#include <intcoin/storage.h>
+#include <intcoin/transaction.h>
+#include <intcoin/util.h>
+#include "lightning/bolt_messages.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+using namespace intcoin;
+using namespace std::chrono;
+
+// ============================================================================
+// Allocation Counting
+// ============================================================================
+
+static std::atomic<uint64_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Over-aligned allocations (std::pmr::new_delete_resource uses these)
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+// ============================================================================
+// Benchmark Utilities
+// ============================================================================
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations;
+    size_t bytes;
+    double allocs_per_op;
+    double time_per_op_us;
+    double mb_per_sec;
+};
+
+std::vector<BenchmarkResult> benchmark_results;
+
+void ReportBenchmark(const BenchmarkResult& result) {
+    std::cout << std::left << std::setw(34) << result.name
+              << " bytes=" << std::setw(9) << result.bytes
+              << " allocs/op=" << std::setw(8) << std::fixed << std::setprecision(1) << result.allocs_per_op
+              << " time/op=" << std::setprecision(2) << result.time_per_op_us << " us"
+              << "  " << std::setprecision(0) << result.mb_per_sec << " MB/s"
+              << std::endl;
+    benchmark_results.push_back(result);
+}
+
+void SaveBenchmarkCSV(const std::string& filename) {
+    std::ofstream csv(filename);
+    csv << "Benchmark,Iterations,Bytes,Allocs_Per_Op,Time_Per_Op_us,MB_Per_Sec\n";
+
+    for (const auto& result : benchmark_results) {
+        csv << result.name << ","
+            << result.iterations << ","
+            << result.bytes << ","
+            << result.allocs_per_op << ","
+            << result.time_per_op_us << ","
+            << result.mb_per_sec << "\n";
+    }
+
+    csv.close();
+    std::cout << "\nBenchmark results saved to: " << filename << std::endl;
+}
+
+/// Run fn iterations times; fn returns the number of bytes it produced
+template <typename Fn>
+void RunBenchmark(const std::string& name, uint64_t iterations, Fn&& fn) {
+    size_t bytes = fn();  // Warm up (and record the output size)
+
+    uint64_t allocs_before = g_allocations.load(std::memory_order_relaxed);
+    auto start = high_resolution_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+        bytes = fn();
+    }
+    auto end = high_resolution_clock::now();
+    uint64_t allocs = g_allocations.load(std::memory_order_relaxed) - allocs_before;
+
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.bytes = bytes;
+    result.allocs_per_op = static_cast<double>(allocs) / iterations;
+    result.time_per_op_us = duration_cast<nanoseconds>(end - start).count() / 1000.0 / iterations;
+    result.mb_per_sec = bytes / result.time_per_op_us;  // bytes/us == MB/s
+    ReportBenchmark(result);
+}
+
+// ============================================================================
+// Reference Encoders (child vectors concatenated with insert)
+// ============================================================================
+
+std::vector<uint8_t> ReferenceSerializeTxIn(const TxIn& input) {
+    std::vector<uint8_t> result;
+    SerializeUint256(result, input.prev_tx_hash);
+    SerializeUint32(result, input.prev_tx_index);
+    SerializeUint64(result, input.script_sig.GetSize());
+    auto script = input.script_sig.Serialize();
+    result.insert(result.end(), script.begin(), script.end());
+    SerializeUint32(result, input.sequence);
+    return result;
+}
+
+std::vector<uint8_t> ReferenceSerializeTxOut(const TxOut& output) {
+    std::vector<uint8_t> result;
+    SerializeUint64(result, output.value);
+    SerializeUint64(result, output.script_pubkey.GetSize());
+    auto script = output.script_pubkey.Serialize();
+    result.insert(result.end(), script.begin(), script.end());
+    return result;
+}
+
+std::vector<uint8_t> ReferenceSerializeTx(const Transaction& tx) {
+    std::vector<uint8_t> result;
+    SerializeUint32(result, tx.version);
+    SerializeUint64(result, tx.inputs.size());
+    for (const auto& input : tx.inputs) {
+        auto bytes = ReferenceSerializeTxIn(input);
+        result.insert(result.end(), bytes.begin(), bytes.end());
+    }
+    SerializeUint64(result, tx.outputs.size());
+    for (const auto& output : tx.outputs) {
+        auto bytes = ReferenceSerializeTxOut(output);
+        result.insert(result.end(), bytes.begin(), bytes.end());
+    }
+    SerializeUint64(result, tx.locktime);
+    result.insert(result.end(), tx.signature.begin(), tx.signature.end());
+    return result;
+}
+
+std::vector<uint8_t> ReferenceSerializeBlock(const Block& block) {
+    std::vector<uint8_t> result;
+    std::vector<uint8_t> header;
+    VectorWriter writer(header);
+    block.header.Serialize(writer);
+    result.insert(result.end(), header.begin(), header.end());
+    SerializeUint64(result, block.transactions.size());
+    for (const auto& tx : block.transactions) {
+        auto bytes = ReferenceSerializeTx(tx);
+        result.insert(result.end(), bytes.begin(), bytes.end());
+    }
+    return result;
+}
+
+std::vector<uint8_t> ReferenceSerializeSpentOutputs(const std::vector<SpentOutput>& spent_outputs) {
+    std::vector<uint8_t> result;
+    SerializeUint64(result, spent_outputs.size());
+    for (const auto& spent : spent_outputs) {
+        std::vector<uint8_t> record;
+        auto outpoint = spent.outpoint.Serialize();
+        record.insert(record.end(), outpoint.begin(), outpoint.end());
+        auto output = ReferenceSerializeTxOut(spent.output);
+        record.insert(record.end(), output.begin(), output.end());
+        result.insert(result.end(), record.begin(), record.end());
+    }
+    return result;
+}
+
+// ============================================================================
+// Synthetic Data
+// ============================================================================
+
+Script MakeScript(size_t len, uint8_t seed) {
+    std::vector<uint8_t> bytes(len);
+    for (size_t i = 0; i < len; i++) {
+        bytes[i] = static_cast<uint8_t>(seed + i);
+    }
+    return Script(bytes);
+}
+
+/// num_txs transactions with 2 inputs (P2PKH-sized script_sigs) and 2 outputs
+Block BuildSyntheticBlock(size_t num_txs) {
+    Block block;
+    block.header = BlockHeader{};
+    block.header.version = 1;
+    block.header.timestamp = 1735171200;
+    block.header.bits = 0x1d00ffff;
+    block.header.nonce = 42;
+    for (size_t t = 0; t < num_txs; t++) {
+        Transaction tx;
+        tx.signature = {};
+        for (size_t i = 0; i < 2; i++) {
+            TxIn input;
+            input.prev_tx_hash[0] = static_cast<uint8_t>(t);
+            input.prev_tx_hash[1] = static_cast<uint8_t>(t >> 8);
+            input.prev_tx_index = static_cast<uint32_t>(i);
+            input.script_sig = MakeScript(3 + DILITHIUM3_BYTES + 3 + DILITHIUM3_PUBLICKEYBYTES,
+                                          static_cast<uint8_t>(t + i));
+            tx.inputs.push_back(std::move(input));
+        }
+        tx.outputs.emplace_back(1000 + t, MakeScript(37, static_cast<uint8_t>(t)));
+        tx.outputs.emplace_back(2000 + t, MakeScript(37, static_cast<uint8_t>(t + 1)));
+        block.transactions.push_back(std::move(tx));
+    }
+    return block;
+}
+
+std::vector<SpentOutput> BuildSpentOutputs(const Block& block) {
+    std::vector<SpentOutput> spent_outputs;
+    for (const auto& tx : block.transactions) {
+        for (const auto& input : tx.inputs) {
+            SpentOutput spent;
+            spent.outpoint = OutPoint(input.prev_tx_hash, input.prev_tx_index);
+            spent.output = tx.outputs[0];
+            spent_outputs.push_back(std::move(spent));
+        }
+    }
+    return spent_outputs;
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+void BenchmarkBlock(const Block& block, uint64_t iterations) {
+    if (block.Serialize() != ReferenceSerializeBlock(block)) {
+        throw std::runtime_error("Block encodings differ");
+    }
+
+    RunBenchmark("Block encode (reference concat)", iterations, [&] {
+        return ReferenceSerializeBlock(block).size();
+    });
+    RunBenchmark("Block encode (exact size)", iterations, [&] {
+        return block.Serialize().size();
+    });
+
+    auto bytes = block.Serialize();
+    const uint256 merkle_root = block.CalculateMerkleRoot();
+    RunBenchmark("Block decode (SpanReader)", iterations, [&] {
+        auto result = Block::Deserialize(bytes);
+        if (result.IsError()) {
+            throw std::runtime_error("Block decode failed: " + result.error);
+        }
+        return bytes.size();
+    });
+    RunBenchmark("Block decode (views, arena)", iterations, [&] {
+        std::pmr::monotonic_buffer_resource arena(BlockView::ArenaSizeHint(bytes.size()));
+        BlockView view(&arena);
+        SpanReader reader(bytes);
+        auto result = view.Unserialize(reader);
+        if (result.IsError()) {
+            throw std::runtime_error("Block view decode failed: " + result.error);
+        }
+        return bytes.size();
+    });
+
+    // What a received block costs before it is accepted: decode + merkle check
+    RunBenchmark("Block receive (owning)", iterations, [&] {
+        auto result = Block::Deserialize(bytes);
+        if (result.IsError() || result.value->CalculateMerkleRoot() != merkle_root) {
+            throw std::runtime_error("Block check failed");
+        }
+        return bytes.size();
+    });
+    RunBenchmark("Block receive (views, arena)", iterations, [&] {
+        std::pmr::monotonic_buffer_resource arena(BlockView::ArenaSizeHint(bytes.size()));
+        BlockView view(&arena);
+        SpanReader reader(bytes);
+        if (view.Unserialize(reader).IsError() || view.CalculateMerkleRoot() != merkle_root) {
+            throw std::runtime_error("Block view check failed");
+        }
+        return bytes.size();
+    });
+
+    RunBenchmark("P2P block message (payload+wire)", iterations, [&] {
+        NetworkMessage msg(network::MAINNET_MAGIC, "block", block.Serialize());
+        return msg.Serialize().size();
+    });
+}
+
+void BenchmarkSpentOutputs(const std::vector<SpentOutput>& spent_outputs, uint64_t iterations) {
+    auto encode = [&] {
+        return SerializeExact([&](auto& s) {
+            SerializeUint64(s, static_cast<uint64_t>(spent_outputs.size()));
+            for (const auto& spent : spent_outputs) {
+                spent.Serialize(s);
+            }
+        });
+    };
+    if (encode() != ReferenceSerializeSpentOutputs(spent_outputs)) {
+        throw std::runtime_error("Undo record encodings differ");
+    }
+
+    RunBenchmark("Undo record encode (reference)", iterations, [&] {
+        return ReferenceSerializeSpentOutputs(spent_outputs).size();
+    });
+    RunBenchmark("Undo record encode (exact size)", iterations, [&] {
+        return encode().size();
+    });
+}
+
+void BenchmarkLightning(uint64_t iterations) {
+    bolt::OpenChannelMessage open{};
+    open.chain_hash = {};
+    open.temporary_channel_id = {};
+    open.funding_satoshis = 1000000;
+    open.push_msat = 0;
+    open.dust_limit_satoshis = 546;
+    open.max_htlc_value_in_flight_msat = 100000000;
+    open.channel_reserve_satoshis = 10000;
+    open.htlc_minimum_msat = 1000;
+    open.feerate_per_kw = 253;
+    open.to_self_delay = 144;
+    open.max_accepted_htlcs = 483;
+    open.channel_flags = 1;
+    open.tlv_records[1] = std::vector<uint8_t>(32, 0xAB);
+
+    RunBenchmark("Lightning open_channel encode", iterations, [&] {
+        return open.Serialize().size();
+    });
+
+    bolt::CommitmentSignedMessage commit{};
+    commit.channel_id = {};
+    commit.htlc_signatures.resize(10);
+
+    RunBenchmark("Lightning commitment_signed encode", iterations, [&] {
+        return commit.Serialize().size();
+    });
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "========================================" << std::endl;
+    std::cout << "  INTcoin Serialization" << std::endl;
+    std::cout << "  Performance Benchmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // ~11 KB per transaction: 500 transactions is a ~5.6 MB block
+    size_t num_txs = 500;
+    uint64_t iterations = 20;
+    if (argc > 1) num_txs = std::stoul(argv[1]);
+    if (argc > 2) iterations = std::stoull(argv[2]);
+
+    try {
+        std::cout << "\nBuilding synthetic block: " << num_txs << " txs..." << std::endl;
+        Block block = BuildSyntheticBlock(num_txs);
+        auto spent_outputs = BuildSpentOutputs(block);
+
+        std::cout << std::endl;
+        BenchmarkBlock(block, iterations);
+        BenchmarkSpentOutputs(spent_outputs, iterations * 50);
+        BenchmarkLightning(iterations * 500);
+
+        SaveBenchmarkCSV("serialization_benchmark_results.csv");
+
+        std::cout << "\n✓ All benchmarks completed successfully" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
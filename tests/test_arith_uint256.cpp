@@ -0,0 +1,238 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+//
+// 256-bit Target Arithmetic Test Suite
+
+#include "intcoin/arith_uint256.h"
+#include "intcoin/consensus.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+
+using namespace intcoin;
+
+// Compile-time checks: targets decode and re-encode without running anything
+static_assert(arith_uint256().SetCompact(0x1d00ffff) == arith_uint256(0xFFFF) << 208);
+static_assert(arith_uint256().SetCompact(0x03010000) == arith_uint256(0x010000));
+static_assert((arith_uint256(0xFFFF) << 208).GetCompact() == 0x1d00ffff);
+static_assert(consensus::POW_LIMIT.bits() == 255);
+
+// ============================================================================
+// Test 1: Compact Encoding
+// ============================================================================
+
+void TestCompactEncoding() {
+    std::cout << "\n=== Test 1: Compact Encoding ===" << std::endl;
+
+    bool negative = false;
+    bool overflow = false;
+
+    // Small exponents shift the mantissa right
+    arith_uint256 value;
+    value.SetCompact(0x01123456, &negative, &overflow);
+    assert(value == arith_uint256(0x12));
+    assert(!negative && !overflow);
+    assert(value.GetCompact() == 0x01120000);
+
+    value.SetCompact(0x02123456);
+    assert(value == arith_uint256(0x1234));
+    assert(value.GetCompact() == 0x02123400);
+
+    value.SetCompact(0x05009234);
+    assert(value == arith_uint256(0x92340000));
+    assert(value.GetCompact() == 0x05009234);
+
+    // Sign bit
+    value.SetCompact(0x04923456, &negative, &overflow);
+    assert(negative && !overflow);
+    value.SetCompact(0x01fedcba, &negative, &overflow);
+    assert(value == arith_uint256(0x7e));
+    assert(negative);
+    value.SetCompact(0x00923456, &negative, &overflow);
+    assert(value.IsZero());
+    assert(!negative);  // mantissa shifted out entirely
+
+    // Overflow past 256 bits
+    value.SetCompact(0xff123456, &negative, &overflow);
+    assert(overflow);
+    value.SetCompact(0x2100ff00, &negative, &overflow);
+    assert(!overflow);
+    value.SetCompact(0x21010000, &negative, &overflow);
+    assert(overflow);
+    value.SetCompact(0x21123456, &negative, &overflow);
+    assert(overflow);
+
+    // Zero
+    assert(arith_uint256().GetCompact() == 0);
+
+    // Round trip through the byte representation used by headers
+    for (uint32_t bits : {0x1d00ffffu, 0x1e0fffffu, 0x207fffffu, 0x03010000u, 0x1b0404cbu}) {
+        uint256 target = DifficultyCalculator::CompactToTarget(bits);
+        assert(DifficultyCalculator::TargetToCompact(target) == bits);
+        assert(UintToArith256(target) == arith_uint256().SetCompact(bits));
+        (void)target;
+    }
+
+    // Malformed encodings decode to zero
+    assert(DifficultyCalculator::CompactToArith(0x04923456).IsZero());
+    assert(DifficultyCalculator::CompactToArith(0x2100ff00).IsZero());
+
+    // Consensus decoding tests the sign bit after shifting short mantissas
+    // down, unlike SetCompact(); headers are validated with the former
+    assert(DifficultyCalculator::CompactToArith(0x02812300) == arith_uint256(0x8123));
+    assert(DifficultyCalculator::TargetToCompact(ArithToUint256(arith_uint256(0x8123))) == 0x02008123);
+
+    std::cout << "✓ Compact encode/decode matches reference values" << std::endl;
+}
+
+// ============================================================================
+// Test 2: Arithmetic
+// ============================================================================
+
+void TestArithmetic() {
+    std::cout << "\n=== Test 2: Arithmetic ===" << std::endl;
+
+    const arith_uint256 max = ~arith_uint256();
+
+    // Carries and borrows cross limbs
+    arith_uint256 a(UINT64_MAX);
+    a += 1;
+    assert(a == arith_uint256(1) << 64);
+    a -= 1;
+    assert(a == arith_uint256(UINT64_MAX));
+    assert(max + 1 == arith_uint256());
+    assert(arith_uint256() - 1 == max);
+
+    // Shifts
+    assert((arith_uint256(1) << 255).bits() == 256);
+    assert((arith_uint256(1) << 256).IsZero());
+    assert(((arith_uint256(0xABCD) << 100) >> 100) == arith_uint256(0xABCD));
+    assert((max >> 192) == arith_uint256(UINT64_MAX));
+
+    // Multiply wraps modulo 2^256
+    arith_uint256 b = (arith_uint256(1) << 128) + 3;
+    assert(b * b == (arith_uint256(6) << 128) + 9);
+    assert(max * max == arith_uint256(1));
+
+    // Division by 64-bit and wide divisors
+    assert((arith_uint256(1) << 200) / arith_uint256(1ULL << 40) == arith_uint256(1) << 160);
+    assert(max / max == arith_uint256(1));
+    assert((arith_uint256(5) << 130) / (arith_uint256(1) << 130) == arith_uint256(5));
+    assert(arith_uint256(7) / arith_uint256() == arith_uint256());
+
+    arith_uint256 c = (arith_uint256(1) << 100) + 17;
+    uint64_t rem = c.DivMod64(10);
+    assert(rem == 3);  // 2^100 ends in ...376
+    assert(c * 10 + rem == (arith_uint256(1) << 100) + 17);
+    (void)max;
+    (void)b;
+    (void)rem;
+
+    // q * d + r == n for random operands
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 1000; i++) {
+        arith_uint256 n;
+        arith_uint256 d;
+        for (int limb = 0; limb < 4; limb++) {
+            n = (n << 64) + rng();
+            d = (d << 64) + rng();
+        }
+        d >>= static_cast<unsigned>(rng() % 256);
+        if (d.IsZero()) continue;
+
+        arith_uint256 q = n / d;
+        arith_uint256 r = n - q * d;
+        assert(r < d);
+        (void)r;
+    }
+
+    std::cout << "✓ Add, subtract, multiply, divide and shift" << std::endl;
+}
+
+// ============================================================================
+// Test 3: Byte Conversion and Ordering
+// ============================================================================
+
+void TestConversionAndOrdering() {
+    std::cout << "\n=== Test 3: Byte Conversion and Ordering ===" << std::endl;
+
+    uint256 bytes{};
+    bytes[0] = 0x01;
+    bytes[8] = 0x02;
+    bytes[31] = 0x80;
+    arith_uint256 value = UintToArith256(bytes);
+    assert(value.GetLimb(0) == 1);
+    assert(value.GetLimb(1) == 2);
+    assert(value.GetLimb(3) == 0x8000000000000000ULL);
+    assert(ArithToUint256(value) == bytes);
+    (void)value;
+
+    // Limb comparison agrees with the most-significant-byte-first order
+    std::mt19937 rng(7);
+    for (int i = 0; i < 1000; i++) {
+        uint256 x{};
+        uint256 y{};
+        for (size_t j = 0; j < 32; j++) {
+            x[j] = static_cast<uint8_t>(rng());
+            y[j] = (j < 24) ? static_cast<uint8_t>(rng()) : x[j];  // often equal on top
+        }
+        int expected = 0;
+        for (int j = 31; j >= 0 && expected == 0; j--) {
+            if (x[j] != y[j]) expected = x[j] < y[j] ? -1 : 1;
+        }
+        assert(UintToArith256(x).CompareTo(UintToArith256(y)) == expected);
+    }
+
+    std::cout << "✓ Little-endian bytes map onto limbs" << std::endl;
+}
+
+// ============================================================================
+// Test 4: Proof of Work and Chain Work
+// ============================================================================
+
+void TestProofOfWork() {
+    std::cout << "\n=== Test 4: Proof of Work and Chain Work ===" << std::endl;
+
+    // Bitcoin's difficulty-1 block proof
+    assert(DifficultyCalculator::GetBlockWork(0x1d00ffff) == arith_uint256(0x0100010001ULL));
+
+    // At the proof-of-work limit (~2^255) each block is worth two hashes
+    assert(DifficultyCalculator::GetBlockWork(consensus::MIN_DIFFICULTY_BITS) == arith_uint256(2));
+    assert(DifficultyCalculator::GetBlockWork(0).IsZero());
+
+    // Halving the target doubles the difficulty
+    assert(DifficultyCalculator::GetDifficulty(consensus::MIN_DIFFICULTY_BITS) == 1.0);
+    uint32_t half_bits = (consensus::POW_LIMIT >> 1).GetCompact();
+    assert(std::fabs(DifficultyCalculator::GetDifficulty(half_bits) - 2.0) < 1e-6);
+    (void)half_bits;
+
+    // hash <= target passes, anything above fails
+    const uint32_t bits = 0x1e0fffff;
+    arith_uint256 target = DifficultyCalculator::CompactToArith(bits);
+    assert(DifficultyCalculator::CheckProofOfWork(ArithToUint256(target), bits));
+    assert(DifficultyCalculator::CheckProofOfWork(ArithToUint256(target - 1), bits));
+    assert(!DifficultyCalculator::CheckProofOfWork(ArithToUint256(target + 1), bits));
+    (void)target;
+
+    // Out-of-range exponents decode to zero and never pass
+    assert(!DifficultyCalculator::CheckProofOfWork(uint256{}, 0x2100ffff));
+
+    std::cout << "✓ Block work and PoW checks" << std::endl;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "INTcoin 256-bit Arithmetic Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestCompactEncoding();
+    TestArithmetic();
+    TestConversionAndOrdering();
+    TestProofOfWork();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "✓ All arithmetic tests passed!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
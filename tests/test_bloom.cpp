@@ -253,6 +253,51 @@ void TestBloomFilterEdgeCases() {
     std::cout << "✓ Edge cases handled correctly" << std::endl;
 }
 
+// Test 9: Rolling bloom filter
+void TestRollingBloomFilter() {
+    std::cout << "\nTest 9: Rolling Bloom Filter..." << std::endl;
+
+    auto element = [](uint32_t i) {
+        std::vector<uint8_t> data(32, 0);
+        data[0] = static_cast<uint8_t>(i);
+        data[1] = static_cast<uint8_t>(i >> 8);
+        data[2] = static_cast<uint8_t>(i >> 16);
+        return data;
+    };
+
+    RollingBloomFilter filter(1000, 0.001);
+    assert(filter.GetSize() > 0);
+
+    // The last 1000 insertions are always remembered
+    for (uint32_t i = 0; i < 5000; ++i) {
+        filter.Insert(element(i));
+    }
+    for (uint32_t i = 4000; i < 5000; ++i) {
+        assert(filter.Contains(element(i)));
+    }
+
+    // Anything older than 1.5x the capacity has rolled out (bar false positives)
+    uint32_t remembered_old = 0;
+    for (uint32_t i = 0; i < 3000; ++i) {
+        if (filter.Contains(element(i))) remembered_old++;
+    }
+    assert(remembered_old < 30);
+
+    // Never-inserted elements: false positive rate near the target
+    uint32_t false_positives = 0;
+    for (uint32_t i = 100000; i < 110000; ++i) {
+        if (filter.Contains(element(i))) false_positives++;
+    }
+    assert(false_positives < 50);
+
+    filter.Reset();
+    assert(!filter.Contains(element(4999)));
+
+    std::cout << "✓ Rolling bloom filter ages out old entries" << std::endl;
+    std::cout << "  - Old entries still matching: " << remembered_old << "/3000" << std::endl;
+    std::cout << "  - False positives: " << false_positives << "/10000" << std::endl;
+}
+
 // Main test runner
 int main() {
     std::cout << "========================================" << std::endl;
@@ -268,6 +313,7 @@ int main() {
         TestBloomFilterFalsePositiveRate();
         TestBloomFilterClear();
         TestBloomFilterEdgeCases();
+        TestRollingBloomFilter();
 
         std::cout << "\n========================================" << std::endl;
         std::cout << "All bloom filter tests passed! ✓" << std::endl;
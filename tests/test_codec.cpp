@@ -0,0 +1,378 @@
+// Copyright (c) 2026 The INTcoin Core developers
+// Distributed under the MIT software license
+//
+// Hex / Base58 / Bech32 Codec Test Suite
+
+#include "intcoin/codec.h"
+#include "intcoin/util.h"
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+using namespace intcoin;
+
+// ============================================================================
+// Reference Implementations (the byte-at-a-time code the codec replaced)
+// ============================================================================
+
+static const char* REFERENCE_BASE58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+std::string ReferenceHex(const std::vector<uint8_t>& data) {
+    static const char* digits = "0123456789abcdef";
+    std::string out;
+    for (uint8_t byte : data) {
+        out += digits[byte >> 4];
+        out += digits[byte & 0x0F];
+    }
+    return out;
+}
+
+std::string ReferenceBase58(const std::vector<uint8_t>& data) {
+    size_t leading_zeros = 0;
+    while (leading_zeros < data.size() && data[leading_zeros] == 0) {
+        leading_zeros++;
+    }
+    std::vector<uint8_t> b58(data.size() * 138 / 100 + 1);
+    for (uint8_t byte : data) {
+        int carry = byte;
+        for (size_t j = b58.size(); j > 0; j--) {
+            carry += 256 * b58[j - 1];
+            b58[j - 1] = carry % 58;
+            carry /= 58;
+        }
+    }
+    size_t start = 0;
+    while (start < b58.size() && b58[start] == 0) {
+        start++;
+    }
+    std::string out(leading_zeros, '1');
+    for (size_t i = start; i < b58.size(); i++) {
+        out += REFERENCE_BASE58[b58[i]];
+    }
+    return out;
+}
+
+std::vector<uint8_t> RandomBytes(std::mt19937& rng, size_t len) {
+    std::vector<uint8_t> data(len);
+    for (auto& byte : data) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    return data;
+}
+
+std::vector<uint8_t> FromString(const std::string& str) {
+    return std::vector<uint8_t>(str.begin(), str.end());
+}
+
+// ============================================================================
+// Test 1: Hex Round Trip
+// ============================================================================
+
+void TestHexRoundTrip() {
+    std::cout << "\n=== Test 1: Hex Round Trip ===" << std::endl;
+
+    std::mt19937 rng(1);
+
+    // Lengths straddle the 16- and 32-byte vector steps and the scalar tail
+    for (size_t len : {0, 1, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65, 100, 1000}) {
+        auto data = RandomBytes(rng, len);
+        std::string hex = codec::EncodeHex(data);
+        assert(hex == ReferenceHex(data));
+        assert(hex.size() == codec::HexEncodedSize(len));
+
+        std::vector<uint8_t> decoded;
+        assert(codec::DecodeHex(hex, decoded));
+        assert(decoded == data);
+
+        // Upper case decodes to the same bytes
+        std::string upper = hex;
+        std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+        decoded.clear();
+        assert(codec::DecodeHex(upper, decoded));
+        assert(decoded == data);
+    }
+
+    // Every byte value
+    std::vector<uint8_t> all(256);
+    for (size_t i = 0; i < all.size(); i++) {
+        all[i] = static_cast<uint8_t>(i);
+    }
+    assert(codec::EncodeHex(all) == ReferenceHex(all));
+
+    // uint256 helpers keep byte order
+    uint256 hash{};
+    hash[0] = 0xAB;
+    hash[31] = 0x01;
+    std::string hash_hex = ToHex(hash);
+    assert(hash_hex.substr(0, 2) == "ab" && hash_hex.substr(62) == "01");
+    assert(FromHex(hash_hex) == hash);
+    (void)hash_hex;
+
+    std::cout << "✓ Encode matches reference; decode inverts it" << std::endl;
+}
+
+// ============================================================================
+// Test 2: Hex Validation
+// ============================================================================
+
+void TestHexValidation() {
+    std::cout << "\n=== Test 2: Hex Validation ===" << std::endl;
+
+    std::vector<uint8_t> out;
+    assert(!codec::DecodeHex("abc", out));   // odd length
+    assert(!codec::DecodeHex("0x00", out));  // no prefix handling at this layer
+
+    // A bad character anywhere is caught, including inside vector-sized runs
+    const std::string valid(80, 'a');
+    for (size_t pos = 0; pos < valid.size(); pos++) {
+        for (char bad : {'g', 'G', ' ', '/', ':', '@', '`', '\0', '\xff'}) {
+            std::string hex = valid;
+            hex[pos] = bad;
+            assert(!codec::DecodeHex(hex, out));
+            assert(codec::FindInvalidHex(hex) == pos);
+        }
+    }
+    assert(codec::FindInvalidHex(valid) == valid.size());
+
+    // Fixed-size decode requires the exact length
+    uint8_t four[4];
+    assert(codec::DecodeHex("deadbeef", four));
+    assert(four[0] == 0xDE && four[3] == 0xEF);
+    (void)four;
+    assert(!codec::DecodeHex("deadbe", four));
+    assert(!codec::DecodeHex("deadbeef00", four));
+
+    // util.h wrappers keep their error messages
+    auto odd = HexToBytes("abc");
+    assert(odd.IsError() && odd.error == "Hex string must have even length");
+    auto bad = HexToBytes("00zz");
+    assert(bad.IsError() && bad.error == "Invalid hex character at position 2");
+    (void)odd;
+    (void)bad;
+
+    std::cout << "✓ Invalid input rejected at the right position" << std::endl;
+}
+
+// ============================================================================
+// Test 3: Base58
+// ============================================================================
+
+void TestBase58() {
+    std::cout << "\n=== Test 3: Base58 ===" << std::endl;
+
+    // Reference vectors from the Bitcoin test suite
+    struct Vector { std::vector<uint8_t> data; std::string encoded; };
+    const std::vector<Vector> vectors = {
+        {{}, ""},
+        {{0x61}, "2g"},
+        {{0x62, 0x62, 0x62}, "a3gV"},
+        {{0x63, 0x63, 0x63}, "aPEr"},
+        {FromString("simply a long string"), "2cFupjhnEsSn59qHXstmK2ffpLv2"},
+        {{0x00, 0xeb, 0x15, 0x23, 0x1d, 0xfc, 0xeb, 0x60, 0x92, 0x58, 0x86, 0xb6, 0x7d,
+          0x06, 0x52, 0x99, 0x92, 0x59, 0x15, 0xae, 0xb1, 0x72, 0xc0, 0x66, 0x47},
+         "1NS17iag9jJgTHD1VXjvLCEnZuQ3rJDE9L"},
+        {{0x51, 0x6b, 0x6f, 0xcd, 0x0f}, "ABnLTmg"},
+        {{0xbf, 0x4f, 0x89, 0x00, 0x1e, 0x67, 0x02, 0x74, 0xdd}, "3SEo3LWLoPntC"},
+        {{0x57, 0x2e, 0x47, 0x94}, "3EFU7m"},
+        {{0xec, 0xac, 0x89, 0xca, 0xd9, 0x39, 0x23, 0xc0, 0x23, 0x21}, "EJDM8drfXA6uyA"},
+        {{0x10, 0xc8, 0x51, 0x1e}, "Rt5zm"},
+        {std::vector<uint8_t>(10, 0x00), "1111111111"},
+    };
+    for (const auto& v : vectors) {
+        assert(codec::EncodeBase58(v.data) == v.encoded);
+        std::vector<uint8_t> decoded;
+        assert(codec::DecodeBase58(v.encoded, decoded));
+        assert(decoded == v.data);
+        (void)v;
+    }
+
+    // Random lengths (crossing the 4-byte / 5-digit limb boundaries), with
+    // and without leading zero bytes
+    std::mt19937 rng(3);
+    for (int i = 0; i < 500; i++) {
+        auto data = RandomBytes(rng, rng() % 80);
+        if (i % 3 == 0 && !data.empty()) {
+            std::fill_n(data.begin(), std::min<size_t>(data.size(), rng() % 4), 0);
+        }
+        std::string encoded = codec::EncodeBase58(data);
+        assert(encoded == ReferenceBase58(data));
+        assert(encoded.size() <= codec::Base58MaxEncodedSize(data.size()));
+
+        std::vector<uint8_t> decoded;
+        assert(codec::DecodeBase58(encoded, decoded));
+        assert(decoded == data);
+    }
+
+    // Characters outside the alphabet
+    std::vector<uint8_t> out;
+    for (const char* bad : {"0", "O", "I", "l", "3EF+7m", "3EFU7m "}) {
+        assert(!codec::DecodeBase58(bad, out));
+        (void)bad;
+    }
+    assert(codec::FindInvalidBase58("3EFU0m") == 4);
+
+    auto decode_error = Base58Decode("abc0");
+    assert(decode_error.IsError() && decode_error.error == "Invalid base58 character: 0");
+    (void)decode_error;
+
+    // Base58Check still round-trips on top of the new codec
+    std::vector<uint8_t> payload = {0x00, 0x01, 0x02, 0x03};
+    auto check = Base58CheckDecode(Base58CheckEncode(payload));
+    assert(check.IsOk() && *check.value == payload);
+    (void)check;
+
+    std::cout << "✓ Known vectors and reference cross-check" << std::endl;
+}
+
+// ============================================================================
+// Test 4: Bech32
+// ============================================================================
+
+void TestBech32() {
+    std::cout << "\n=== Test 4: Bech32 ===" << std::endl;
+
+    // BIP-173 valid checksums
+    for (const std::string& valid : std::vector<std::string>{
+             "A12UEL5L",
+             "a12uel5l",
+             "an83characterlonghumanreadablepartthatcontainsthenumber1andtheexcludedcharactersbio1tt5tgs",
+             "abcdef1qpzry9x8gf2tvdw0s3jn54khce6mua7lmqqqxw",
+             "11" + std::string(82, 'q') + "c8247j",
+             "split1checkupstagehandshakeupstreamerranterredcaperred2y9e3w",
+             "?1ezyfcl"}) {
+        std::string hrp;
+        std::vector<uint8_t> words;
+        auto result = codec::DecodeBech32Words(valid, hrp, words);
+        assert(result.IsOk());
+
+        std::string lower = valid;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        assert(codec::EncodeBech32Words(hrp, words) == lower);
+        (void)result;
+    }
+
+    // BIP-173 invalid strings, each for a specific reason
+    struct Invalid { std::string encoded; std::string error; };
+    const std::vector<Invalid> invalid = {
+        {std::string("\x20") + "1nwldj5", "Invalid character in Bech32 string"},
+        {std::string("\x7f") + "1axkwrx", "Invalid character in Bech32 string"},
+        {"pzry9x0s0muk", "No separator found in Bech32 string"},
+        {"1pzry9x0s0muk", "No separator found in Bech32 string"},
+        {"x1b4n0q5v", "Invalid character in Bech32 string"},
+        {"li1dgmt3", "Bech32 string too short"},
+        {"de1lg7wt\xff", "Invalid character in Bech32 string"},
+        {"A1G7SGD8", "Invalid checksum"},
+        {"a12UEL5L", "Mixed case in Bech32 string"},
+    };
+    for (const auto& v : invalid) {
+        std::string hrp;
+        std::vector<uint8_t> words;
+        auto result = codec::DecodeBech32Words(v.encoded, hrp, words);
+        assert(result.IsError() && result.error == v.error);
+        (void)result;
+    }
+
+    // Every single-character substitution breaks the checksum
+    std::mt19937 rng(4);
+    auto payload = RandomBytes(rng, 33);
+    std::string encoded = codec::EncodeBech32("int", payload);
+    assert(encoded.size() == codec::Bech32EncodedSize(3, payload.size()));
+    for (size_t pos = 4; pos < encoded.size(); pos++) {
+        std::string corrupted = encoded;
+        corrupted[pos] = (corrupted[pos] == 'q') ? 'p' : 'q';
+        std::string hrp;
+        std::vector<uint8_t> data;
+        assert(codec::DecodeBech32(corrupted, hrp, data).IsError());
+    }
+
+    // 8-bit payloads of every length round-trip; non-zero padding is rejected
+    for (size_t len = 0; len <= 64; len++) {
+        auto data = RandomBytes(rng, len);
+        std::string hrp;
+        std::vector<uint8_t> decoded;
+        assert(codec::DecodeBech32(codec::EncodeBech32("lint", data), hrp, decoded).IsOk());
+        assert(hrp == "lint" && decoded == data);
+    }
+    std::vector<uint8_t> padded_words = {0, 1};  // 10 bits, 2 non-zero padding bits
+    std::string hrp;
+    std::vector<uint8_t> data;
+    auto padding = codec::DecodeBech32(codec::EncodeBech32Words("a", padded_words), hrp, data);
+    assert(padding.IsError() && padding.error == "Invalid padding in Bech32 data");
+    (void)padding;
+
+    // Out-of-range words cannot be encoded
+    std::vector<uint8_t> bad_words = {31, 32};
+    assert(codec::EncodeBech32Words("a", bad_words).empty());
+
+    // util.h wrappers agree with the codec
+    auto util_decoded = Bech32Decode(Bech32Encode("int", payload));
+    assert(util_decoded.IsOk() && util_decoded.value->first == "int");
+    assert(util_decoded.value->second == payload);
+    (void)util_decoded;
+
+    std::cout << "✓ BIP-173 vectors, checksum and padding checks" << std::endl;
+}
+
+// ============================================================================
+// Test 5: Fixed-Buffer Encoders
+// ============================================================================
+
+void TestToChars() {
+    std::cout << "\n=== Test 5: Fixed-Buffer Encoders ===" << std::endl;
+
+    std::mt19937 rng(5);
+    auto data = RandomBytes(rng, 40);
+
+    // Exact-size buffers succeed and report where they stopped
+    char buf[200];
+    auto hex = codec::HexToChars(buf, buf + 80, data);
+    assert(hex.ec == std::errc{} && hex.ptr == buf + 80);
+    assert(std::string(buf, 80) == codec::EncodeHex(data));
+
+    auto b58 = codec::Base58ToChars(buf, buf + sizeof(buf), data);
+    assert(b58.ec == std::errc{});
+    assert(std::string(buf, b58.ptr) == codec::EncodeBase58(data));
+
+    const size_t bech_len = codec::Bech32EncodedSize(3, data.size());
+    auto bech = codec::Bech32ToChars(buf, buf + bech_len, "int", data);
+    assert(bech.ec == std::errc{} && bech.ptr == buf + bech_len);
+    assert(std::string(buf, bech_len) == codec::EncodeBech32("int", data));
+
+    // One byte short is reported, never overrun
+    char guard[200];
+    std::memset(guard, 'Z', sizeof(guard));
+    assert(codec::HexToChars(guard, guard + 79, data).ec == std::errc::value_too_large);
+    assert(guard[79] == 'Z');
+    assert(codec::Bech32ToChars(guard, guard + bech_len - 1, "int", data).ec ==
+           std::errc::value_too_large);
+    assert(guard[bech_len - 1] == 'Z');
+    const size_t b58_len = static_cast<size_t>(b58.ptr - buf);
+    assert(codec::Base58ToChars(guard, guard + b58_len - 1, data).ec ==
+           std::errc::value_too_large);
+    assert(guard[b58_len - 1] == 'Z');
+    (void)hex;
+    (void)bech;
+    (void)b58_len;
+
+    std::cout << "✓ Output fits exactly or reports value_too_large" << std::endl;
+}
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "INTcoin Codec Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestHexRoundTrip();
+    TestHexValidation();
+    TestBase58();
+    TestBech32();
+    TestToChars();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "✓ All codec tests passed!" << std::endl;
+    std::cout << "========================================" << std::endl;
+    return 0;
+}
@@ -5,9 +5,11 @@
 
 #include "intcoin/crypto.h"
 #include "intcoin/types.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <openssl/evp.h>
 
 using namespace intcoin;
 
@@ -222,18 +224,208 @@ bool test_kyber_encap_decap() {
     return secrets_match && secret_nonzero;
 }
 
+// Test 6: Signature Cache
+bool test_signature_cache() {
+    print_test_header("Test 6: Signature Cache");
+
+    auto keygen_result = DilithiumCrypto::GenerateKeyPair();
+    if (keygen_result.IsError()) {
+        std::cout << "Key generation failed: " << keygen_result.error << std::endl;
+        return false;
+    }
+    auto keypair = *keygen_result.value;
+
+    uint256 hash = SHA3::Hash(std::vector<uint8_t>{'s', 'i', 'g', 'c', 'a', 'c', 'h', 'e'});
+    auto sign_result = DilithiumCrypto::SignHash(hash, keypair.secret_key);
+    if (sign_result.IsError()) {
+        std::cout << "Signing failed: " << sign_result.error << std::endl;
+        return false;
+    }
+    auto signature = *sign_result.value;
+
+    SignatureCache& cache = SignatureCache::Instance();
+    cache.Clear();
+
+    // First verification populates the cache, second is a hit
+    bool first_ok = DilithiumCrypto::VerifyHashCached(hash, signature, keypair.public_key).IsOk();
+    bool cached = cache.Contains(hash, signature, keypair.public_key);
+    bool second_ok = DilithiumCrypto::VerifyHashCached(hash, signature, keypair.public_key).IsOk();
+    print_result("Valid signature cached after verification", first_ok && cached && second_ok);
+
+    // A precomputed entry finds the same verification
+    uint256 entry = cache.ComputeEntry(hash, signature, keypair.public_key);
+    bool entry_cached = cache.Contains(entry);
+    print_result("Precomputed entry matches cached verification", entry_cached);
+
+    // Invalid signatures are never cached
+    Signature bad_signature = signature;
+    bad_signature[0] ^= 0xFF;
+    bool bad_rejected = DilithiumCrypto::VerifyHashCached(hash, bad_signature, keypair.public_key).IsError();
+    bool bad_not_cached = !cache.Contains(hash, bad_signature, keypair.public_key);
+    print_result("Invalid signature rejected and not cached", bad_rejected && bad_not_cached);
+
+    // Memory budget bounds the number of entries
+    SignatureCache small(SignatureCache::ENTRY_BYTES * SignatureCache::NUM_STRIPES);
+    for (uint8_t i = 0; i < 64; i++) {
+        uint256 h{};
+        h[0] = i;
+        small.Insert(h, signature, keypair.public_key);
+    }
+    auto stats = small.GetStats();
+    bool bounded = stats.entries <= SignatureCache::NUM_STRIPES && stats.evictions > 0;
+    print_result("Memory budget enforced", bounded);
+
+    return first_ok && cached && second_ok && entry_cached && bad_rejected && bad_not_cached && bounded;
+}
+
+/// Reference SHA3-256 straight from OpenSSL
+uint256 OpenSSLSHA3(const uint8_t* data, size_t len) {
+    uint256 result{};
+    unsigned int result_len = 0;
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    EVP_DigestInit_ex(ctx, EVP_sha3_256(), nullptr);
+    EVP_DigestUpdate(ctx, data, len);
+    EVP_DigestFinal_ex(ctx, result.data(), &result_len);
+    EVP_MD_CTX_free(ctx);
+    return result;
+}
+
+// Test 7: Native SHA3-256 (single, incremental and batch)
+bool test_sha3_native() {
+    print_test_header("Test 7: Native SHA3-256 (single, incremental and batch)");
+    std::cout << "Batch kernel: " << SHA3::GetBatchImplementation() << std::endl;
+
+    // Cross-check the in-tree Keccak against OpenSSL across the 136-byte
+    // rate boundaries, one-shot and fed in uneven pieces
+    bool single_ok = true;
+    bool incremental_ok = true;
+    std::vector<uint8_t> data(400);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    for (size_t len = 0; len <= data.size(); len++) {
+        uint256 reference = OpenSSLSHA3(data.data(), len);
+        if (SHA3::Hash(data.data(), len) != reference) {
+            std::cout << "Mismatch at length " << len << std::endl;
+            single_ok = false;
+            break;
+        }
+
+        SHA3Hasher hasher;
+        for (size_t pos = 0, step = 1; pos < len; pos += step, step = step * 3 % 101) {
+            hasher.Write(data.data() + pos, std::min(step, len - pos));
+        }
+        if (hasher.Finalize() != reference) {
+            std::cout << "Incremental mismatch at length " << len << std::endl;
+            incremental_ok = false;
+            break;
+        }
+    }
+    print_result("Native SHA3-256 matches OpenSSL (0-400 bytes)", single_ok);
+    print_result("Incremental SHA3-256 matches OpenSSL", incremental_ok);
+
+    // Batches of every size up to 19 (covers 8-way, 4-way and scalar tails)
+    bool batch_ok = true;
+    for (size_t len : {32, 64, 136, 200}) {
+        for (size_t count = 0; count < 20; count++) {
+            std::vector<uint8_t> messages(len * count);
+            for (size_t i = 0; i < messages.size(); i++) {
+                messages[i] = static_cast<uint8_t>(i ^ (i >> 7) ^ len);
+            }
+            std::vector<uint256> out(count);
+            SHA3::HashBatch(messages.data(), len, count, out.data());
+            for (size_t i = 0; i < count; i++) {
+                if (out[i] != SHA3::Hash(messages.data() + i * len, len)) {
+                    batch_ok = false;
+                }
+            }
+        }
+    }
+    print_result("Batch SHA3-256 matches single hashing", batch_ok);
+
+    return single_ok && incremental_ok && batch_ok;
+}
+
+bool test_batch_sign_verify() {
+    print_test_header("Test 8: Batch Sign & Verify");
+
+    auto keypair_a = DilithiumCrypto::GenerateKeyPair();
+    auto keypair_b = DilithiumCrypto::GenerateKeyPair();
+    if (keypair_a.IsError() || keypair_b.IsError()) {
+        std::cout << "Key generation failed" << std::endl;
+        return false;
+    }
+    const auto& keys_a = *keypair_a.value;
+    const auto& keys_b = *keypair_b.value;
+
+    // Enough items to spread over several threads, alternating keys
+    const size_t count = 24;
+    std::vector<DilithiumCrypto::SignRequest> requests(count);
+    for (size_t i = 0; i < count; i++) {
+        requests[i].hash = SHA3::Hash(std::vector<uint8_t>{static_cast<uint8_t>(i)});
+        requests[i].secret_key = (i % 2 == 0) ? &keys_a.secret_key : &keys_b.secret_key;
+    }
+
+    auto signatures = DilithiumCrypto::BatchSign(requests);
+    bool sign_ok = signatures.size() == count;
+    for (size_t i = 0; sign_ok && i < count; i++) {
+        const PublicKey& pubkey = (i % 2 == 0) ? keys_a.public_key : keys_b.public_key;
+        sign_ok = signatures[i].IsOk() &&
+                  DilithiumCrypto::VerifyHash(requests[i].hash, *signatures[i].value, pubkey).IsOk();
+    }
+    print_result("Batch signatures verify individually", sign_ok);
+
+    // A corrupted signature in the middle fails on its own; the rest pass
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<Signature> batch_signatures;
+    std::vector<PublicKey> public_keys;
+    for (size_t i = 0; sign_ok && i < count; i++) {
+        messages.emplace_back(requests[i].hash.begin(), requests[i].hash.end());
+        batch_signatures.push_back(*signatures[i].value);
+        public_keys.push_back((i % 2 == 0) ? keys_a.public_key : keys_b.public_key);
+    }
+    const size_t bad_index = count / 2;
+    if (sign_ok) {
+        batch_signatures[bad_index][0] ^= 0xFF;
+    }
+
+    auto results = DilithiumCrypto::BatchVerify(messages, batch_signatures, public_keys);
+    bool verify_ok = sign_ok && results.size() == count;
+    for (size_t i = 0; verify_ok && i < count; i++) {
+        verify_ok = results[i].IsOk() == (i != bad_index);
+    }
+    print_result("Batch verify reports each item", verify_ok);
+
+    // Mismatched inputs fail every item; a missing key fails only its own
+    public_keys.pop_back();
+    auto mismatched = DilithiumCrypto::BatchVerify(messages, batch_signatures, public_keys);
+    bool mismatch_ok = mismatched.size() == messages.size() &&
+                       std::all_of(mismatched.begin(), mismatched.end(),
+                                   [](const Result<void>& r) { return r.IsError(); });
+    requests[1].secret_key = nullptr;
+    auto partial = DilithiumCrypto::BatchSign(requests);
+    mismatch_ok = mismatch_ok && partial[1].IsError() && partial[0].IsOk() && partial[2].IsOk() &&
+                  DilithiumCrypto::BatchSign({}).empty();
+    print_result("Invalid requests fail per item", mismatch_ok);
+
+    return sign_ok && verify_ok && mismatch_ok;
+}
+
 int main() {
     std::cout << "INTcoin Cryptography Test Suite\n";
     std::cout << "Testing: SHA3-256, Dilithium3 (ML-DSA-65), Kyber768 (ML-KEM-768)\n";
 
     int passed = 0;
-    int total = 5;
+    int total = 8;
 
     if (test_sha3()) passed++;
     if (test_dilithium_keygen()) passed++;
     if (test_dilithium_sign_verify()) passed++;
     if (test_kyber_keygen()) passed++;
     if (test_kyber_encap_decap()) passed++;
+    if (test_signature_cache()) passed++;
+    if (test_sha3_native()) passed++;
+    if (test_batch_sign_verify()) passed++;
 
     std::cout << "\n========================================\n";
     std::cout << "FINAL RESULTS: " << passed << "/" << total << " tests passed\n";
@@ -9,11 +9,14 @@
 #include "intcoin/mempool.h"
 #include "intcoin/blockchain.h"
 #include "intcoin/crypto.h"
+#include "intcoin/contracts/transaction.h"
 #include <iostream>
 #include <cassert>
 #include <thread>
 #include <chrono>
 #include <random>
+#include <atomic>
+#include <set>
 
 using namespace intcoin;
 
@@ -59,6 +62,29 @@ Transaction CreateTestTransaction(uint64_t fee, size_t num_inputs = 1, size_t nu
     return tx;
 }
 
+// Helper function to create a transaction spending an output of parent
+Transaction CreateChildTransaction(const Transaction& parent, uint32_t output_index) {
+    Transaction tx = CreateTestTransaction(1000);
+    tx.inputs[0].prev_tx_hash = parent.GetHash();
+    tx.inputs[0].prev_tx_index = output_index;
+    return tx;
+}
+
+// Helper function to create a contract call from sender (a key filled with one byte)
+Transaction CreateContractCall(uint8_t sender, uint64_t nonce, uint64_t gas_limit, uint64_t gas_price) {
+    contracts::ContractCallTx call;
+    call.from.fill(sender);
+    call.nonce = nonce;
+    call.to = "int1contract";
+    call.gas_limit = gas_limit;
+    call.gas_price = gas_price;
+
+    Transaction tx = CreateTestTransaction(0);
+    tx.type = TxType::CONTRACT_CALL;
+    tx.contract_data = call.Serialize();
+    return tx;
+}
+
 // Test 1: Basic initialization
 void TestMempoolInitialization() {
     std::cout << "Test 1: Mempool Initialization..." << std::endl;
@@ -93,6 +119,7 @@ void TestAddTransactions() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 1000;
     config.priority_limits[TxPriority::HIGH] = 500;
 
@@ -126,6 +153,7 @@ void TestFeePrioritization() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 1000;
 
     INTcoinMempool mempool;
@@ -154,6 +182,7 @@ void TestRemoveTransaction() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 1000;
 
     INTcoinMempool mempool;
@@ -184,6 +213,7 @@ void TestBlockTemplateGeneration() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::CRITICAL] = 100;
     config.priority_limits[TxPriority::BRIDGE] = 100;
     config.priority_limits[TxPriority::HTLC] = 100;
@@ -217,6 +247,7 @@ void TestTransactionExpiry() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.expiry_hours = 0;  // Expire immediately for testing
     config.priority_limits[TxPriority::NORMAL] = 1000;
 
@@ -247,49 +278,84 @@ void TestMempoolPersistence() {
 
     const std::string persist_path = "/tmp/test_mempool.dat";
 
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_file = persist_path;
+    config.persist_on_shutdown = false;  // Persist and restore explicitly
+    config.priority_limits[TxPriority::NORMAL] = 1000;
+    config.priority_limits[TxPriority::HIGH] = 500;
+    config.priority_limits[TxPriority::BRIDGE] = 500;
+
+    Transaction parent = CreateTestTransaction(5000);
+    Transaction child = CreateChildTransaction(parent, 1);
+    Transaction bridge_tx = CreateTestTransaction(10000);
+    std::time_t parent_time = 0;
+
     // Create mempool and add transactions
     {
-        MempoolConfig config;
-        config.max_size_mb = 100;
-        config.persist_file = persist_path;
-        config.persist_on_shutdown = true;
-        config.priority_limits[TxPriority::NORMAL] = 1000;
-        config.priority_limits[TxPriority::HIGH] = 500;
-
         INTcoinMempool mempool;
         mempool.Initialize(config);
 
-        mempool.AddTransaction(CreateTestTransaction(5000), TxPriority::NORMAL);
-        mempool.AddTransaction(CreateTestTransaction(10000), TxPriority::HIGH);
+        // Insert the child's parent last to check dependency order on load
+        mempool.AddTransaction(bridge_tx, TxPriority::BRIDGE);
+        mempool.AddTransaction(parent, TxPriority::NORMAL);
+        mempool.AddTransaction(child, TxPriority::NORMAL);
+        auto prioritise_result = mempool.PrioritiseTransaction(child.GetHash(), 5000);
+        assert(prioritise_result.IsOk());
+        parent_time = mempool.GetEntry(parent.GetHash()).GetValue().added_time;
 
         auto result = mempool.Persist();
         assert(result.IsOk());
 
-        std::cout << "  - Persisted 2 transactions to disk" << std::endl;
+        std::cout << "  - Persisted 3 transactions to disk" << std::endl;
     }
 
     // Create new mempool and restore
     {
-        MempoolConfig config;
-        config.max_size_mb = 100;
-        config.persist_file = persist_path;
-        config.persist_on_shutdown = false;  // Disable auto-restore in Initialize()
-        config.priority_limits[TxPriority::NORMAL] = 1000;
-        config.priority_limits[TxPriority::HIGH] = 500;
-
         INTcoinMempool mempool;
         mempool.Initialize(config);
 
         auto result = mempool.Restore();
         assert(result.IsOk());
 
-        // Note: Persist/Restore are placeholder implementations
-        // They write/read headers but don't actually serialize transactions
-        // TODO: Implement proper serialization in future enhancement
         auto stats = mempool.GetStats();
-        (void)stats;  // Placeholder implementation doesn't actually restore
+        assert(stats.total_transactions == 3);
+
+        auto parent_entry = mempool.GetEntry(parent.GetHash()).GetValue();
+        assert(parent_entry.added_time == parent_time);
+        assert(parent_entry.descendant_count == 2);
+        assert(parent_entry.descendant_fees == 2 * parent_entry.fee + 5000);
+        auto child_entry = mempool.GetEntry(child.GetHash()).GetValue();
+        assert(child_entry.fee_delta == 5000);
+        assert(child_entry.ancestor_count == 2);
+        assert(mempool.GetEntry(bridge_tx.GetHash()).GetValue().priority == TxPriority::BRIDGE);
+
+        std::cout << "  - Restored transactions, entry times and fee deltas" << std::endl;
+    }
 
-        std::cout << "  - Restore completed (placeholder implementation)" << std::endl;
+    // Revalidation drops transactions with missing inputs, and their children.
+    // The lookup consults the mempool too, as a node's would: Restore must
+    // call it without holding the mempool lock.
+    {
+        INTcoinMempool mempool;
+        mempool.Initialize(config);
+
+        const uint256 missing = parent.inputs[0].prev_tx_hash;
+        mempool.SetCoinLookup([&mempool, missing](const OutPoint& outpoint) -> std::optional<TxOut> {
+            if (outpoint.tx_hash == missing || mempool.HasTransaction(outpoint.tx_hash)) return std::nullopt;
+            TxOut coin;
+            coin.value = 1000000;
+            return coin;
+        });
+
+        auto result = mempool.Restore();
+        assert(result.IsOk());
+
+        assert(mempool.GetStats().total_transactions == 1);
+        assert(mempool.HasTransaction(bridge_tx.GetHash()));
+        assert(!mempool.HasTransaction(child.GetHash()));
+
+        std::cout << "  - Revalidation dropped an unspendable package" << std::endl;
     }
 
     // Cleanup
@@ -304,6 +370,7 @@ void TestStatsTracking() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 1000;
     config.priority_limits[TxPriority::HIGH] = 500;
     config.priority_limits[TxPriority::HTLC] = 100;
@@ -336,6 +403,7 @@ void TestEvictionPolicy() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 5;  // Low limit to trigger eviction
 
     INTcoinMempool mempool;
@@ -366,6 +434,7 @@ void TestPriorityUpgrade() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 1000;
     config.priority_limits[TxPriority::HIGH] = 1000;
 
@@ -392,6 +461,7 @@ void TestClearMempool() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 1000;
 
     INTcoinMempool mempool;
@@ -421,6 +491,7 @@ void TestThreadSafety() {
 
     MempoolConfig config;
     config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
     config.priority_limits[TxPriority::NORMAL] = 10000;
     config.priority_limits[TxPriority::HIGH] = 10000;
 
@@ -454,6 +525,633 @@ void TestThreadSafety() {
               << " transactions added concurrently)" << std::endl;
 }
 
+// Test 13: Ancestor/descendant package tracking
+void TestPackageTracking() {
+    std::cout << "\nTest 13: Ancestor/Descendant Packages..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+    config.max_ancestor_count = 3;
+    config.priority_limits[TxPriority::NORMAL] = 1000;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    // grandparent -> parent -> child, plus a sibling of parent
+    Transaction grandparent = CreateTestTransaction(1000);
+    Transaction parent = CreateChildTransaction(grandparent, 0);
+    Transaction sibling = CreateChildTransaction(grandparent, 1);
+    Transaction child = CreateChildTransaction(parent, 0);
+    for (const auto* tx : {&grandparent, &parent, &sibling, &child}) {
+        auto add_result = mempool.AddTransaction(*tx, TxPriority::NORMAL);
+        assert(add_result.IsOk());
+    }
+
+    auto gp_entry = mempool.GetEntry(grandparent.GetHash()).GetValue();
+    assert(gp_entry.ancestor_count == 1);
+    assert(gp_entry.descendant_count == 4);
+    assert(gp_entry.descendant_size == 4 * gp_entry.size_bytes);
+    assert(gp_entry.descendant_fees == 4 * gp_entry.fee);
+    assert(gp_entry.depended_by.size() == 2);
+
+    auto child_entry = mempool.GetEntry(child.GetHash()).GetValue();
+    assert(child_entry.ancestor_count == 3);
+    assert(child_entry.ancestor_size == 3 * child_entry.size_bytes);
+    assert(child_entry.descendant_count == 1);
+
+    // A fourth generation exceeds max_ancestor_count
+    Transaction grandchild = CreateChildTransaction(child, 0);
+    auto limit_result = mempool.AddTransaction(grandchild, TxPriority::NORMAL);
+    assert(limit_result.IsError());
+
+    // Templates always place parents before their children
+    for (uint64_t max_count : {0, 1, 2, 3}) {
+        auto template_txs = mempool.GetBlockTemplate(1000000, max_count);
+        assert(max_count == 0 ? template_txs.size() == 4 : template_txs.size() <= max_count);
+
+        std::set<uint256> seen;
+        for (const auto& tx : template_txs) {
+            for (const auto& input : tx.inputs) {
+                bool in_mempool = mempool.HasTransaction(input.prev_tx_hash);
+                assert(!in_mempool || seen.count(input.prev_tx_hash) == 1);
+            }
+            seen.insert(tx.GetHash());
+        }
+    }
+
+    // Confirming the grandparent shrinks every descendant's ancestor package
+    auto removed = mempool.RemoveConfirmedTransactions({grandparent.GetHash()});
+    assert(removed.IsOk() && removed.GetValue() == 1);
+
+    auto parent_entry = mempool.GetEntry(parent.GetHash()).GetValue();
+    assert(parent_entry.ancestor_count == 1);
+    assert(parent_entry.descendant_count == 2);
+    assert(parent_entry.depends_on.empty());
+    child_entry = mempool.GetEntry(child.GetHash()).GetValue();
+    assert(child_entry.ancestor_count == 2);
+    assert(child_entry.ancestor_size == 2 * child_entry.size_bytes);
+
+    // With room in the chain again, the grandchild is accepted
+    auto add_result = mempool.AddTransaction(grandchild, TxPriority::NORMAL);
+    assert(add_result.IsOk());
+    parent_entry = mempool.GetEntry(parent.GetHash()).GetValue();
+    assert(parent_entry.descendant_count == 3);
+
+    // Removing a middle transaction detaches its children
+    auto remove_result = mempool.RemoveTransaction(child.GetHash());
+    assert(remove_result.IsOk());
+    parent_entry = mempool.GetEntry(parent.GetHash()).GetValue();
+    assert(parent_entry.descendant_count == 1);
+    assert(parent_entry.depended_by.empty());
+    auto grandchild_entry = mempool.GetEntry(grandchild.GetHash()).GetValue();
+    assert(grandchild_entry.ancestor_count == 1);
+    assert(grandchild_entry.depends_on.empty());
+
+    std::cout << "✓ Package aggregates maintained across add and remove" << std::endl;
+}
+
+// Test 14: Size trimming by descendant feerate
+void TestTrimToSize() {
+    std::cout << "\nTest 14: Trim To Size..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+    config.priority_limits[TxPriority::NORMAL] = 1000;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    // Five unrelated transactions with rising fee deltas, plus a cheap
+    // parent whose child pays for both (CPFP)
+    std::vector<uint256> singles;
+    for (int i = 0; i < 5; ++i) {
+        Transaction tx = CreateTestTransaction(1000);
+        mempool.AddTransaction(tx, TxPriority::NORMAL);
+        mempool.PrioritiseTransaction(tx.GetHash(), 100 * (i + 1));
+        singles.push_back(tx.GetHash());
+    }
+    Transaction parent = CreateTestTransaction(1000);
+    Transaction child = CreateChildTransaction(parent, 0);
+    mempool.AddTransaction(parent, TxPriority::NORMAL);
+    mempool.AddTransaction(child, TxPriority::NORMAL);
+    mempool.PrioritiseTransaction(child.GetHash(), 10000);
+
+    auto stats = mempool.GetStats();
+    assert(stats.total_transactions == 7);
+    const uint64_t entry_size = stats.total_size_bytes / 7;
+    assert(stats.memory_usage_bytes > stats.total_size_bytes);
+    assert(stats.rolling_min_fee_per_kb == 0);
+
+    // Trimming to four entries evicts the three cheapest singles
+    auto trim_result = mempool.TrimToSize(4 * entry_size);
+    assert(trim_result.IsOk() && trim_result.GetValue() == 3);
+    for (int i = 0; i < 5; ++i) {
+        assert(mempool.HasTransaction(singles[i]) == (i >= 3));
+    }
+    assert(mempool.HasTransaction(parent.GetHash()));
+    assert(mempool.HasTransaction(child.GetHash()));
+
+    // Totals track the removals without rescanning
+    stats = mempool.GetStats();
+    assert(stats.total_transactions == 4);
+    assert(stats.total_size_bytes == 4 * entry_size);
+    assert(stats.total_fees == 4 * (stats.total_size_bytes / 4 * config.min_relay_fee_per_kb / 1000));
+
+    // The floor now sits above the best evicted package, so a transaction
+    // paying only the static relay fee is refused
+    assert(stats.rolling_min_fee_per_kb > config.min_relay_fee_per_kb);
+    assert(mempool.GetMinFeePerKb() == stats.rolling_min_fee_per_kb);
+    auto add_result = mempool.AddTransaction(CreateTestTransaction(1000), TxPriority::NORMAL);
+    assert(add_result.IsError());
+
+    // Packages leave together: the parent is never evicted ahead of its child
+    trim_result = mempool.TrimToSize(2 * entry_size);
+    assert(trim_result.IsOk() && trim_result.GetValue() == 2);
+    assert(mempool.HasTransaction(parent.GetHash()));
+    assert(mempool.HasTransaction(child.GetHash()));
+
+    trim_result = mempool.TrimToSize(entry_size);
+    assert(trim_result.IsOk() && trim_result.GetValue() == 2);
+    assert(mempool.GetStats().total_size_bytes == 0);
+
+    // Sizes are the serialized sizes, so transactions of different shapes
+    // count for different amounts when trimming
+    INTcoinMempool sized;
+    sized.Initialize(config);
+    Transaction large = CreateTestTransaction(1000, 20, 2);
+    Transaction small_a = CreateTestTransaction(1000);
+    Transaction small_b = CreateTestTransaction(1000);
+    for (const Transaction* tx : {&large, &small_a, &small_b}) {
+        sized.AddTransaction(*tx, TxPriority::NORMAL);
+        assert(sized.GetEntry(tx->GetHash()).GetValue().size_bytes == tx->GetSerializedSize());
+    }
+    const uint64_t large_size = large.GetSerializedSize();
+    const uint64_t small_size = small_a.GetSerializedSize();
+    assert(large_size > small_size);
+    assert(sized.GetStats().total_size_bytes == large_size + 2 * small_size);
+
+    // Cheapest first: the small ones go, one at a time, until it fits
+    sized.PrioritiseTransaction(large.GetHash(), 100000);
+    trim_result = sized.TrimToSize(large_size + small_size);
+    assert(trim_result.IsOk() && trim_result.GetValue() == 1);
+    assert(sized.GetStats().total_size_bytes == large_size + small_size);
+
+    // Once the large one is cheapest, evicting it alone is enough
+    sized.PrioritiseTransaction(large.GetHash(), -200000);
+    trim_result = sized.TrimToSize(large_size);
+    assert(trim_result.IsOk() && trim_result.GetValue() == 1);
+    assert(!sized.HasTransaction(large.GetHash()));
+    assert(sized.GetStats().total_size_bytes == small_size);
+
+    std::cout << "✓ Trimming evicts whole packages and raises the min fee" << std::endl;
+}
+
+// Test 15: Staged admission (lock-free checks, then a short commit)
+void TestStagedAdmission() {
+    std::cout << "\nTest 15: Staged Admission..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+    config.priority_limits[TxPriority::NORMAL] = 10000;
+    config.priority_limits[TxPriority::HIGH] = 10000;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    // Every outside coin is worth 1,000,000; a locktime of 1 marks a
+    // transaction the external check rejects
+    constexpr uint64_t COIN_VALUE = 1000000;
+    std::atomic<int> checks{0};
+    mempool.SetCoinLookup([](const OutPoint&) -> std::optional<TxOut> {
+        TxOut coin;
+        coin.value = COIN_VALUE;
+        return coin;
+    });
+    mempool.SetTransactionCheck([&checks](const Transaction& tx) {
+        checks++;
+        return tx.locktime == 1 ? Result<void>::Error("Bad signature") : Result<void>::Ok();
+    });
+
+    std::vector<Transaction> batch;
+    for (int i = 0; i < 20; ++i) {
+        batch.push_back(CreateTestTransaction(1000));
+    }
+    Transaction child = CreateChildTransaction(batch[0], 0);    // parent earlier in the batch
+    child.outputs.resize(1);
+    child.outputs[0].value = batch[0].outputs[0].value / 2;
+    Transaction conflict = CreateTestTransaction(1000);
+    conflict.inputs[0] = batch[1].inputs[0];                     // double spend
+    Transaction bad_check = CreateTestTransaction(1000);
+    bad_check.locktime = 1;
+    batch.push_back(child);
+    batch.push_back(conflict);
+    batch.push_back(bad_check);
+
+    auto results = mempool.AddTransactions(batch, TxPriority::NORMAL);
+    assert(results.size() == batch.size());
+    for (size_t i = 0; i < 21; ++i) {
+        assert(results[i].IsOk());
+    }
+    assert(results[21].IsError());
+    assert(results[22].IsError() && results[22].error == "Bad signature");
+    assert(checks.load() == 23);
+    assert(mempool.GetStats().total_transactions == 21);
+
+    // Fees come from input values: coin value (or the parent's output) less outputs
+    auto entry = mempool.GetEntry(batch[0].GetHash()).GetValue();
+    assert(entry.fee == COIN_VALUE - batch[0].GetTotalOutputValue());
+    auto child_entry = mempool.GetEntry(child.GetHash()).GetValue();
+    assert(child_entry.fee == batch[0].outputs[0].value - child.GetTotalOutputValue());
+    assert(child_entry.ancestor_count == 2);
+
+    // Many threads racing to spend one outpoint: exactly one wins
+    Transaction base = CreateTestTransaction(1000);
+    std::atomic<int> accepted{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&mempool, &accepted, &base, t]() {
+            Transaction spend = CreateTestTransaction(1000 + t);
+            spend.inputs[0] = base.inputs[0];
+            if (mempool.AddTransaction(spend, TxPriority::NORMAL).IsOk()) accepted++;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(accepted.load() == 1);
+
+    // Removing the winner frees the outpoint again
+    auto all = mempool.GetAllTransactions();
+    for (const auto& e : all) {
+        if (e.tx.inputs[0].prev_tx_hash == base.inputs[0].prev_tx_hash) {
+            mempool.RemoveTransaction(e.tx_hash);
+        }
+    }
+    auto add_result = mempool.AddTransaction(base, TxPriority::NORMAL);
+    assert(add_result.IsOk());
+
+    std::cout << "✓ Batch and concurrent admission with conflict detection" << std::endl;
+}
+
+// Test 16: Orphan pool (held until parents arrive, bounded per peer and in total)
+void TestOrphanPool() {
+    std::cout << "\nTest 16: Orphan Pool..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+    config.max_orphan_tx = 5;
+    config.max_orphans_per_peer = 3;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    // Outputs of transactions in `unknown` are neither confirmed nor (yet)
+    // in the mempool; every other coin is worth 1,000,000
+    std::set<uint256> unknown;
+    mempool.SetCoinLookup([&unknown](const OutPoint& outpoint) -> std::optional<TxOut> {
+        if (unknown.count(outpoint.tx_hash) > 0) return std::nullopt;
+        TxOut coin;
+        coin.value = 1000000;
+        return coin;
+    });
+
+    // Chain a -> b -> c; the children arrive first
+    Transaction a = CreateTestTransaction(1000);
+    Transaction b = CreateChildTransaction(a, 0);
+    b.outputs.resize(1);
+    b.outputs[0].value = a.outputs[0].value / 2;
+    Transaction c = CreateChildTransaction(b, 0);
+    c.outputs.resize(1);
+    c.outputs[0].value = b.outputs[0].value / 2;
+    unknown.insert(a.GetHash());
+    unknown.insert(b.GetHash());
+
+    auto c_result = mempool.AddTransactionFromPeer(c, 1);
+    auto b_result = mempool.AddTransactionFromPeer(b, 1);
+    assert(c_result.IsError() && c_result.error == "Missing inputs");
+    assert(b_result.IsError());
+    assert(mempool.HasOrphan(b.GetHash()) && mempool.HasOrphan(c.GetHash()));
+    assert(mempool.GetStats().orphan_count == 2);
+
+    // Accepting the root admits the whole chain
+    auto a_result = mempool.AddTransaction(a, TxPriority::NORMAL);
+    assert(a_result.IsOk());
+    assert(mempool.HasTransaction(b.GetHash()) && mempool.HasTransaction(c.GetHash()));
+    assert(mempool.GetStats().orphan_count == 0);
+    assert(mempool.GetEntry(c.GetHash()).GetValue().ancestor_count == 3);
+
+    // Per-peer cap: only max_orphans_per_peer are kept from one peer
+    auto make_orphan = [&unknown]() {
+        Transaction tx = CreateTestTransaction(1000);
+        unknown.insert(tx.inputs[0].prev_tx_hash);
+        return tx;
+    };
+    for (int i = 0; i < 5; ++i) {
+        mempool.AddTransactionFromPeer(make_orphan(), 2);
+    }
+    assert(mempool.GetStats().orphan_count == 3);
+
+    // Total cap: random eviction keeps the pool at max_orphan_tx
+    for (uint64_t peer = 10; peer < 20; ++peer) {
+        mempool.AddTransactionFromPeer(make_orphan(), peer);
+    }
+    assert(mempool.GetStats().orphan_count == 5);
+
+    // Disconnecting peers drops what they sent
+    uint32_t erased = 0;
+    for (uint64_t peer = 2; peer < 20; ++peer) {
+        erased += mempool.EraseOrphansForPeer(peer);
+    }
+    assert(erased == 5);
+    assert(mempool.GetStats().orphan_count == 0);
+
+    std::cout << "✓ Orphans resolved by their parents and kept within limits" << std::endl;
+}
+
+// Test 17: Read snapshots (immutable, shared, republished on change)
+void TestSnapshots() {
+    std::cout << "\nTest 17: Read Snapshots..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    std::vector<Transaction> txs;
+    for (int i = 0; i < 3; ++i) {
+        txs.push_back(CreateTestTransaction(1000 + i * 1000));
+        mempool.AddTransaction(txs.back(), TxPriority::NORMAL);
+    }
+
+    // Unchanged mempool: the same snapshot is handed out again
+    auto first = mempool.GetSnapshot();
+    assert(first->entries.size() == 3);
+    assert(mempool.GetSnapshot() == first);
+
+    // A child changes its parent's package totals, nothing else
+    Transaction child = CreateChildTransaction(txs[0], 0);
+    auto add_result = mempool.AddTransaction(child, TxPriority::NORMAL);
+    assert(add_result.IsOk());
+
+    auto second = mempool.GetSnapshot();
+    assert(second != first);
+    assert(second->sequence > first->sequence);
+    assert(second->entries.size() == 4);
+    assert(first->entries.size() == 3);  // older snapshots never change
+
+    auto find = [](const MempoolSnapshot& snapshot, const uint256& tx_hash) {
+        for (const auto& entry : snapshot.entries) {
+            if (entry->tx_hash == tx_hash) return entry;
+        }
+        return std::shared_ptr<const MempoolEntry>();
+    };
+    assert(find(*first, txs[1].GetHash()) == find(*second, txs[1].GetHash()));
+    assert(find(*first, txs[0].GetHash()) != find(*second, txs[0].GetHash()));
+    assert(find(*first, txs[0].GetHash())->descendant_count == 1);
+    assert(find(*second, txs[0].GetHash())->descendant_count == 2);
+
+    // Snapshot order matches GetAllTransactions
+    auto all = mempool.GetAllTransactions();
+    assert(all.size() == second->entries.size());
+    for (size_t i = 0; i < all.size(); ++i) {
+        assert(all[i].tx_hash == second->entries[i]->tx_hash);
+    }
+
+    // Readers polling while transactions are admitted
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> reads{0};
+    std::thread reader([&]() {
+        uint64_t last_sequence = 0;
+        while (!done.load()) {
+            auto snapshot = mempool.GetSnapshot();
+            assert(snapshot->sequence >= last_sequence);
+            last_sequence = snapshot->sequence;
+            reads++;
+        }
+    });
+    for (int i = 0; i < 200; ++i) {
+        mempool.AddTransaction(CreateTestTransaction(1000 + i), TxPriority::NORMAL);
+    }
+    done = true;
+    reader.join();
+    assert(mempool.GetSnapshot()->entries.size() == mempool.GetStats().total_transactions);
+
+    // Admissions only note what changed: a burst is published once, by the
+    // next reader, and an admission costs no more in a pool four times as
+    // large (rebuilding per admission made a burst quadratic)
+    constexpr int BURST = 1000;
+    auto admit_burst = [&mempool](int count) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            mempool.AddTransaction(CreateTestTransaction(1000), TxPriority::NORMAL);
+        }
+        return std::chrono::steady_clock::now() - start;
+    };
+    auto before_burst = mempool.GetSnapshot();
+    auto small_pool_time = admit_burst(BURST);
+    admit_burst(2 * BURST);
+    auto large_pool_time = admit_burst(BURST);
+    auto after_burst = mempool.GetSnapshot();
+    assert(after_burst->sequence == before_burst->sequence + 1);
+    assert(after_burst->entries.size() == before_burst->entries.size() + 4 * BURST);
+    assert(large_pool_time < 3 * small_pool_time);
+
+    std::cout << "✓ Snapshots immutable and shared (" << reads.load() << " concurrent reads)" << std::endl;
+}
+
+// Test 18: Contract nonce queues and gas-limited templates
+void TestContractQueues() {
+    std::cout << "\nTest 18: Contract Nonce Queues..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    // The chain's next nonce per sender, as the node's lookup would report it
+    std::map<std::string, uint64_t> chain_nonces;
+    auto sender_address = [](uint8_t sender) {
+        PublicKey key;
+        key.fill(sender);
+        return PublicKeyToAddress(key);
+    };
+    mempool.SetNonceLookup([&chain_nonces](const std::string& sender) -> std::optional<uint64_t> {
+        auto it = chain_nonces.find(sender);
+        if (it == chain_nonces.end()) return std::nullopt;
+        return it->second;
+    });
+
+    auto position = [](const std::vector<Transaction>& txs, const Transaction& tx) {
+        uint256 tx_hash = tx.GetHash();
+        for (size_t i = 0; i < txs.size(); ++i) {
+            if (txs[i].GetHash() == tx_hash) return static_cast<int>(i);
+        }
+        return -1;
+    };
+
+    // Sender 1 submits nonces out of order; the template restores it
+    std::vector<Transaction> a = {
+        CreateContractCall(1, 0, 100000, 20),
+        CreateContractCall(1, 1, 100000, 20),
+        CreateContractCall(1, 2, 100000, 20),
+    };
+    Transaction b = CreateContractCall(2, 0, 100000, 50);
+    auto add_a2 = mempool.AddTransaction(a[2], TxPriority::NORMAL);
+    auto add_a0 = mempool.AddTransaction(a[0], TxPriority::NORMAL);
+    auto add_a1 = mempool.AddTransaction(a[1], TxPriority::NORMAL);
+    auto add_b = mempool.AddTransaction(b, TxPriority::NORMAL);
+    assert(add_a2.IsOk() && add_a0.IsOk() && add_a1.IsOk() && add_b.IsOk());
+
+    auto block = mempool.GetBlockTemplate(1000000, 0);
+    assert(block.size() == 4);
+    assert(position(block, b) == 0);  // highest gas price first
+    assert(position(block, a[0]) < position(block, a[1]));
+    assert(position(block, a[1]) < position(block, a[2]));
+
+    // Replacing a queued nonce needs a 10% higher gas price
+    Transaction a1_low = CreateContractCall(1, 1, 100000, 21);
+    Transaction a1_high = CreateContractCall(1, 1, 100000, 30);
+    auto replace_low = mempool.AddTransaction(a1_low, TxPriority::NORMAL);
+    auto replace_high = mempool.AddTransaction(a1_high, TxPriority::NORMAL);
+    assert(replace_low.IsError());
+    assert(replace_high.IsOk());
+    assert(!mempool.HasTransaction(a[1].GetHash()));
+    assert(mempool.GetEntry(a1_high.GetHash()).GetValue().gas_price == 30);
+
+    // A replacement that fails a later check leaves the original queued
+    Transaction a2_conflict = CreateContractCall(1, 2, 100000, 40);
+    a2_conflict.inputs[0] = b.inputs[0];
+    auto replace_conflict = mempool.AddTransaction(a2_conflict, TxPriority::NORMAL);
+    assert(replace_conflict.IsError());
+    assert(mempool.HasTransaction(a[2].GetHash()));
+
+    // Confirming nonce 0 makes it unusable; a gap at the front of a
+    // queue keeps the rest out of templates
+    auto confirmed = mempool.RemoveConfirmedTransactions({a[0].GetHash()});
+    assert(confirmed.IsOk() && confirmed.GetValue() == 1);
+    chain_nonces[sender_address(1)] = 1;
+    auto reuse = mempool.AddTransaction(CreateContractCall(1, 0, 100000, 100), TxPriority::NORMAL);
+    assert(reuse.IsError());
+
+    // A reorg that rolls the nonce back lets the transaction in again
+    chain_nonces[sender_address(1)] = 0;
+    auto readd = mempool.AddTransaction(a[0], TxPriority::NORMAL);
+    assert(readd.IsOk());
+
+    Transaction c3 = CreateContractCall(3, 3, 100000, 40);
+    Transaction c4 = CreateContractCall(3, 4, 100000, 40);
+    Transaction c5 = CreateContractCall(3, 5, 100000, 40);
+    auto add_c3 = mempool.AddTransaction(c3, TxPriority::NORMAL);
+    auto add_c5 = mempool.AddTransaction(c5, TxPriority::NORMAL);
+    assert(add_c3.IsOk() && add_c5.IsOk());
+    auto confirmed_c3 = mempool.RemoveConfirmedTransactions({c3.GetHash()});
+    assert(confirmed_c3.IsOk());
+    chain_nonces[sender_address(3)] = 4;
+    block = mempool.GetBlockTemplate(1000000, 0);
+    assert(position(block, c5) == -1);
+
+    auto add_c4 = mempool.AddTransaction(c4, TxPriority::NORMAL);
+    assert(add_c4.IsOk());
+    block = mempool.GetBlockTemplate(1000000, 0);
+    assert(position(block, c4) >= 0 && position(block, c4) < position(block, c5));
+
+    // The block gas limit (30M) holds back the rest of a sender's queue
+    Transaction d0 = CreateContractCall(4, 0, 20000000, 10);
+    Transaction d1 = CreateContractCall(4, 1, 20000000, 10);
+    auto add_d0 = mempool.AddTransaction(d0, TxPriority::NORMAL);
+    auto add_d1 = mempool.AddTransaction(d1, TxPriority::NORMAL);
+    assert(add_d0.IsOk() && add_d1.IsOk());
+    assert(mempool.GetStats().total_gas == 6 * 100000 + 2 * 20000000);
+
+    // So does one that would go over the mempool gas limit
+    Transaction d1_over = CreateContractCall(4, 1, 40000000, 20);
+    auto replace_over = mempool.AddTransaction(d1_over, TxPriority::NORMAL);
+    assert(replace_over.IsError());
+    assert(mempool.HasTransaction(d1.GetHash()));
+    assert(mempool.GetStats().total_gas == 6 * 100000 + 2 * 20000000);
+
+    block = mempool.GetBlockTemplate(1000000, 0);
+    assert(position(block, d0) >= 0);
+    assert(position(block, d1) == -1);
+    assert(position(block, a[0]) >= 0 && position(block, a1_high) > position(block, a[0]));
+    assert(position(block, a[2]) > position(block, a1_high));
+
+    std::cout << "✓ Nonce order, replacement, gaps and block gas limit respected" << std::endl;
+}
+
+// Test 19: Incremental feerate histogram
+void TestFeeHistogram() {
+    std::cout << "\nTest 19: Fee Histogram..." << std::endl;
+
+    MempoolConfig config;
+    config.max_size_mb = 100;
+    config.persist_on_shutdown = false;
+
+    INTcoinMempool mempool;
+    mempool.Initialize(config);
+
+    // Bucket boundaries
+    assert(FeeHistogram::BucketIndex(0) == 0);
+    assert(FeeHistogram::BucketIndex(9) == FeeHistogram::BucketIndex(8));
+    assert(FeeHistogram::BucketIndex(10) == FeeHistogram::BucketIndex(8) + 1);
+    assert(FeeHistogram::BucketIndex(UINT64_MAX) == FeeHistogram::NUM_BUCKETS - 1);
+
+    std::vector<Transaction> txs;
+    for (int i = 0; i < 50; ++i) {
+        txs.push_back(CreateTestTransaction(1000 + i * 100));
+        auto add_result = mempool.AddTransaction(txs.back(), i % 2 ? TxPriority::NORMAL : TxPriority::LOW);
+        assert(add_result.IsOk());
+    }
+
+    // Totals track the mempool's own
+    auto matches_stats = [&mempool]() {
+        FeeHistogram histogram = mempool.GetFeeHistogram();
+        MempoolStats stats = mempool.GetStats();
+        uint64_t bucket_count = 0;
+        for (const auto& bucket : histogram.GetBuckets()) bucket_count += bucket.count;
+        return histogram.GetCount() == stats.total_transactions &&
+               bucket_count == stats.total_transactions &&
+               histogram.GetSizeBytes() == stats.total_size_bytes &&
+               histogram.GetFees() == stats.total_fees;
+    };
+    assert(matches_stats());
+
+    MempoolEntry entry = mempool.GetEntry(txs[0].GetHash()).GetValue();
+    FeeHistogram histogram = mempool.GetFeeHistogram();
+    assert(histogram.GetBuckets()[FeeHistogram::BucketIndex(entry.fee_per_byte)].count > 0);
+    assert(mempool.GetFeeHistogram(TxPriority::LOW).GetCount() == 25);
+    assert(mempool.GetFeeHistogram(TxPriority::NORMAL).GetCount() == 25);
+    assert(mempool.GetFeeHistogram(TxPriority::HIGH).GetCount() == 0);
+
+    // EstimateFee reads the priority class's median feerate
+    FeeHistogram low = mempool.GetFeeHistogram(TxPriority::LOW);
+    auto estimate = mempool.EstimateFee(TxPriority::LOW, 1000);
+    assert(estimate.IsOk());
+    assert(estimate.GetValue() == static_cast<uint64_t>(low.GetFeeRatePercentile(0.5) * 1000));
+    assert(low.GetFeeRatePercentile(0.0) <= low.GetFeeRatePercentile(0.5));
+    assert(low.GetFeeRatePercentile(0.5) <= low.GetFeeRatePercentile(1.0));
+
+    // Removals and clears are reflected immediately
+    auto remove_result = mempool.RemoveTransaction(txs[0].GetHash());
+    assert(remove_result.IsOk());
+    assert(mempool.GetFeeHistogram(TxPriority::LOW).GetCount() == 24);
+    assert(matches_stats());
+
+    mempool.Clear();
+    assert(mempool.GetFeeHistogram().GetCount() == 0);
+    assert(mempool.GetFeeHistogram().GetFees() == 0);
+
+    std::cout << "✓ Histogram follows adds, removes and clears" << std::endl;
+}
+
 int main() {
     std::cout << "========================================" << std::endl;
     std::cout << "INTcoin Enhanced Mempool Test Suite" << std::endl;
@@ -472,6 +1170,13 @@ int main() {
         TestPriorityUpgrade();
         TestClearMempool();
         TestThreadSafety();
+        TestPackageTracking();
+        TestTrimToSize();
+        TestStagedAdmission();
+        TestOrphanPool();
+        TestSnapshots();
+        TestContractQueues();
+        TestFeeHistogram();
 
         std::cout << "\n========================================" << std::endl;
         std::cout << "All mempool tests passed! ✓" << std::endl;
@@ -109,6 +109,29 @@ bool test_priority_distribution() {
     return true;
 }
 
+// Test: Fee rates from the incremental histogram
+bool test_fee_rates() {
+    MempoolAnalytics analytics;
+
+    analytics.OnTransactionAdded(100, 5.0, 1);
+    analytics.OnTransactionAdded(100, 10.0, 1);
+    analytics.OnTransactionAdded(100, 20.0, 1);
+
+    auto stats = analytics.GetCurrentStats();
+    TEST_ASSERT(stats.median_fee_rate == 10.0, "Median fee rate should be 10");
+    TEST_ASSERT(stats.avg_fee_rate > 11.6 && stats.avg_fee_rate < 11.7, "Average fee rate should be 3500/300");
+    TEST_ASSERT(analytics.GetFeeHistogram().GetCount() == 3, "Histogram should hold 3 transactions");
+
+    analytics.OnTransactionRemoved(100, 20.0, 1);
+    analytics.OnTransactionRemoved(100, 10.0, 1);
+
+    stats = analytics.GetCurrentStats();
+    TEST_ASSERT(stats.median_fee_rate == 5.0, "Median fee rate should drop to 5");
+    TEST_ASSERT(analytics.GetFeeHistogram().GetFees() == 500, "Histogram fees should be 500");
+
+    return true;
+}
+
 // Test: Snapshot functionality
 bool test_snapshots() {
     MempoolAnalytics analytics;
@@ -315,6 +338,7 @@ int main() {
     RUN_TEST(test_transaction_addition);
     RUN_TEST(test_transaction_removal);
     RUN_TEST(test_priority_distribution);
+    RUN_TEST(test_fee_rates);
     RUN_TEST(test_snapshots);
     RUN_TEST(test_flow_metrics);
     RUN_TEST(test_json_export);
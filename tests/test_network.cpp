@@ -263,6 +263,39 @@ void test_inv_message_creation() {
     std::cout << "  ✓ INV message creation tests passed\n";
 }
 
+void test_recent_tx_filter() {
+    std::cout << "Testing recently rejected/confirmed transaction filter...\n";
+
+    RecentTxFilter filter;
+
+    uint256 rejected{};
+    rejected.fill(0x11);
+    uint256 unseen{};
+    unseen.fill(0x22);
+
+    filter.AddRejected(rejected);
+    assert(filter.Contains(rejected));
+    assert(!filter.Contains(unseen));
+
+    // A new tip forgets rejections and remembers the block's transactions
+    Block block;
+    Transaction tx;
+    tx.version = 1;
+    tx.locktime = 7;
+    block.transactions.push_back(tx);
+    filter.BlockConnected(block);
+    assert(!filter.Contains(rejected));
+    assert(filter.Contains(tx.GetHash()));
+
+    // A block that doesn't extend the last tip is a reorg: confirmations go too
+    Block other;
+    other.header.prev_block_hash.fill(0x33);
+    filter.BlockConnected(other);
+    assert(!filter.Contains(tx.GetHash()));
+
+    std::cout << "  ✓ Recent transaction filter tests passed\n";
+}
+
 int main() {
     std::cout << "========================================\n";
     std::cout << "P2P Network Protocol Tests\n";
@@ -279,6 +312,7 @@ int main() {
         test_block_broadcast();
         test_transaction_broadcast();
         test_inv_message_creation();
+        test_recent_tx_filter();
 
         std::cout << "\n========================================\n";
         std::cout << "✓ All network protocol tests passed!\n";
@@ -2,11 +2,14 @@
 // Distributed under the MIT software license
 
 #include <intcoin/ibd/parallel_validation.h>
+#include <intcoin/ibd/check_queue.h>
+#include <intcoin/transaction.h>
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <functional>
 
+using namespace intcoin;
 using namespace intcoin::ibd;
 
 // Test helpers
@@ -139,6 +142,75 @@ bool test_concurrent_threadpool() {
     return true;
 }
 
+// Build a transaction whose inputs push a single true byte (no signature needed)
+static Transaction MakeTrivialTx(size_t num_inputs) {
+    Transaction tx;
+    tx.version = 1;
+    for (size_t i = 0; i < num_inputs; i++) {
+        TxIn input;
+        input.prev_tx_hash = {};
+        input.prev_tx_index = static_cast<uint32_t>(i);
+        input.script_sig = Script(std::vector<uint8_t>{
+            static_cast<uint8_t>(OpCode::OP_PUSHDATA), 0x01, 0x00, 0x01});
+        tx.inputs.push_back(input);
+    }
+    return tx;
+}
+
+// Test: Script check queue runs all checks across threads
+bool test_check_queue_all_pass() {
+    Transaction tx = MakeTrivialTx(100);
+    std::vector<ScriptCheck> checks;
+    for (size_t i = 0; i < tx.inputs.size(); i++) {
+        ScriptCheck check;
+        check.tx = &tx;
+        check.input_index = i;
+        checks.push_back(check);
+    }
+
+    ScriptCheckQueue queue(4);
+    TEST_ASSERT(queue.GetThreadCount() == 4, "Thread count should be 4");
+    TEST_ASSERT(queue.RunChecks({}).IsOk(), "Empty batch should pass");
+
+    auto result = queue.RunChecks(checks);
+    TEST_ASSERT(result.IsOk(), "All trivial checks should pass");
+    TEST_ASSERT(queue.GetStats().checks_run == 100, "All 100 checks should run");
+    return true;
+}
+
+// Test: Script check queue aborts early and reports lowest failing index
+bool test_check_queue_early_abort() {
+    Transaction tx = MakeTrivialTx(200);
+    tx.inputs[150].script_sig = Script(std::vector<uint8_t>{
+        static_cast<uint8_t>(OpCode::OP_PUSHDATA), 0x01, 0x00, 0x00});  // Pushes false
+    tx.inputs[40].script_sig = Script(std::vector<uint8_t>{
+        static_cast<uint8_t>(OpCode::OP_PUSHDATA), 0x01, 0x00, 0x00});
+
+    std::vector<ScriptCheck> checks;
+    for (size_t i = 0; i < tx.inputs.size(); i++) {
+        ScriptCheck check;
+        check.tx = &tx;
+        check.tx_index = 7;
+        check.input_index = i;
+        checks.push_back(check);
+    }
+
+    // Single-threaded: deterministic abort right at input 40
+    ScriptCheckQueue serial(1);
+    auto serial_result = serial.RunChecks(checks);
+    TEST_ASSERT(serial_result.IsError(), "Batch with false input should fail");
+    TEST_ASSERT(serial_result.error.find("Input 40 ") != std::string::npos,
+                "First failing input should be reported");
+    TEST_ASSERT(serial.GetStats().checks_skipped > 0, "Checks after failure should be skipped");
+
+    ScriptCheckQueue parallel(4);
+    auto parallel_result = parallel.RunChecks(checks);
+    TEST_ASSERT(parallel_result.IsError(), "Parallel batch with false input should fail");
+    TEST_ASSERT(parallel_result.error.find("Transaction 7 ") != std::string::npos,
+                "Error should name the transaction");
+    return true;
+}
+
 int main() {
     int passed = 0;
     int failed = 0;
@@ -158,6 +230,10 @@ int main() {
     RUN_TEST(test_processor_enable_disable);
     RUN_TEST(test_processor_thread_count);
 
+    // Script check queue tests
+    RUN_TEST(test_check_queue_all_pass);
+    RUN_TEST(test_check_queue_early_abort);
+
     // Note: Block submission tests require integration testing with real Block objects
     // and are covered by test_ibd_integration.cpp
 
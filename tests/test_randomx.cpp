@@ -157,8 +157,170 @@ void test_block_validation() {
     }
 }
 
+void test_pow_cache() {
+    std::cout << "\n=== Test 6: PoW Result Cache ===" << std::endl;
+
+    // Bounded LRU behaviour on a private instance
+    PowCache cache(2);
+    uint256 h1{}, h2{}, h3{}, rx{};
+    h1[0] = 1; h2[0] = 2; h3[0] = 3; rx[0] = 0xAB;
+
+    assert(!cache.Lookup(h1).has_value());
+    cache.Insert(h1, rx);
+    cache.Insert(h2, rx);
+    auto hit = cache.Lookup(h1);  // h1 becomes most recently used
+    assert(hit.has_value() && *hit == rx);
+    (void)hit;                    // Suppress unused warning
+    cache.Insert(h3, rx);         // evicts h2
+    assert(cache.Contains(h1));
+    assert(!cache.Contains(h2));
+    assert(cache.Contains(h3));
+
+    auto stats = cache.GetStats();
+    assert(stats.hits == 1);
+    assert(stats.misses == 1);
+    assert(stats.evictions == 1);
+    assert(stats.entries == 2);
+    (void)stats;  // Suppress unused warning
+    std::cout << "✓ LRU eviction and statistics correct" << std::endl;
+
+    // Second validation of the same header is served from the global cache
+    BlockHeader header;
+    header.version = 1;
+    header.timestamp = GetCurrentTime();
+    header.bits = consensus::MIN_DIFFICULTY_BITS;
+    header.randomx_key = RandomXValidator::GetRandomXKey(0);
+
+    PowCache::Instance().Clear();
+    for (header.nonce = 0; header.nonce < 64; header.nonce++) {
+        if (RandomXValidator::ValidateBlockHash(header).IsOk()) {
+            break;
+        }
+    }
+    assert(PowCache::Instance().Contains(header.GetHash()));
+
+    uint64_t hits_before = PowCache::Instance().GetStats().hits;
+    auto revalidate = RandomXValidator::ValidateBlockHash(header);
+    assert(revalidate.IsOk());
+    assert(PowCache::Instance().GetStats().hits == hits_before + 1);
+    (void)revalidate;   // Suppress unused warning
+    (void)hits_before;  // Suppress unused warning
+    std::cout << "✓ Revalidation skips RandomX via cache" << std::endl;
+}
+
+void test_header_batch_validation() {
+    std::cout << "\n=== Test 7: Parallel Header Batch Validation ===" << std::endl;
+
+    // Build a small linked chain of headers that each meet minimum difficulty
+    std::vector<BlockHeader> headers;
+    std::vector<uint256> hashes;
+    uint256 prev{};
+    for (int i = 0; i < 40; i++) {
+        BlockHeader header;
+        header.version = 1;
+        header.prev_block_hash = prev;
+        header.timestamp = GetCurrentTime() + i;
+        header.bits = consensus::MIN_DIFFICULTY_BITS;
+        header.randomx_key = RandomXValidator::GetRandomXKey(0);
+        for (header.nonce = 0; header.nonce < 64; header.nonce++) {
+            auto hash_result = RandomXValidator::CalculateHash(header);
+            assert(hash_result.IsOk());
+            if (DifficultyCalculator::CheckProofOfWork(*hash_result.value, header.bits)) {
+                break;
+            }
+        }
+        prev = header.GetHash();
+        headers.push_back(header);
+        hashes.push_back(prev);
+    }
+
+    PowCache::Instance().Clear();
+    auto batch_result = RandomXValidator::ValidateHeaderBatch(headers, hashes, 4);
+    assert(batch_result.IsOk());
+    assert(PowCache::Instance().Contains(hashes.back()));
+    (void)batch_result;  // Suppress unused warning
+    std::cout << "✓ Valid batch accepted and cached" << std::endl;
+
+    // One header with an unreachable target rejects the whole batch
+    PowCache::Instance().Clear();
+    headers[25].bits = consensus::MAX_DIFFICULTY_BITS;
+    hashes[25] = headers[25].GetHash();
+    auto bad_result = RandomXValidator::ValidateHeaderBatch(headers, hashes, 4);
+    assert(bad_result.IsError());
+    (void)bad_result;  // Suppress unused warning
+    std::cout << "✓ Invalid header rejects batch" << std::endl;
+
+    // Mismatched inputs are rejected
+    hashes.pop_back();
+    assert(RandomXValidator::ValidateHeaderBatch(headers, hashes).IsError());
+    std::cout << "✓ Header/hash count mismatch rejected" << std::endl;
+}
+
+void test_header_batch_key_change() {
+    std::cout << "\n=== Test 8: Header Batch Spanning a Key Change ===" << std::endl;
+
+    // Half the headers use the epoch 0 key and half the epoch 1 key, so the
+    // batch re-keys the cache between runs; each run spans enough chunks that
+    // every VM gets work
+    const uint256 keys[2] = {RandomXValidator::GetRandomXKey(0),
+                             RandomXValidator::GetRandomXKey(2048)};
+    std::vector<BlockHeader> headers;
+    std::vector<uint256> hashes;
+    std::vector<uint256> pow_hashes;
+    uint256 prev{};
+    for (int i = 0; i < 256; i++) {
+        BlockHeader header;
+        header.version = 1;
+        header.prev_block_hash = prev;
+        header.timestamp = GetCurrentTime() + i;
+        header.bits = consensus::MIN_DIFFICULTY_BITS;
+        header.randomx_key = keys[i < 128 ? 0 : 1];
+        uint256 pow_hash{};
+        for (header.nonce = 0; header.nonce < 64; header.nonce++) {
+            auto hash_result = RandomXValidator::CalculateHash(header);
+            assert(hash_result.IsOk());
+            pow_hash = *hash_result.value;
+            if (DifficultyCalculator::CheckProofOfWork(pow_hash, header.bits)) {
+                break;
+            }
+        }
+        prev = header.GetHash();
+        headers.push_back(header);
+        hashes.push_back(prev);
+        pow_hashes.push_back(pow_hash);
+    }
+
+    // Start from fresh VMs with the epoch 1 key loaded, then run twice so the
+    // batch starts once on a stale key and once on the current one; every VM
+    // must hash with the key of the header it is given
+    RandomXValidator::Shutdown();
+    auto init_result = RandomXValidator::Initialize();
+    auto update_result = RandomXValidator::UpdateDataset(2048);
+    assert(init_result.IsOk() && update_result.IsOk());
+    (void)init_result;    // Suppress unused warning
+    (void)update_result;  // Suppress unused warning
+    for (int pass = 0; pass < 2; pass++) {
+        PowCache::Instance().Clear();
+        auto batch_result = RandomXValidator::ValidateHeaderBatch(headers, hashes, 4);
+        assert(batch_result.IsOk());
+        (void)batch_result;  // Suppress unused warning
+        for (size_t i = 0; i < headers.size(); i++) {
+            auto cached = PowCache::Instance().Lookup(hashes[i]);
+            assert(cached && *cached == pow_hashes[i]);
+            (void)cached;  // Suppress unused warning
+        }
+    }
+    std::cout << "✓ Batch across two keys matches single-header hashes" << std::endl;
+
+    // Single-header hashing after the batch uses the right key as well
+    auto single = RandomXValidator::CalculateHash(headers.front());
+    assert(single.IsOk() && *single.value == pow_hashes.front());
+    (void)single;  // Suppress unused warning
+    std::cout << "✓ Single-header hashing agrees after batch re-keying" << std::endl;
+}
+
 void test_randomx_shutdown() {
-    std::cout << "\n=== Test 6: RandomX Shutdown ===" << std::endl;
+    std::cout << "\n=== Test 9: RandomX Shutdown ===" << std::endl;
 
     // Shutdown RandomX
     RandomXValidator::Shutdown();
@@ -189,6 +351,9 @@ int main() {
         test_randomx_hash_calculation();
         test_dataset_update();
         test_block_validation();
+        test_pow_cache();
+        test_header_batch_validation();
+        test_header_batch_key_change();
         test_randomx_shutdown();
 
         std::cout << "\n========================================" << std::endl;
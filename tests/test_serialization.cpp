@@ -9,6 +9,7 @@
 #include "intcoin/util.h"
 #include <iostream>
 #include <cassert>
+#include <memory_resource>
 
 using namespace intcoin;
 
@@ -354,6 +355,263 @@ void TestSerializationDeterminism() {
     std::cout << "✓ Transaction hashes are deterministic\n";
 }
 
+/// Reference signature hash preimage, built the straightforward way
+/// (full per-input serialization) to pin the precomputed path's output
+uint256 ReferenceSigningHash(const Transaction& tx, uint8_t sighash_type, size_t input_index,
+                             const Script& prev_scriptpubkey) {
+    std::vector<uint8_t> data;
+    SerializeUint32(data, tx.version);
+
+    bool anyonecanpay = HasAnyoneCanPay(sighash_type);
+    SerializeUint64(data, anyonecanpay ? 1 : tx.inputs.size());
+    for (size_t i = 0; i < tx.inputs.size(); i++) {
+        if (anyonecanpay && i != input_index) continue;
+        TxIn input = tx.inputs[i];
+        input.script_sig = (i == input_index) ? prev_scriptpubkey : Script();
+        auto bytes = input.Serialize();
+        data.insert(data.end(), bytes.begin(), bytes.end());
+    }
+
+    SigHashType base_type = GetBaseSigHashType(sighash_type);
+    if (base_type == SigHashType::NONE) {
+        SerializeUint64(data, 0);
+    } else if (base_type == SigHashType::SINGLE) {
+        SerializeUint64(data, input_index < tx.outputs.size() ? 1 : 0);
+        if (input_index < tx.outputs.size()) {
+            auto bytes = tx.outputs[input_index].Serialize();
+            data.insert(data.end(), bytes.begin(), bytes.end());
+        }
+    } else {
+        SerializeUint64(data, tx.outputs.size());
+        for (const auto& output : tx.outputs) {
+            auto bytes = output.Serialize();
+            data.insert(data.end(), bytes.begin(), bytes.end());
+        }
+    }
+
+    SerializeUint64(data, tx.locktime);
+    data.push_back(sighash_type);
+    return SHA3::Hash(data);
+}
+
+void TestPrecomputedSigningHash() {
+    std::cout << "\n=== Test 10: Precomputed Signature Hash ===\n";
+
+    Transaction tx;
+    tx.version = 1;
+    for (int i = 0; i < 5; i++) {
+        TxIn input;
+        input.prev_tx_hash = uint256{static_cast<uint8_t>(i), 0xAB, static_cast<uint8_t>(i * 3)};
+        input.prev_tx_index = i;
+        input.script_sig = Script(std::vector<uint8_t>{0x48, static_cast<uint8_t>(i)});
+        input.sequence = 0xFFFFFFFF - i;
+        tx.inputs.push_back(input);
+    }
+    for (int i = 0; i < 3; i++) {
+        uint256 pubkey_hash{static_cast<uint8_t>(i * 7), 0x42};
+        tx.outputs.emplace_back(1000 * (i + 1), Script::CreateP2PKH(pubkey_hash));
+    }
+    tx.locktime = 123456;
+
+    Script prev_scriptpubkey = Script::CreateP2PKH(uint256{0x11, 0x22, 0x33});
+    PrecomputedTxData txdata(tx);
+
+    const uint8_t types[] = {
+        SIGHASH_ALL, SIGHASH_NONE, SIGHASH_SINGLE,
+        SIGHASH_ALL_ANYONECANPAY, SIGHASH_NONE_ANYONECANPAY, SIGHASH_SINGLE_ANYONECANPAY
+    };
+    for (uint8_t type : types) {
+        // Index 4 has no matching output for SIGHASH_SINGLE
+        for (size_t i = 0; i < tx.inputs.size(); i++) {
+            uint256 expected = ReferenceSigningHash(tx, type, i, prev_scriptpubkey);
+            assert(tx.GetHashForSigning(type, i, prev_scriptpubkey, txdata) == expected);
+            assert(tx.GetHashForSigning(type, i, prev_scriptpubkey) == expected);
+            (void)expected;
+        }
+    }
+    std::cout << "✓ Precomputed sighash matches full serialization for all SIGHASH types\n";
+
+    // script_sigs are not committed to, so filling them in keeps txdata valid
+    uint256 before = tx.GetHashForSigning(SIGHASH_ALL, 2, prev_scriptpubkey, txdata);
+    tx.inputs[0].script_sig = Script(std::vector<uint8_t>(100, 0x55));
+    assert(tx.GetHashForSigning(SIGHASH_ALL, 2, prev_scriptpubkey, txdata) == before);
+    (void)before;
+
+    // Stale data for a different layout falls back to a fresh computation
+    tx.outputs.pop_back();
+    assert(tx.GetHashForSigning(SIGHASH_ALL, 2, prev_scriptpubkey, txdata) ==
+           ReferenceSigningHash(tx, SIGHASH_ALL, 2, prev_scriptpubkey));
+    std::cout << "✓ Precomputed data survives script_sig changes and detects layout changes\n";
+}
+
+void TestStreamSerialization() {
+    std::cout << "\n=== Test 11: Stream Serialization ===\n";
+
+    Transaction tx;
+    tx.version = 2;
+    for (int i = 0; i < 3; i++) {
+        TxIn input;
+        input.prev_tx_hash = uint256{static_cast<uint8_t>(i), 0x5A};
+        input.prev_tx_index = i;
+        input.script_sig = Script(std::vector<uint8_t>(40 + i, static_cast<uint8_t>(i)));
+        tx.inputs.push_back(input);
+    }
+    tx.outputs.emplace_back(5000, Script::CreateP2PKH(uint256{0x77}));
+    tx.locktime = 99;
+    tx.signature.fill(0x3C);
+
+    // SizeComputer agrees with GetSerializedSize and the encoded bytes
+    auto bytes = tx.Serialize();
+    assert(ComputeSerializedSize(tx) == tx.GetSerializedSize());
+    assert(bytes.size() == tx.GetSerializedSize());
+    assert(bytes.capacity() == bytes.size());
+    assert(SerializeToVector(tx) == bytes);
+    std::cout << "✓ Size computed up front matches the encoding (one exact allocation)\n";
+
+    // Several objects back to back decode from one reader
+    std::vector<uint8_t> stream;
+    VectorWriter writer(stream);
+    tx.Serialize(writer);
+    tx.outputs[0].Serialize(writer);
+    OutPoint(tx.GetHash(), 7).Serialize(writer);
+
+    SpanReader reader(stream);
+    Transaction tx2;
+    TxOut out2;
+    OutPoint outpoint2;
+    assert(tx2.Unserialize(reader).IsOk());
+    assert(out2.Unserialize(reader).IsOk());
+    assert(outpoint2.Unserialize(reader).IsOk());
+    assert(reader.Remaining() == 0);
+    assert(tx2.GetHash() == tx.GetHash());
+    assert(out2.value == 5000 && out2.script_pubkey.bytes == tx.outputs[0].script_pubkey.bytes);
+    assert(outpoint2 == OutPoint(tx.GetHash(), 7));
+    std::cout << "✓ Consecutive objects round-trip through SpanReader\n";
+
+    // A hostile count is rejected without reserving for it
+    std::vector<uint8_t> hostile;
+    SerializeUint32(hostile, 1);
+    SerializeUint64(hostile, uint64_t{1} << 60);
+    auto hostile_result = Transaction::Deserialize(hostile);
+    assert(hostile_result.IsError());
+    (void)hostile_result;
+
+    // Script lengths beyond the buffer fail before allocating
+    std::vector<uint8_t> long_script;
+    SerializeUint64(long_script, 1000);
+    SerializeUint64(long_script, uint64_t{1} << 62);
+    assert(TxOut::Deserialize(long_script).IsError());
+    std::cout << "✓ Oversized counts and lengths rejected\n";
+
+    // Blocks encode in one allocation and decode in place
+    BlockHeader header{};
+    header.version = 1;
+    header.timestamp = 1735171200;
+    Block block(header, {tx, tx2});
+    auto block_bytes = block.Serialize();
+    assert(block_bytes.size() == block.GetSerializedSize());
+    assert(block_bytes.capacity() == block_bytes.size());
+    auto block_result = Block::Deserialize(block_bytes);
+    assert(block_result.IsOk());
+    assert(block_result.value->transactions.size() == 2);
+    assert(block_result.value->GetHash() == block.GetHash());
+    assert(block_result.value->transactions[1].GetHash() == tx.GetHash());
+    std::cout << "✓ Block round-trip through the stream layer\n";
+}
+
+// Memory resource that counts what reaches the heap
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+void TestTransientViews() {
+    std::cout << "\n=== Test 12: Transient Block and Transaction Views ===\n";
+
+    // A block with a few multi-input transactions
+    BlockHeader header{};
+    header.version = 1;
+    header.timestamp = 1735171200;
+    std::vector<Transaction> txs;
+    for (int t = 0; t < 12; t++) {
+        Transaction tx;
+        tx.version = 1;
+        for (int i = 0; i < 3; i++) {
+            TxIn input;
+            input.prev_tx_hash = uint256{static_cast<uint8_t>(t), static_cast<uint8_t>(i)};
+            input.prev_tx_index = i;
+            input.script_sig = Script(std::vector<uint8_t>(60 + i, static_cast<uint8_t>(t)));
+            tx.inputs.push_back(input);
+        }
+        tx.outputs.emplace_back(1000 + t, Script::CreateP2PKH(uint256{static_cast<uint8_t>(t)}));
+        tx.outputs.emplace_back(2000 + t, Script::CreateP2PKH(uint256{0x42}));
+        tx.locktime = t;
+        tx.signature.fill(static_cast<uint8_t>(0xA0 + t));
+        txs.push_back(tx);
+    }
+    Block block(header, txs);
+    auto bytes = block.Serialize();
+
+    // Decoding into an arena sized by the hint never reaches the heap again
+    CountingResource upstream;
+    std::pmr::monotonic_buffer_resource arena(BlockView::ArenaSizeHint(bytes.size()), &upstream);
+    BlockView view(&arena);
+    SpanReader reader(bytes);
+    assert(view.Unserialize(reader).IsOk());
+    assert(reader.Remaining() == 0);
+    assert(upstream.allocations == 1);
+    std::cout << "✓ Block of " << view.transactions.size() << " transactions decoded with "
+              << upstream.allocations << " upstream allocation\n";
+
+    // Scripts and signatures point into the buffer; hashes match the owning types
+    const TransactionView& tx_view = view.transactions[5];
+    assert(tx_view.inputs[2].script_sig.data() >= bytes.data() &&
+           tx_view.inputs[2].script_sig.data() < bytes.data() + bytes.size());
+    assert(tx_view.GetSerialized().size() == txs[5].GetSerializedSize());
+    assert(tx_view.GetHash() == txs[5].GetHash());
+    assert(view.GetHash() == block.GetHash());
+    assert(view.CalculateMerkleRoot() == block.header.merkle_root);
+    assert(view.GetTransactionHashes() == block.GetTransactionHashes());
+    assert(!tx_view.IsCoinbase());
+    std::cout << "✓ Views hash and merkle-root like the owning types\n";
+
+    // Owning copies are identical and outlive the arena
+    Block owned = view.ToBlock();
+    Transaction owned_tx = tx_view.ToTransaction();
+    assert(owned.Serialize() == bytes);
+    assert(owned_tx.Serialize() == txs[5].Serialize());
+    assert(owned_tx.GetHash() == txs[5].GetHash());
+    assert(owned_tx.inputs[1].script_sig.bytes == txs[5].inputs[1].script_sig.bytes);
+    std::cout << "✓ ToBlock/ToTransaction reproduce the original encoding\n";
+
+    // Truncated input fails like the owning decoder
+    std::vector<uint8_t> truncated(bytes.begin(), bytes.end() - 10);
+    SpanReader truncated_reader(truncated);
+    BlockView truncated_view;
+    assert(truncated_view.Unserialize(truncated_reader).IsError());
+    assert(Block::Deserialize(truncated).IsError());
+
+    std::vector<uint8_t> long_script;
+    SerializeUint64(long_script, 1000);
+    SerializeUint64(long_script, uint64_t{1} << 62);
+    SpanReader long_reader(long_script);
+    TxOutView out_view;
+    assert(out_view.Unserialize(long_reader).IsError());
+    std::cout << "✓ Truncated and oversized encodings rejected\n";
+}
+
 int main() {
     std::cout << "========================================\n";
     std::cout << "Serialization Test Suite\n";
@@ -369,6 +627,9 @@ int main() {
         TestBlockSerialization();
         TestSerializationErrorHandling();
         TestSerializationDeterminism();
+        TestPrecomputedSigningHash();
+        TestStreamSerialization();
+        TestTransientViews();
 
         std::cout << "\n========================================\n";
         std::cout << "✓ All serialization tests passed!\n";